@@ -0,0 +1,58 @@
+/*
+* Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+*
+* Licensed under the Apache License, Version 2.0 (the "License").
+* You may not use this file except in compliance with the License.
+* A copy of the License is located at
+*
+*  http://aws.amazon.com/apache2.0
+*
+* or in the "license" file accompanying this file. This file is distributed
+* on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+* express or implied. See the License for the specific language governing
+* permissions and limitations under the License.
+*/
+
+#include <aws/core/Aws.h>
+#include <aws/core/utils/logging/BinaryLogSystem.h>
+#include <fstream>
+#include <iostream>
+
+using namespace Aws::Utils::Logging;
+
+/**
+ * Usage: aws-cpp-sdk-binary-log-decoder log.blog [more.blog ...]
+ * Writes the messages of every file to stdout, in the format the text log systems use.
+ */
+int main(int argc, char** argv)
+{
+    if (argc < 2)
+    {
+        std::cerr << "usage: " << argv[0] << " <binary log file>..." << std::endl;
+        return 1;
+    }
+
+    Aws::SDKOptions options;
+    Aws::InitAPI(options);
+
+    int result = 0;
+    for (int i = 1; i < argc; ++i)
+    {
+        Aws::IFStream input(argv[i], std::ios_base::in | std::ios_base::binary);
+        if (!input.good())
+        {
+            std::cerr << argv[i] << ": could not be opened" << std::endl;
+            result = 1;
+            continue;
+        }
+
+        if (!BinaryLogDecoder::Decode(input, std::cout))
+        {
+            std::cerr << argv[i] << ": not a binary log, or cut short" << std::endl;
+            result = 1;
+        }
+    }
+
+    Aws::ShutdownAPI(options);
+    return result;
+}
@@ -16,6 +16,7 @@
 #include <aws/external/gtest.h>
 #include <aws/core/auth/AWSAuthSigner.h>
 #include <aws/core/auth/AWSCredentialsProvider.h>
+#include <aws/core/auth/AWSCredentialsProviderChain.h>
 #include <aws/core/utils/logging/LogMacros.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 #include <aws/core/http/standard/StandardHttpRequest.h>
@@ -439,3 +440,63 @@ TEST(AWSAuthV4SignerTest, PostXWWWFormURLEncoded)
 {
     RunV4TestCase("post-x-www-form-urlencoded");
 }
+
+class CountingCredentialsProvider : public Aws::Auth::AWSCredentialsProvider
+{
+public:
+    CountingCredentialsProvider() : m_calls(0) {}
+
+    Aws::Auth::AWSCredentials GetAWSCredentials() override
+    {
+        ++m_calls;
+        return Aws::Auth::AWSCredentials("AKIDEXAMPLE", "wJalrXUtnFEMI/K7MDENG+bPxRfiCYEXAMPLEKEY");
+    }
+
+    int GetCalls() const { return m_calls; }
+
+private:
+    int m_calls;
+};
+
+TEST(AWSAuthV4SignerTest, CredentialsAreResolvedOnFirstSignRequest)
+{
+    auto credProvider = Aws::MakeShared<CountingCredentialsProvider>(ALLOC_TAG);
+    AWSAuthV4Signer signer(credProvider, "service", "us-east-1", AWSAuthV4Signer::PayloadSigningPolicy::Never, false);
+    ASSERT_EQ(0, credProvider->GetCalls());
+
+    auto request = Standard::StandardHttpRequest("https://test.com/query?key=val", Aws::Http::HttpMethod::HTTP_GET);
+    ASSERT_TRUE(signer.SignRequest(request, false/*signPayload*/));
+    ASSERT_EQ(1, credProvider->GetCalls());
+    ASSERT_FALSE(request.GetHeaderValue(Aws::Http::AUTHORIZATION_HEADER).empty());
+}
+
+//falls back to its own credentials when none of its providers has any.
+class FallbackCredentialsProviderChain : public Aws::Auth::AWSCredentialsProviderChain
+{
+public:
+    FallbackCredentialsProviderChain() :
+        m_fallback("AKIDFALLBACK", "wJalrXUtnFEMI/K7MDENG+bPxRfiCYEXAMPLEKEY")
+    {
+        AddProvider(Aws::MakeShared<Aws::Auth::AnonymousAWSCredentialsProvider>(ALLOC_TAG));
+    }
+
+    Aws::Auth::AWSCredentials GetAWSCredentials() override
+    {
+        auto credentials = AWSCredentialsProviderChain::GetAWSCredentials();
+        return credentials.GetAWSAccessKeyId().empty() ? m_fallback : credentials;
+    }
+
+private:
+    Aws::Auth::AWSCredentials m_fallback;
+};
+
+TEST(AWSAuthV4SignerTest, DerivedChainCredentialsAreUsedForSigning)
+{
+    auto credProvider = Aws::MakeShared<FallbackCredentialsProviderChain>(ALLOC_TAG);
+    ASSERT_EQ("AKIDFALLBACK", credProvider->GetAWSCredentials().GetAWSAccessKeyId());
+
+    AWSAuthV4Signer signer(credProvider, "service", "us-east-1", AWSAuthV4Signer::PayloadSigningPolicy::Never, false);
+    auto request = Standard::StandardHttpRequest("https://test.com/query?key=val", Aws::Http::HttpMethod::HTTP_GET);
+    ASSERT_TRUE(signer.SignRequest(request, false/*signPayload*/));
+    ASSERT_NE(Aws::String::npos, request.GetHeaderValue(Aws::Http::AUTHORIZATION_HEADER).find("Credential=AKIDFALLBACK/"));
+}
@@ -19,6 +19,7 @@
 #include <aws/testing/mocks/aws/auth/MockAWSHttpResourceClient.h>
 #include <aws/testing/platform/PlatformTesting.h>
 #include <aws/core/auth/AWSCredentialsProvider.h>
+#include <aws/core/auth/BackgroundCredentialsRefresher.h>
 #include <aws/core/platform/Environment.h>
 #include <aws/core/platform/FileSystem.h>
 #include <aws/core/utils/UnreferencedParam.h>
@@ -27,8 +28,12 @@
 #include <aws/core/utils/FileSystemUtils.h>
 #include <aws/core/config/AWSProfileConfigLoader.h>
 #include <aws/core/auth/AWSCredentialsProviderChain.h>
+#include <aws/core/auth/CredentialsProviderCache.h>
 #include <stdlib.h>
+#include <atomic>
 #include <thread>
+#include <mutex>
+#include <condition_variable>
 #include <fstream>
 
 static const char *AllocationTag = "AWSCredentialsProviderTest";
@@ -299,6 +304,57 @@ TEST_F(EnvironmentModifyingTest, TestProvidersNumberInCredentialsProvidersChain)
 }
 
 
+TEST_F(EnvironmentModifyingTest, TestDefaultChainsShareProvidersWhenConfiguredAlike)
+{
+    Aws::Environment::UnSetEnv("AWS_CONTAINER_CREDENTIALS_RELATIVE_URI");
+    Aws::Environment::SetEnv("AWS_EC2_METADATA_DISABLED", "true", 1);
+    Aws::Environment::UnSetEnv("AWS_DEFAULT_PROFILE");
+    Aws::Environment::SetEnv("AWS_PROFILE", "first", 1);
+    auto cache = GetCredentialsProviderCache();
+    ASSERT_NE(nullptr, cache);
+    cache->Clear();
+
+    {
+        DefaultAWSCredentialsProviderChain firstChain;
+        DefaultAWSCredentialsProviderChain secondChain;
+        ASSERT_EQ(2u, firstChain.GetProviders().size());
+        ASSERT_EQ(firstChain.GetProviders(), secondChain.GetProviders());
+
+        Aws::Environment::SetEnv("AWS_PROFILE", "second", 1);
+        DefaultAWSCredentialsProviderChain otherProfileChain;
+        ASSERT_NE(firstChain.GetProviders()[1], otherProfileChain.GetProviders()[1]);
+        ASSERT_EQ(2u, cache->GetSize());
+    }
+
+    //nothing keeps providers alive once their chains are gone.
+    ASSERT_EQ(0u, cache->GetSize());
+}
+
+TEST(CredentialsProviderCacheTest, TestCreatesProvidersOncePerKey)
+{
+    CredentialsProviderCache cache;
+    int created = 0;
+    auto createProviders = [&created]()
+    {
+        ++created;
+        CredentialsProviders providers;
+        providers.push_back(Aws::MakeShared<SimpleAWSCredentialsProvider>(AllocationTag, "accessKey", "secretKey"));
+        return providers;
+    };
+
+    auto providers = cache.GetOrCreate("key", createProviders);
+    ASSERT_EQ(providers, cache.GetOrCreate("key", createProviders));
+    ASSERT_EQ(1, created);
+
+    cache.GetOrCreate("other key", createProviders);
+    ASSERT_EQ(2, created);
+
+    providers.clear();
+    cache.GetOrCreate("key", createProviders);
+    ASSERT_EQ(3, created);
+}
+
+
 TEST(InstanceProfileCredentialsProviderTest, TestEC2MetadataClientReturnsGoodData)
 {
     auto mockClient = Aws::MakeShared<MockEC2MetadataClient>(AllocationTag);
@@ -455,3 +511,203 @@ TEST(TaskRoleCredentialsProviderTest, TestECSCredentialsClientReturnsBadData)
     ASSERT_EQ("", provider.GetAWSCredentials().GetAWSAccessKeyId());
     ASSERT_EQ("", provider.GetAWSCredentials().GetAWSSecretKey());
 }
+
+template<typename PREDICATE>
+static bool WaitFor(PREDICATE predicate)
+{
+    for (int i = 0; i < 500 && !predicate(); ++i)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    return predicate();
+}
+
+TEST(InstanceProfileCredentialsProviderTest, TestBackgroundRefreshKeepsCredentialsWhenRefreshFails)
+{
+    auto mockClient = Aws::MakeShared<MockEC2MetadataClient>(AllocationTag);
+    mockClient->SetMockedCredentialsValue("{ \"AccessKeyId\": \"goodAccessKey\", \"SecretAccessKey\": \"goodSecretKey\", \"Token\": \"goodToken\" }");
+
+    InstanceProfileCredentialsProvider provider(Aws::MakeShared<Aws::Config::EC2InstanceProfileConfigLoader>(AllocationTag, mockClient), 10,
+        CredentialsRefreshMode::Background);
+    ASSERT_EQ("goodAccessKey", provider.GetAWSCredentials().GetAWSAccessKeyId());
+
+    mockClient->SetMockedCredentialsValue("{ \"AccessKeyId\": \"betterAccessKey\", \"SecretAccessKey\": \"betterSecretKey\", \"Token\": \"betterToken\" }");
+    ASSERT_TRUE(WaitFor([&provider]() { return provider.GetAWSCredentials().GetAWSAccessKeyId() == "betterAccessKey"; }));
+    ASSERT_EQ("betterSecretKey", provider.GetAWSCredentials().GetAWSSecretKey());
+
+    mockClient->SetMockedCredentialsValue("");
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    ASSERT_EQ("betterAccessKey", provider.GetAWSCredentials().GetAWSAccessKeyId());
+    mockClient->SetMockedCredentialsValue("{ }");
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    ASSERT_EQ("betterAccessKey", provider.GetAWSCredentials().GetAWSAccessKeyId());
+}
+
+TEST(TaskRoleCredentialsProviderTest, TestBackgroundRefreshKeepsCredentialsWhenRefreshFails)
+{
+    auto mockClient = Aws::MakeShared<MockECSCredentialsClient>(AllocationTag, "/path/to/res");
+    Aws::String expiration = DateTime(DateTime::Now().Millis() + 60 * 60 * 1000).ToGmtString(DateFormat::ISO_8601);
+    mockClient->SetMockedCredentialsValue("{ \"AccessKeyId\": \"goodAccessKey\", \"SecretAccessKey\": \"goodSecretKey\", \"Token\": \"goodToken\", \"Expiration\": \"" + expiration + "\" }");
+
+    TaskRoleCredentialsProvider provider(mockClient, 10, CredentialsRefreshMode::Background);
+    ASSERT_EQ("goodAccessKey", provider.GetAWSCredentials().GetAWSAccessKeyId());
+    ASSERT_EQ("goodToken", provider.GetAWSCredentials().GetSessionToken());
+
+    mockClient->SetMockedCredentialsValue("blah blah blah, I'm bad");
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    ASSERT_EQ("goodAccessKey", provider.GetAWSCredentials().GetAWSAccessKeyId());
+
+    mockClient->SetMockedCredentialsValue("{ \"AccessKeyId\": \"betterAccessKey\", \"SecretAccessKey\": \"betterSecretKey\", \"Token\": \"betterToken\", \"Expiration\": \"" + expiration + "\" }");
+    ASSERT_TRUE(WaitFor([&provider]() { return provider.GetAWSCredentials().GetAWSAccessKeyId() == "betterAccessKey"; }));
+}
+
+TEST(BackgroundCredentialsRefresherTest, TestRefreshesAheadOfExpiration)
+{
+    std::atomic<int> refreshes(0);
+    std::atomic<int64_t> firstExpirationMs(0);
+    std::atomic<int64_t> secondRefreshMs(0);
+    {
+        //refreshes due in an hour, but the credentials live for 2.4 seconds: the second refresh is due half way through.
+        BackgroundCredentialsRefresher refresher([&](DateTime& expiration)
+        {
+            int64_t now = DateTime::Now().Millis();
+            if (++refreshes == 1)
+            {
+                firstExpirationMs = now + 2400;
+            }
+            else if (refreshes == 2)
+            {
+                secondRefreshMs = now;
+            }
+            expiration = DateTime(now + 2400);
+            return true;
+        }, 60 * 60 * 1000);
+        refresher.WaitForFirstRefresh();
+        ASSERT_EQ(1, refreshes.load());
+        ASSERT_TRUE(WaitFor([&refreshes]() { return refreshes.load() >= 2; }));
+        ASSERT_EQ(0u, refresher.GetConsecutiveFailures());
+    }
+    ASSERT_LT(secondRefreshMs.load(), firstExpirationMs.load() - 1000);
+    ASSERT_GE(secondRefreshMs.load(), firstExpirationMs.load() - 1400);
+}
+
+TEST(AWSCredentialsProviderTest, TestSnapshotsAreSharedUntilCredentialsChange)
+{
+    SimpleAWSCredentialsProvider simpleProvider("accessKey", "secretKey", "sessionToken");
+    auto snapshot = simpleProvider.GetAWSCredentialsSnapshot();
+    ASSERT_EQ(AWSCredentials("accessKey", "secretKey", "sessionToken"), *snapshot);
+    ASSERT_EQ(snapshot, simpleProvider.GetAWSCredentialsSnapshot());
+    ASSERT_TRUE(simpleProvider.ServesCredentialsSnapshots());
+    ASSERT_EQ(snapshot, GetCredentialsSnapshot(simpleProvider));
+
+    auto mockClient = Aws::MakeShared<MockECSCredentialsClient>(AllocationTag, "/path/to/res");
+    Aws::String expiration = DateTime(DateTime::Now().Millis() + 60 * 60 * 1000).ToGmtString(DateFormat::ISO_8601);
+    mockClient->SetMockedCredentialsValue("{ \"AccessKeyId\": \"goodAccessKey\", \"SecretAccessKey\": \"goodSecretKey\", \"Token\": \"goodToken\", \"Expiration\": \"" + expiration + "\" }");
+
+    TaskRoleCredentialsProvider provider(mockClient, 10, CredentialsRefreshMode::Background);
+    snapshot = provider.GetAWSCredentialsSnapshot();
+    ASSERT_EQ("goodAccessKey", snapshot->GetAWSAccessKeyId());
+
+    mockClient->SetMockedCredentialsValue("{ \"AccessKeyId\": \"betterAccessKey\", \"SecretAccessKey\": \"betterSecretKey\", \"Token\": \"betterToken\", \"Expiration\": \"" + expiration + "\" }");
+    ASSERT_TRUE(WaitFor([&provider]() { return provider.GetAWSCredentialsSnapshot()->GetAWSAccessKeyId() == "betterAccessKey"; }));
+    //whoever still holds the old snapshot keeps reading it unchanged.
+    ASSERT_EQ("goodAccessKey", snapshot->GetAWSAccessKeyId());
+    ASSERT_EQ("goodToken", snapshot->GetSessionToken());
+
+    TaskRoleCredentialsProvider onDemandProvider(mockClient, 1000 * 60 * 15);
+    snapshot = onDemandProvider.GetAWSCredentialsSnapshot();
+    ASSERT_EQ("betterAccessKey", snapshot->GetAWSAccessKeyId());
+    ASSERT_EQ(snapshot, onDemandProvider.GetAWSCredentialsSnapshot());
+}
+
+
+class BlockingCredentialsProvider : public AWSCredentialsProvider
+{
+public:
+    BlockingCredentialsProvider(const AWSCredentials& credentials, bool blocked) :
+        m_credentials(credentials), m_blocked(blocked), m_calls(0) {}
+
+    AWSCredentials GetAWSCredentials() override
+    {
+        ++m_calls;
+        std::unique_lock<std::mutex> locker(m_lock);
+        m_signal.wait(locker, [this]() { return !m_blocked; });
+        return m_credentials;
+    }
+
+    void Unblock()
+    {
+        std::lock_guard<std::mutex> locker(m_lock);
+        m_blocked = false;
+        m_signal.notify_all();
+    }
+
+    int GetCalls() const { return m_calls; }
+
+private:
+    AWSCredentials m_credentials;
+    bool m_blocked;
+    std::atomic<int> m_calls;
+    std::mutex m_lock;
+    std::condition_variable m_signal;
+};
+
+class TestCredentialsProviderChain : public AWSCredentialsProviderChain
+{
+public:
+    TestCredentialsProviderChain(const Aws::Vector<std::shared_ptr<AWSCredentialsProvider>>& providers) :
+        AWSCredentialsProviderChain(ChainResolutionMode::Concurrent)
+    {
+        for (const auto& provider : providers)
+        {
+            AddProvider(provider);
+        }
+    }
+};
+
+TEST(AWSCredentialsProviderChainTest, TestConcurrentResolutionKeepsPrecedence)
+{
+    auto first = Aws::MakeShared<BlockingCredentialsProvider>(AllocationTag, AWSCredentials("firstKey", "firstSecret"), true);
+    auto second = Aws::MakeShared<BlockingCredentialsProvider>(AllocationTag, AWSCredentials("secondKey", "secretKey"), false);
+    TestCredentialsProviderChain chain({ first, second });
+
+    std::thread unblocker([&first]()
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        first->Unblock();
+    });
+    ASSERT_EQ("firstKey", chain.GetAWSCredentials().GetAWSAccessKeyId());
+    unblocker.join();
+}
+
+TEST(AWSCredentialsProviderChainTest, TestConcurrentResolutionDoesNotWaitForLowerPriorityProviders)
+{
+    auto empty = Aws::MakeShared<BlockingCredentialsProvider>(AllocationTag, AWSCredentials("", ""), false);
+    auto answering = Aws::MakeShared<BlockingCredentialsProvider>(AllocationTag, AWSCredentials("accessKey", "secretKey"), false);
+    auto slow = Aws::MakeShared<BlockingCredentialsProvider>(AllocationTag, AWSCredentials("slowKey", "slowSecret"), true);
+    {
+        TestCredentialsProviderChain chain({ empty, answering, slow });
+        ASSERT_EQ("accessKey", chain.GetAWSCredentialsSnapshot()->GetAWSAccessKeyId());
+
+        //once a provider answered, the next calls ask the providers up to it in order and leave the slow one alone.
+        ASSERT_EQ("accessKey", chain.GetAWSCredentials().GetAWSAccessKeyId());
+        ASSERT_EQ(2, empty->GetCalls());
+        ASSERT_EQ(2, answering->GetCalls());
+        ASSERT_TRUE(WaitFor([&slow]() { return slow->GetCalls() == 1; }));
+        slow->Unblock();
+    }
+    ASSERT_EQ(1, slow->GetCalls());
+}
+
+
+TEST(AWSCredentialsProviderChainTest, TestConcurrentResolutionBacksOffWhenNoProviderHasCredentials)
+{
+    auto first = Aws::MakeShared<BlockingCredentialsProvider>(AllocationTag, AWSCredentials("", ""), false);
+    auto second = Aws::MakeShared<BlockingCredentialsProvider>(AllocationTag, AWSCredentials("", ""), false);
+    TestCredentialsProviderChain chain({ first, second });
+
+    ASSERT_TRUE(chain.GetAWSCredentials().GetAWSAccessKeyId().empty());
+    ASSERT_TRUE(chain.GetAWSCredentials().GetAWSAccessKeyId().empty());
+    ASSERT_EQ(1, first->GetCalls());
+    ASSERT_EQ(1, second->GetCalls());
+}
@@ -18,12 +18,19 @@
 #include <aws/core/http/standard/StandardHttpRequest.h>
 #include <aws/core/http/standard/StandardHttpResponse.h>
 #include <aws/core/http/HttpClientFactory.h>
+#include <aws/core/http/HttpClientRegistry.h>
 #include <aws/core/utils/HashingUtils.h>
 #include <aws/core/utils/Outcome.h>
+#include <aws/core/utils/crypto/Factories.h>
 #include <aws/core/Globals.h>
+#include <aws/core/Aws.h>
+#include <aws/core/auth/AWSCredentialsProviderChain.h>
+#include <aws/core/platform/Environment.h>
 #include <aws/testing/mocks/http/MockHttpClient.h>
 #include <aws/core/utils/EnumParseOverflowContainer.h>
 #include <aws/testing/mocks/aws/client/MockAWSClient.h>
+#include <aws/testing/Benchmark.h>
+#include <iostream>
 
 using Aws::Utils::DateTime;
 using Aws::Utils::DateFormat;
@@ -286,6 +293,199 @@ TEST(AWSClientTest, TestBuildHttpRequestWithHeadersAndBody)
     ASSERT_EQ(contentLengthExpected.str(), finalHeaders[Http::CONTENT_LENGTH_HEADER]);  
 }
 
+class CountingHttpClientFactory : public MockHttpClientFactory
+{
+public:
+    CountingHttpClientFactory() : m_createdClients(0) {}
+
+    std::shared_ptr<HttpClient> CreateHttpClient(const ClientConfiguration& clientConfiguration) const override
+    {
+        AWS_UNREFERENCED_PARAM(clientConfiguration);
+        ++m_createdClients;
+        auto httpClient = Aws::MakeShared<MockHttpClient>(ALLOCATION_TAG);
+        m_lastCreatedClient = httpClient;
+        return httpClient;
+    }
+
+    int GetCreatedClients() const { return m_createdClients; }
+    std::shared_ptr<HttpClient> GetLastCreatedClient() const { return m_lastCreatedClient.lock(); }
+
+private:
+    mutable int m_createdClients;
+    mutable std::weak_ptr<HttpClient> m_lastCreatedClient;
+};
+
+//the mock http client has no response to return, so the request fails without being retried.
+static void MakeUnansweredRequest(MockAWSClient& client)
+{
+    AmazonWebServiceRequestMock request;
+    ASSERT_FALSE(client.MakeRequest(request).IsSuccess());
+}
+
+TEST(AWSClientTest, TestClientsShareRegisteredHttpClients)
+{
+    auto factory = Aws::MakeShared<CountingHttpClientFactory>(ALLOCATION_TAG);
+    SetHttpClientFactory(factory);
+    auto registry = GetHttpClientRegistry();
+    ASSERT_NE(nullptr, registry);
+    registry->Clear();
+
+    ClientConfiguration config;
+    config.shareHttpClient = true;
+    config.retryStrategy = Aws::MakeShared<CountedRetryStrategy>(ALLOCATION_TAG, 1);
+    {
+        MockAWSClient firstClient(config);
+        MockAWSClient secondClient(config);
+        MakeUnansweredRequest(firstClient);
+        MakeUnansweredRequest(secondClient);
+        ASSERT_EQ(1, factory->GetCreatedClients());
+        ASSERT_EQ(1u, registry->GetSize());
+
+        ClientConfiguration otherConfig;
+        otherConfig.shareHttpClient = true;
+        otherConfig.maxConnectionsPerHost = 4;
+        otherConfig.retryStrategy = config.retryStrategy;
+        MockAWSClient otherPoolClient(otherConfig);
+        MakeUnansweredRequest(otherPoolClient);
+        ASSERT_EQ(2, factory->GetCreatedClients());
+        ASSERT_EQ(2u, registry->GetSize());
+
+        config.shareHttpClient = false;
+        MockAWSClient ownPoolClient(config);
+        MakeUnansweredRequest(ownPoolClient);
+        ASSERT_EQ(3, factory->GetCreatedClients());
+        ASSERT_EQ(2u, registry->GetSize());
+    }
+    ASSERT_EQ(0u, registry->GetSize());
+
+    CleanupHttp();
+    InitHttp();
+}
+
+TEST(AWSClientTest, TestHttpClientRegistryKeyKeepsNoProxyCredentials)
+{
+    ClientConfiguration config;
+    config.proxyUserName = "proxyUser";
+    config.proxyPassword = "proxyPassword";
+    Aws::String key = HttpClientRegistry::ComputeKey(config);
+    ASSERT_EQ(Aws::String::npos, key.find("proxyUser"));
+    ASSERT_EQ(Aws::String::npos, key.find("proxyPassword"));
+    ASSERT_EQ(key, HttpClientRegistry::ComputeKey(config));
+
+    config.proxyPassword = "otherPassword";
+    ASSERT_NE(key, HttpClientRegistry::ComputeKey(config));
+}
+
+TEST(AWSClientTest, TestHttpClientIsCreatedOnFirstRequest)
+{
+    auto factory = Aws::MakeShared<CountingHttpClientFactory>(ALLOCATION_TAG);
+    SetHttpClientFactory(factory);
+
+    ClientConfiguration config;
+    config.retryStrategy = Aws::MakeShared<CountedRetryStrategy>(ALLOCATION_TAG, 1);
+    {
+        MockAWSClient client(config);
+        ASSERT_EQ(0, factory->GetCreatedClients());
+
+        //disabling request processing is remembered until the http client exists.
+        client.DisableRequestProcessing();
+        ASSERT_EQ(0, factory->GetCreatedClients());
+
+        MakeUnansweredRequest(client);
+        ASSERT_EQ(1, factory->GetCreatedClients());
+        ASSERT_FALSE(factory->GetLastCreatedClient()->IsRequestProcessingEnabled());
+
+        client.EnableRequestProcessing();
+        ASSERT_TRUE(factory->GetLastCreatedClient()->IsRequestProcessingEnabled());
+        MakeUnansweredRequest(client);
+        ASSERT_EQ(1, factory->GetCreatedClients());
+    }
+
+    CleanupHttp();
+    InitHttp();
+}
+
+#if defined(ENABLE_CURL_CLIENT) || defined(ENABLE_WINDOWS_CLIENT)
+//A client the way a service client is built: default credentials chain and the platform http client.
+class StartupBenchmarkClient : public AWSClient
+{
+public:
+    StartupBenchmarkClient(const ClientConfiguration& config) : AWSClient(config,
+        Aws::MakeShared<AWSAuthV4Signer>(ALLOCATION_TAG, Aws::MakeShared<Aws::Auth::DefaultAWSCredentialsProviderChain>(ALLOCATION_TAG),
+            "sts", config.region), nullptr)
+    {
+    }
+
+    HttpResponseOutcome Get(const Aws::String& uri) const
+    {
+        AmazonWebServiceRequestMock request;
+        return AttemptExhaustively(URI(uri), request, HttpMethod::HTTP_GET, Aws::Auth::SIGV4_SIGNER);
+    }
+
+    inline const char* GetServiceClientName() const override { return "StartupBenchmarkClient"; }
+
+protected:
+    AWSError<CoreErrors> BuildAWSError(const std::shared_ptr<Aws::Http::HttpResponse>& response) const override
+    {
+        if (!response)
+        {
+            return AWSError<CoreErrors>(CoreErrors::NETWORK_CONNECTION, false);
+        }
+        AWSError<CoreErrors> error(CoreErrors::UNKNOWN, false);
+        error.SetResponseCode(response->GetResponseCode());
+        return error;
+    }
+};
+
+//Startup benchmark: restarts the SDK with default options and times InitAPI, building a client and its first request,
+//which sets up TLS and connects. Run it on its own with --gtest_also_run_disabled_tests and AWS_STARTUP_BENCHMARK_URI set
+//to the endpoint to time, any response will do. The SDK is restarted with the test runner's options afterwards.
+TEST(AWSClientTest, DISABLED_BenchmarkInitApiToFirstRequest)
+{
+    Aws::String uri = Aws::Environment::GetEnv("AWS_STARTUP_BENCHMARK_URI");
+    if (uri.empty())
+    {
+        std::cout << "AWS_STARTUP_BENCHMARK_URI is not set, skipping the startup benchmark." << std::endl;
+        return;
+    }
+
+    //the memory manager the runner installed stays in place, neither set of options names one.
+    Aws::SDKOptions runnerOptions;
+    runnerOptions.loggingOptions.logLevel = Aws::Utils::Logging::LogLevel::Trace;
+    runnerOptions.httpOptions.installSigPipeHandler = true;
+    Aws::ShutdownAPI(runnerOptions);
+
+    Aws::SDKOptions options;
+    Aws::Testing::BenchmarkTimer timer;
+    Aws::InitAPI(options);
+    timer.RecordMicros("InitApiMicros");
+
+    ClientConfiguration config;
+    config.region = Aws::Region::US_EAST_1;
+    config.retryStrategy = Aws::MakeShared<CountedRetryStrategy>(ALLOCATION_TAG, 1);
+    bool reachedEndpoint = false;
+    {
+        Aws::Testing::BenchmarkTimer clientTimer;
+        StartupBenchmarkClient client(config);
+        clientTimer.RecordMicros("ClientConstructionMicros");
+
+        clientTimer.Restart();
+        auto outcome = client.Get(uri);
+        clientTimer.RecordMicros("FirstRequestMicros");
+        timer.RecordMicros("InitApiToFirstRequestMicros");
+        reachedEndpoint = outcome.IsSuccess() || outcome.GetError().GetErrorType() != CoreErrors::NETWORK_CONNECTION;
+
+        clientTimer.Restart();
+        client.Get(uri);
+        clientTimer.RecordMicros("SecondRequestMicros");
+    }
+
+    Aws::ShutdownAPI(options);
+    Aws::InitAPI(runnerOptions);
+    ASSERT_TRUE(reachedEndpoint);
+}
+#endif // ENABLE_CURL_CLIENT || ENABLE_WINDOWS_CLIENT
+
 TEST(AWSClientTest, TestHostHeaderWithNonStandardHttpPort)
 {
     Standard::StandardHttpRequest r1("http://example.amazonaws.com:8080", HttpMethod::HTTP_GET);
@@ -129,6 +129,7 @@ protected:
         Aws::Environment::SetEnv(DefaultMonitoring::DEFAULT_CSM_ENVIRONMENT_VAR_ENABLED, originalEnabled.c_str(), 1);
         Aws::Environment::SetEnv(DefaultMonitoring::DEFAULT_CSM_ENVIRONMENT_VAR_CLIENT_ID, originalClientId.c_str(), 1);
         Aws::Environment::SetEnv(DefaultMonitoring::DEFAULT_CSM_ENVIRONMENT_VAR_PORT, StringUtils::to_string(originalPort).c_str(), 1);
+        Aws::Environment::SetEnv(DefaultMonitoring::DEFAULT_CSM_ENVIRONMENT_VAR_BATCH_EVENTS, "", 1);
 
         mockClient = nullptr;
         mockHttpClient = nullptr;
@@ -456,3 +457,57 @@ TEST_F(MonitoringEndToEndTestSuite, TestMockS3TwoAttemptsFailedThenFailed)
     ASSERT_LE(api.View().GetString("Timestamp"), attemptFail2.View().GetString("Timestamp"));
     ASSERT_GE(api.View().GetInt64("Latency"), attemptFail.View().GetInt64("AttemptLatency") + attemptFail2.View().GetInt64("AttemptLatency"));
 }
+
+TEST_F(MonitoringEndToEndTestSuite, TestMockDynamoDbTwoAttemptsBatchedInOneDatagram)
+{
+    Aws::Environment::SetEnv(DefaultMonitoring::DEFAULT_CSM_ENVIRONMENT_VAR_BATCH_EVENTS, "true", 1);
+    Aws::Monitoring::CleanupMonitoring();
+    std::vector<MonitoringFactoryCreateFunction> factoryFunctions;
+    Aws::Monitoring::InitMonitoring(factoryFunctions);
+
+    Threading::DefaultExecutor exec;
+    Threading::Semaphore ev(0, 1);
+    Threading::Semaphore sync(0, 1);
+    Aws::String result;
+    auto ListenerAgent = [&] {
+        Aws::Net::SimpleUDP serverUDP(true/*IPV4*/, Aws::Net::UDP_BUFFER_SIZE/*SENDBUF*/, Aws::Net::UDP_BUFFER_SIZE/*RECVBUF*/, true/*NOBLOCKING*/);
+        ASSERT_EQ(0, serverUDP.BindToLocalHost(static_cast<unsigned short>(StringUtils::ConvertToInt32(Aws::Environment::GetEnv(DefaultMonitoring::DEFAULT_CSM_ENVIRONMENT_VAR_PORT).c_str()))));
+        sync.ReleaseAll();
+        uint8_t buffer[Aws::Net::UDP_BUFFER_SIZE];
+        int dataLen;
+        while ((dataLen = serverUDP.ReceiveDataFrom(nullptr, nullptr, buffer, sizeof(buffer))) == -1);
+        result = Aws::String(reinterpret_cast<const char*>(buffer), dataLen);
+        ev.ReleaseAll();
+    };
+    exec.Submit(ListenerAgent);
+    sync.WaitOne();
+    SetServiceClient("DynamoDb", Aws::Region::US_WEST_2);
+    MockServiceRequest request("PutItem");
+    HeaderValueCollection responseHeaders;
+    QueueMockResponse(HttpResponseCode::BAD_REQUEST, responseHeaders);
+    QueueMockResponse(HttpResponseCode::OK, responseHeaders);
+    QueueMockAWSError(responseHeaders, HttpResponseCode::BAD_REQUEST, true, CoreErrors::INVALID_PARAMETER_VALUE, "ProvisionedThroughputExceededException", "Blah \"Blah\"\n");
+    auto outcome = mockClient->MakeRequest(request);
+
+    // The events of the call wait for the flush interval, then go out together.
+    ev.WaitOne();
+
+    auto events = StringUtils::Split(result, '\n');
+    ASSERT_EQ(3u, events.size());
+    Aws::Utils::Json::JsonValue attemptFail(events[0]);
+    Aws::Utils::Json::JsonValue attemptSuccess(events[1]);
+    Aws::Utils::Json::JsonValue api(events[2]);
+
+    ASSERT_EQ(13u, attemptFail.View().GetAllObjects().size());
+    DefaultMonitoringCommonAssert(attemptFail, request.GetServiceRequestName(), "ApiCallAttempt");
+    DefaultMonitoringAttemptAssert(attemptFail, HttpResponseCode::BAD_REQUEST, Aws::Region::US_WEST_2);
+    ASSERT_STREQ("ProvisionedThroughputExceededException:Blah \"Blah\"\n", attemptFail.View().GetString("AwsExceptionMessage").c_str());
+
+    ASSERT_EQ(12u, attemptSuccess.View().GetAllObjects().size());
+    DefaultMonitoringCommonAssert(attemptSuccess, request.GetServiceRequestName(), "ApiCallAttempt");
+    DefaultMonitoringAttemptAssert(attemptSuccess, HttpResponseCode::OK, Aws::Region::US_WEST_2);
+
+    ASSERT_EQ(10u, api.View().GetAllObjects().size());
+    DefaultMonitoringCommonAssert(api, request.GetServiceRequestName(), "ApiCall");
+    DefaultMonitoringApiCallAssert(api, Aws::Region::US_WEST_2, 2/*AttemptCount*/, 0/*maxRetriesExceeded*/);
+}
@@ -21,6 +21,9 @@
 #include <aws/core/monitoring/MonitoringFactory.h>
 #include <aws/core/monitoring/MonitoringManager.h>
 #include <aws/core/monitoring/DefaultMonitoring.h>
+#include <aws/core/monitoring/HistogramMonitoring.h>
+#include <aws/core/monitoring/RequestPhaseTimings.h>
+#include <algorithm>
 
 using namespace Aws::Monitoring;
 
@@ -312,6 +315,107 @@ TEST_F(MonitoringTestSuite, TestMonitoringListenersAreCalledCorrectlyWithoutRetr
     ASSERT_EQ(1, MonitorOneAPICalledCounter[4]); // finished 1 time
 }
 
+TEST_F(MonitoringTestSuite, TestHistogramMonitoringRecordsCallsAndAttempts)
+{
+    auto histograms = Aws::MakeShared<LatencyHistograms>(ALLOCATION_TAG);
+    Aws::Monitoring::CleanupMonitoring();
+    std::vector<MonitoringFactoryCreateFunction> factoryFunctions;
+    factoryFunctions.emplace_back([histograms]() { return Aws::MakeUnique<HistogramMonitoringFactory>(ALLOCATION_TAG, histograms); });
+    Aws::Monitoring::InitMonitoring(factoryFunctions);
+
+    HeaderValueCollection responseHeaders, requestHeaders;
+    responseHeaders.emplace("Date", (Aws::Utils::DateTime::Now() + std::chrono::hours(1)).ToGmtString(Aws::Utils::DateFormat::RFC822)); // server is ahead of us by 1 hour
+    AmazonWebServiceRequestMock request;
+    requestHeaders.emplace("X-Amz-Date", Aws::Utils::DateTime::Now().ToGmtString(Aws::Utils::DateFormat::ISO_8601));
+    request.SetHeaders(requestHeaders);
+    QueueMockResponse(HttpResponseCode::BAD_REQUEST, responseHeaders);
+    QueueMockResponse(HttpResponseCode::OK, responseHeaders);
+    ASSERT_TRUE(client->MakeRequest(request).IsSuccess());
+    QueueMockResponse(HttpResponseCode::OK, responseHeaders);
+    ASSERT_TRUE(client->MakeRequest(request).IsSuccess());
+
+    //one failed attempt, then two calls that ended with a 200: the first after a retry. Request phases follow the metrics
+    //of each status code.
+    auto snapshot = histograms->GetSnapshot();
+    ASSERT_LE(4u, snapshot.size());
+    for (size_t i = 0; i < 3; ++i)
+    {
+        ASSERT_STREQ("MockAWSClient", snapshot[i].serviceName.c_str());
+        ASSERT_STREQ("AmazonWebServiceRequestMock", snapshot[i].requestName.c_str());
+        ASSERT_EQ(200, snapshot[i].statusCode);
+        ASSERT_EQ(2, snapshot[i].histogram.GetTotalCount());
+    }
+    ASSERT_STREQ(LatencyHistograms::CALL_LATENCY, snapshot[0].metricName.c_str());
+    ASSERT_STREQ(LatencyHistograms::ATTEMPT_LATENCY, snapshot[1].metricName.c_str());
+    ASSERT_STREQ(LatencyHistograms::RETRIES, snapshot[2].metricName.c_str());
+    ASSERT_EQ(0, snapshot[2].histogram.GetMin());
+    ASSERT_EQ(1, snapshot[2].histogram.GetMax());
+    auto failedAttempts = std::find_if(snapshot.begin(), snapshot.end(), [](const MetricHistogram& metric) { return metric.statusCode == 400; });
+    ASSERT_NE(snapshot.end(), failedAttempts);
+    ASSERT_STREQ(LatencyHistograms::ATTEMPT_LATENCY, failedAttempts->metricName.c_str());
+    ASSERT_EQ(1, failedAttempts->histogram.GetTotalCount());
+
+    Aws::StringStream exported;
+    histograms->Export(exported);
+    ASSERT_NE(Aws::String::npos, exported.str().find("MockAWSClient AmazonWebServiceRequestMock 200 Retries count=2 min=0 p50=0 p99=1 p999=1 max=1\n"));
+
+    histograms->Reset();
+    ASSERT_TRUE(histograms->GetSnapshot().empty());
+}
+
+TEST_F(MonitoringTestSuite, TestRequestPhaseTimingsReachMonitors)
+{
+    RequestPhaseTimings timings;
+    ASSERT_FALSE(timings.WasRecorded(RequestPhase::Signing));
+    timings.Add(RequestPhase::Signing, std::chrono::microseconds(3));
+    timings.Add(RequestPhase::Signing, std::chrono::microseconds(4));
+    ASSERT_TRUE(timings.WasRecorded(RequestPhase::Signing));
+    ASSERT_EQ(7000, timings.Get(RequestPhase::Signing).count());
+    ASSERT_FALSE(timings.WasRecorded(RequestPhase::Send));
+    ASSERT_STREQ("TimeToFirstByte", GetRequestPhaseName(RequestPhase::TimeToFirstByte));
+    ASSERT_STREQ("RetryBackoff", GetRequestPhaseName(RequestPhase::RetryBackoff));
+
+    auto histograms = Aws::MakeShared<LatencyHistograms>(ALLOCATION_TAG);
+    Aws::Monitoring::CleanupMonitoring();
+    std::vector<MonitoringFactoryCreateFunction> factoryFunctions;
+    factoryFunctions.emplace_back([histograms]() { return Aws::MakeUnique<HistogramMonitoringFactory>(ALLOCATION_TAG, histograms); });
+    Aws::Monitoring::InitMonitoring(factoryFunctions);
+
+    HeaderValueCollection responseHeaders, requestHeaders;
+    responseHeaders.emplace("Date", (Aws::Utils::DateTime::Now() + std::chrono::hours(1)).ToGmtString(Aws::Utils::DateFormat::RFC822)); // server is ahead of us by 1 hour
+    AmazonWebServiceRequestMock request;
+    requestHeaders.emplace("X-Amz-Date", Aws::Utils::DateTime::Now().ToGmtString(Aws::Utils::DateFormat::ISO_8601));
+    request.SetHeaders(requestHeaders);
+    QueueMockResponse(HttpResponseCode::BAD_REQUEST, responseHeaders);
+    QueueMockResponse(HttpResponseCode::OK, responseHeaders);
+    ASSERT_TRUE(client->MakeRequest(request).IsSuccess());
+
+    auto snapshot = histograms->GetSnapshot();
+    auto phaseCount = [&snapshot](int statusCode, RequestPhase phase)
+    {
+        for (const auto& metric : snapshot)
+        {
+            if (metric.statusCode == statusCode && metric.metricName == GetRequestPhaseName(phase))
+            {
+                return metric.histogram.GetTotalCount();
+            }
+        }
+        return static_cast<int64_t>(0);
+    };
+
+    //the mock http client reports no network phases; the client times everything around it.
+    for (int statusCode : { 400, 200 })
+    {
+        ASSERT_EQ(1, phaseCount(statusCode, RequestPhase::EndpointResolution));
+        ASSERT_EQ(1, phaseCount(statusCode, RequestPhase::Serialization));
+        ASSERT_EQ(1, phaseCount(statusCode, RequestPhase::Signing));
+        ASSERT_EQ(0, phaseCount(statusCode, RequestPhase::TimeToFirstByte));
+    }
+    ASSERT_EQ(1, phaseCount(400, RequestPhase::ResponseParsing));
+    ASSERT_EQ(0, phaseCount(400, RequestPhase::RetryBackoff));
+    ASSERT_EQ(1, phaseCount(200, RequestPhase::RetryBackoff));
+}
+
 TEST_F(MonitoringTestSuite, TestHttpClientMetrics)
 {
     ASSERT_EQ(HttpClientMetricsType::DestinationIp, GetHttpClientMetricTypeByName("DestinationIp"));
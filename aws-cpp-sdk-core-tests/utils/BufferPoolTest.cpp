@@ -0,0 +1,148 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/external/gtest.h>
+#include <aws/core/utils/BufferPool.h>
+#include <aws/core/utils/stream/ResponseStream.h>
+#include <aws/core/utils/memory/stl/AWSString.h>
+
+using namespace Aws::Utils;
+
+TEST(BufferPoolTest, TestBuffersAreReused)
+{
+    BufferPool pool(1024 * 1024);
+
+    size_t capacity = 0;
+    char* first = pool.Acquire(300, capacity);
+    ASSERT_EQ(512u, capacity);
+    pool.Release(first, capacity);
+    ASSERT_EQ(512u, pool.GetRetainedBytes());
+
+    char* second = pool.Acquire(400, capacity);
+    ASSERT_EQ(first, second);
+    ASSERT_EQ(0u, pool.GetRetainedBytes());
+    pool.Release(second, capacity);
+
+    //too large to be pooled, and not of a pooled size.
+    char* large = pool.Acquire(2 * 1024 * 1024, capacity);
+    ASSERT_EQ(2u * 1024 * 1024, capacity);
+    pool.Release(large, capacity);
+    char* odd = static_cast<char*>(Aws::Malloc("BufferPoolTest", 300));
+    pool.Release(odd, 300);
+    ASSERT_EQ(512u, pool.GetRetainedBytes());
+
+    pool.Clear();
+    ASSERT_EQ(0u, pool.GetRetainedBytes());
+}
+
+TEST(BufferPoolTest, TestTrimmingToHighWaterMark)
+{
+    BufferPool pool(1024 * 1024, 1024 * 1024, 4);
+
+    size_t capacity = 0;
+    char* buffers[8];
+    for (auto& buffer : buffers)
+    {
+        buffer = pool.Acquire(512, capacity);
+    }
+    for (auto buffer : buffers)
+    {
+        pool.Release(buffer, capacity);
+    }
+    //half of them were released after the first trim, which only allowed for the other half still in use.
+    ASSERT_EQ(4u * 512, pool.GetRetainedBytes());
+
+    for (int i = 0; i < 4; ++i)
+    {
+        pool.Release(pool.Acquire(512, capacity), capacity);
+    }
+    ASSERT_EQ(512u, pool.GetRetainedBytes());
+
+    pool.Release(pool.Acquire(512, capacity), capacity);
+    pool.Trim();
+    pool.Trim();
+    ASSERT_EQ(0u, pool.GetRetainedBytes());
+}
+
+TEST(BufferPoolTest, TestForeignBuffersDoNotChangeCounts)
+{
+    BufferPool pool(1024 * 1024);
+
+    size_t capacity = 0;
+    char* pooled = pool.Acquire(512, capacity);
+    //same size as a pooled buffer, but it was never handed out so it is neither counted nor cached.
+    pool.Release(static_cast<char*>(Aws::Malloc("BufferPoolTest", 512)), 512);
+    ASSERT_EQ(0u, pool.GetRetainedBytes());
+
+    pool.Release(pooled, capacity);
+    ASSERT_EQ(512u, pool.GetRetainedBytes());
+    ASSERT_EQ(pooled, pool.Acquire(512, capacity));
+    pool.Release(pooled, capacity);
+}
+
+TEST(BufferPoolTest, TestRetainedBytesLimit)
+{
+    BufferPool pool(1024);
+
+    size_t capacity = 0;
+    char* buffers[4];
+    for (auto& buffer : buffers)
+    {
+        buffer = pool.Acquire(512, capacity);
+    }
+    for (auto buffer : buffers)
+    {
+        pool.Release(buffer, capacity);
+    }
+    ASSERT_EQ(1024u, pool.GetRetainedBytes());
+}
+
+TEST(BufferPoolTest, TestResponseStreamsDrawFromInstalledPool)
+{
+    BufferPool* previous = GetBufferPool();
+    if (previous)
+    {
+        //the tests were started with pooling on, nothing to install.
+        return;
+    }
+
+    InitializeBufferPool(1024 * 1024);
+    ASSERT_NE(nullptr, GetBufferPool());
+    {
+        Aws::Utils::Stream::ResponseStream response(Aws::Utils::Stream::DefaultResponseStreamFactoryMethod);
+        Aws::IOStream& body = response.GetUnderlyingStream();
+        Aws::String payload(5000, 'x');
+        body << payload;
+        body.seekg(0, std::ios_base::end);
+        ASSERT_EQ(5000, static_cast<int>(body.tellg()));
+        body.seekg(0, std::ios_base::beg);
+
+        Aws::String readBack;
+        body >> readBack;
+        ASSERT_EQ(payload, readBack);
+    }
+    //every buffer the stream grew through is kept for the next one.
+    ASSERT_LT(0u, GetBufferPool()->GetRetainedBytes());
+
+    PooledBuffer scratch(1000);
+    ASSERT_EQ(1024u, scratch.GetCapacity());
+    PooledBuffer moved(std::move(scratch));
+    ASSERT_EQ(nullptr, scratch.GetData());
+    ASSERT_NE(nullptr, moved.GetData());
+    moved = PooledBuffer();
+
+    CleanupBufferPool();
+    ASSERT_EQ(nullptr, GetBufferPool());
+}
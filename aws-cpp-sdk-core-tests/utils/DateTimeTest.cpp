@@ -15,8 +15,12 @@
 
 #include <aws/external/gtest.h>
 #include <aws/core/utils/DateTime.h>
+#include <aws/core/platform/Time.h>
+#include <aws/testing/Benchmark.h>
+#include <ctime>
 
 using namespace Aws::Utils;
+using namespace Aws::Testing;
 
 TEST(DateTimeTest, TestDefault)
 {
@@ -156,3 +160,120 @@ TEST(DateTimeTest, TestFormatAutoDetect)
     DateTime parsedBadDate(badDate, DateFormat::AutoDetect);
     ASSERT_FALSE(parsedBadDate.WasParseSuccessful());
 }
+
+TEST(DateTimeTest, TestFixedLayoutsMatchTimeStructConversion)
+{
+    //walks 1900-2100 in steps that hit every day of the week, month lengths and leap years.
+    for (int64_t seconds = -2208988800LL; seconds < 4102444800LL; seconds += 86400LL * 17 + 3671)
+    {
+        DateTime date(seconds * 1000);
+        std::time_t time = static_cast<std::time_t>(seconds);
+        struct tm gmtTimeStamp;
+        Aws::Time::GMTime(&gmtTimeStamp, time);
+
+        char expected[100];
+        std::strftime(expected, sizeof(expected), "%Y-%m-%dT%H:%M:%SZ", &gmtTimeStamp);
+        ASSERT_EQ(expected, date.ToGmtString(DateFormat::ISO_8601));
+        ASSERT_EQ(date, DateTime(expected, DateFormat::ISO_8601));
+
+        std::strftime(expected, sizeof(expected), "%a, %d %b %Y %H:%M:%S GMT", &gmtTimeStamp);
+        ASSERT_EQ(expected, date.ToGmtString(DateFormat::RFC822));
+        ASSERT_EQ(date, DateTime(expected, DateFormat::AutoDetect));
+
+        std::strftime(expected, sizeof(expected), "%Y%m%dT%H%M%SZ", &gmtTimeStamp);
+        ASSERT_EQ(expected, date.ToGmtString("%Y%m%dT%H%M%SZ"));
+    }
+}
+
+TEST(DateTimeTest, TestFormatIntoBuffer)
+{
+    DateTime date(int64_t(1033545909527));
+    char buffer[DateTime::MAX_GMT_STRING_LENGTH];
+    ASSERT_EQ(20u, date.ToGmtString(DateFormat::ISO_8601, buffer, sizeof(buffer)));
+    ASSERT_STREQ("2002-10-02T08:05:09Z", buffer);
+    ASSERT_EQ(29u, date.ToGmtString(DateFormat::RFC822, buffer, sizeof(buffer)));
+    ASSERT_STREQ("Wed, 02 Oct 2002 08:05:09 GMT", buffer);
+
+    char smallBuffer[20];
+    ASSERT_EQ(0u, date.ToGmtString(DateFormat::ISO_8601, smallBuffer, sizeof(smallBuffer)));
+}
+
+TEST(DateTimeTest, TestVariationsOutsideFixedLayouts)
+{
+    DateTime expected("2002-10-02T08:05:09Z", DateFormat::ISO_8601);
+    ASSERT_EQ(expected, DateTime("2002-10-02T08:05:09.123456Z", DateFormat::ISO_8601));
+    ASSERT_EQ(expected, DateTime("2002-10-02T08:05:09.Z", DateFormat::ISO_8601));
+    ASSERT_EQ(expected, DateTime("wed, 02 oct 2002 08:05:09 utc", DateFormat::RFC822));
+    ASSERT_EQ(expected, DateTime("Wed, 2 Oct 2002 08:05:09 GMT", DateFormat::RFC822));
+    ASSERT_EQ(DateTime("2002-11-01T08:05:09Z", DateFormat::ISO_8601), DateTime("2002-10-32T08:05:09Z", DateFormat::ISO_8601));
+    //out of range fields are left to the state machine, which hands them to timegm like it always did.
+    ASSERT_EQ(DateTime("2002-09-30T08:05:09Z", DateFormat::ISO_8601), DateTime("2002-10-00T08:05:09Z", DateFormat::ISO_8601));
+    ASSERT_EQ(DateTime("2002-10-06T03:05:09Z", DateFormat::ISO_8601), DateTime("2002-10-02T99:05:09Z", DateFormat::ISO_8601));
+    ASSERT_EQ(DateTime("2002-10-02T09:39:09Z", DateFormat::ISO_8601), DateTime("Wed, 02 Oct 2002 08:99:09 GMT", DateFormat::RFC822));
+    ASSERT_EQ(DateTime("2002-10-02T08:06:39Z", DateFormat::ISO_8601), DateTime("Wed, 02 Oct 2002 08:05:99 GMT", DateFormat::RFC822));
+    ASSERT_FALSE(DateTime("2002-10-02T08:05:0xZ", DateFormat::ISO_8601).WasParseSuccessful());
+    ASSERT_FALSE(DateTime("Wex, 02 Oct 2002 08:05:09 GMT", DateFormat::RFC822).WasParseSuccessful());
+}
+
+//Run with --gtest_also_run_disabled_tests. Each pair times the fixed layout path against the tm based path
+//the same timestamp took before it: the state machine plus timegm for parsing and GMTime plus strftime for formatting.
+//Formatting is compared into a buffer; the string returning overload adds one allocation, which under the test
+//runner's tracking memory system costs more than the formatting itself.
+TEST(DateTimeTest, DISABLED_BenchmarkFixedLayouts)
+{
+    static const int ITERATIONS = 200000;
+    const DateTime date(int64_t(1033545909527));
+    int64_t checksum = 0;
+
+    RecordNanosPerOperation("ParseIso8601FixedLayoutNs", ITERATIONS, [&]()
+    {
+        checksum += DateTime("2002-10-02T08:05:09Z", DateFormat::ISO_8601).Millis();
+    });
+    RecordNanosPerOperation("ParseRfc822FixedLayoutNs", ITERATIONS, [&]()
+    {
+        checksum += DateTime("Wed, 02 Oct 2002 08:05:09 GMT", DateFormat::RFC822).Millis();
+    });
+    //a single digit day fails the fixed layout check and takes the state machine.
+    RecordNanosPerOperation("ParseRfc822StateMachineNs", ITERATIONS, [&]()
+    {
+        checksum += DateTime("Wed, 2 Oct 2002 08:05:09 GMT", DateFormat::RFC822).Millis();
+    });
+
+    RecordNanosPerOperation("FormatIso8601FixedLayoutNs", ITERATIONS, [&]()
+    {
+        checksum += date.ToGmtString(DateFormat::ISO_8601).size();
+    });
+    RecordNanosPerOperation("FormatIso8601IntoBufferNs", ITERATIONS, [&]()
+    {
+        char formatted[DateTime::MAX_GMT_STRING_LENGTH];
+        checksum += date.ToGmtString(DateFormat::ISO_8601, formatted, sizeof(formatted));
+    });
+    RecordNanosPerOperation("FormatIso8601StrftimeNs", ITERATIONS, [&]()
+    {
+        std::time_t time = static_cast<std::time_t>(date.Millis() / 1000);
+        struct tm gmtTimeStamp;
+        Aws::Time::GMTime(&gmtTimeStamp, time);
+        char formatted[DateTime::MAX_GMT_STRING_LENGTH];
+        checksum += std::strftime(formatted, sizeof(formatted), "%Y-%m-%dT%H:%M:%SZ", &gmtTimeStamp);
+    });
+
+    RecordNanosPerOperation("FormatRfc822FixedLayoutNs", ITERATIONS, [&]()
+    {
+        checksum += date.ToGmtString(DateFormat::RFC822).size();
+    });
+    RecordNanosPerOperation("FormatRfc822IntoBufferNs", ITERATIONS, [&]()
+    {
+        char formatted[DateTime::MAX_GMT_STRING_LENGTH];
+        checksum += date.ToGmtString(DateFormat::RFC822, formatted, sizeof(formatted));
+    });
+    RecordNanosPerOperation("FormatRfc822StrftimeNs", ITERATIONS, [&]()
+    {
+        std::time_t time = static_cast<std::time_t>(date.Millis() / 1000);
+        struct tm gmtTimeStamp;
+        Aws::Time::GMTime(&gmtTimeStamp, time);
+        char formatted[DateTime::MAX_GMT_STRING_LENGTH];
+        checksum += std::strftime(formatted, sizeof(formatted), "%a, %d %b %Y %H:%M:%S GMT", &gmtTimeStamp);
+    });
+
+    ASSERT_NE(0, checksum);
+}
@@ -16,6 +16,11 @@
 #include <aws/external/gtest.h>
 #include <aws/core/utils/EnumParseOverflowContainer.h>
 #include <aws/core/utils/HashingUtils.h>
+#include <aws/core/utils/PerfectHash.h>
+#include <aws/core/utils/StringUtils.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+
+#include <thread>
 
 using namespace Aws::Utils;
 
@@ -44,4 +49,86 @@ TEST(EnumOverflowTest, TestUseWithEnum)
 
     TestEnum nonModeledValue = static_cast<TestEnum>(hashCode);
     ASSERT_EQ("VALUE4", container.RetrieveOverflow(static_cast<int>(nonModeledValue)));
-}
\ No newline at end of file
+}
+
+TEST(EnumOverflowTest, TestStoreKeepsRetrievedValuesValid)
+{
+    EnumParseOverflowContainer container;
+    container.StoreOverflow(15, "fifteen");
+    const Aws::String& fifteen = container.RetrieveOverflow(15);
+    container.StoreOverflow(15, "fifteen");
+    ASSERT_EQ(&fifteen, &container.RetrieveOverflow(15));
+
+    //a colliding value replaces the old one for later lookups, without invalidating references to it.
+    container.StoreOverflow(15, "FIFTEEN");
+    ASSERT_EQ("FIFTEEN", container.RetrieveOverflow(15));
+    ASSERT_EQ("fifteen", fifteen);
+
+    //going back to an earlier value reuses what was stored for it.
+    container.StoreOverflow(15, "fifteen");
+    ASSERT_EQ(&fifteen, &container.RetrieveOverflow(15));
+}
+
+TEST(EnumOverflowTest, TestConcurrentStoreAndRetrieve)
+{
+    EnumParseOverflowContainer container;
+    Aws::Vector<std::thread> threads;
+    //gtest assertions only abort the thread they fail on, so the workers count mismatches and the test checks them here.
+    int mismatches[4] = {};
+    for (int i = 0; i < 4; ++i)
+    {
+        threads.emplace_back([&container, &mismatches, i]
+        {
+            for (int value = 0; value < 500; ++value)
+            {
+                Aws::String name = StringUtils::to_string(value);
+                container.StoreOverflow(value, name);
+                if (container.RetrieveOverflow(value) != name ||
+                    container.RetrieveOverflow(value / (i + 1)) != StringUtils::to_string(value / (i + 1)))
+                {
+                    ++mismatches[i];
+                }
+            }
+        });
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    for (int i = 0; i < 4; ++i)
+    {
+        ASSERT_EQ(0, mismatches[i]);
+    }
+
+    for (int value = 0; value < 500; ++value)
+    {
+        ASSERT_EQ(StringUtils::to_string(value), container.RetrieveOverflow(value));
+    }
+}
+
+//table as emitted by the code generator for these names.
+static const char* const STORAGE_CLASS_NAMES[] = { "STANDARD", "REDUCED_REDUNDANCY", "GLACIER", "STANDARD_IA", "ONEZONE_IA" };
+static const int STORAGE_CLASS_DISPLACEMENTS[] = { -5, -4, 0, -3, 1 };
+static const int STORAGE_CLASS_SLOTS[] = { 1, 4, 3, 2, 5 };
+
+static int FindStorageClass(const char* name)
+{
+    return PerfectHash::Find(name, HashingUtils::HashString(name), STORAGE_CLASS_DISPLACEMENTS, STORAGE_CLASS_SLOTS, STORAGE_CLASS_NAMES, 5);
+}
+
+TEST(EnumOverflowTest, TestPerfectHashLookup)
+{
+    for (int value = 1; value <= 5; ++value)
+    {
+        ASSERT_EQ(value, FindStorageClass(STORAGE_CLASS_NAMES[value - 1]));
+    }
+
+    ASSERT_EQ(0, FindStorageClass(""));
+    ASSERT_EQ(0, FindStorageClass("DEEP_ARCHIVE"));
+    //same hash code as GLACIER, only the full compare tells them apart.
+    ASSERT_EQ(HashingUtils::HashString("GLACIER"), HashingUtils::HashString("H-ACIER"));
+    ASSERT_EQ(0, FindStorageClass("H-ACIER"));
+    ASSERT_EQ(0, PerfectHash::Find("STANDARD", HashingUtils::HashString("STANDARD"), nullptr, nullptr, nullptr, 0));
+}
@@ -16,6 +16,8 @@
 #include <aws/external/gtest.h>
 
 #include <aws/core/utils/HashingUtils.h>
+#include <aws/core/utils/crypto/Factories.h>
+#include <aws/core/utils/crypto/Hash.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
 
@@ -318,3 +320,36 @@ TEST(HashingUtilsTest, TestMD5FromStream)
     TestMD5FromStream( "12345678901234567890123456789012345678901234567890123456789012345678901234567890", "V+30oivjyVWsSdouIQe2eg==" );
 }
 
+class StaticStateCountingHashFactory : public Aws::Utils::Crypto::HashFactory
+{
+public:
+    StaticStateCountingHashFactory() : m_initCount(0), m_cleanupCount(0) {}
+
+    std::shared_ptr<Aws::Utils::Crypto::Hash> CreateImplementation() const override { return nullptr; }
+    void InitStaticState() override { ++m_initCount; }
+    void CleanupStaticState() override { ++m_cleanupCount; }
+
+    int GetInitCount() const { return m_initCount; }
+    int GetCleanupCount() const { return m_cleanupCount; }
+
+private:
+    int m_initCount;
+    int m_cleanupCount;
+};
+
+TEST(HashingUtilsTest, TestFactoryStaticStateIsInitializedOnFirstUse)
+{
+    auto factory = Aws::MakeShared<StaticStateCountingHashFactory>("HashingUtilsTest");
+    Aws::Utils::Crypto::CleanupCrypto();
+    Aws::Utils::Crypto::SetMD5Factory(factory);
+    Aws::Utils::Crypto::InitCrypto();
+    ASSERT_EQ(0, factory->GetInitCount());
+
+    ASSERT_EQ(nullptr, Aws::Utils::Crypto::CreateMD5Implementation());
+    ASSERT_EQ(nullptr, Aws::Utils::Crypto::CreateMD5Implementation());
+    ASSERT_EQ(1, factory->GetInitCount());
+
+    Aws::Utils::Crypto::CleanupCrypto();
+    ASSERT_EQ(1, factory->GetCleanupCount());
+    Aws::Utils::Crypto::InitCrypto();
+}
@@ -0,0 +1,70 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/external/gtest.h>
+#include <aws/core/utils/HdrHistogram.h>
+
+using namespace Aws::Utils;
+
+TEST(HdrHistogramTest, TestPercentilesKeepSignificantFigures)
+{
+    HdrHistogram histogram(3600LL * 1000 * 1000, 2);
+    ASSERT_EQ(0, histogram.GetValueAtPercentile(50.0));
+
+    //1 to 1,000,000: exact below 256, within 1% above.
+    for (int64_t value = 1; value <= 1000000; ++value)
+    {
+        histogram.Record(value);
+    }
+    ASSERT_EQ(1000000, histogram.GetTotalCount());
+    ASSERT_EQ(1, histogram.GetMin());
+    ASSERT_EQ(1000000, histogram.GetMax());
+    ASSERT_NEAR(500000.0, static_cast<double>(histogram.GetValueAtPercentile(50.0)), 5000.0);
+    ASSERT_NEAR(990000.0, static_cast<double>(histogram.GetValueAtPercentile(99.0)), 9900.0);
+    ASSERT_NEAR(999000.0, static_cast<double>(histogram.GetValueAtPercentile(99.9)), 9990.0);
+    ASSERT_EQ(1000000, histogram.GetValueAtPercentile(100.0));
+    ASSERT_NEAR(500000.0, histogram.GetMean(), 5000.0);
+
+    HdrHistogram small(1000, 2);
+    for (int64_t value = 0; value < 200; ++value)
+    {
+        small.Record(value);
+    }
+    ASSERT_EQ(99, small.GetValueAtPercentile(50.0));
+    ASSERT_EQ(197, small.GetValueAtPercentile(99.0));
+}
+
+TEST(HdrHistogramTest, TestAddClampAndReset)
+{
+    HdrHistogram first(1000, 2);
+    HdrHistogram second(1000, 2);
+    first.Record(10, 3);
+    second.Record(-5);
+    second.Record(5000);
+
+    first.Add(second);
+    ASSERT_EQ(5, first.GetTotalCount());
+    ASSERT_EQ(0, first.GetMin());
+    ASSERT_EQ(1000, first.GetMax());
+    ASSERT_EQ(10, first.GetValueAtPercentile(50.0));
+    ASSERT_EQ(1000, first.GetValueAtPercentile(100.0));
+
+    first.Reset();
+    ASSERT_EQ(0, first.GetTotalCount());
+    ASSERT_EQ(0, first.GetMax());
+    first.Record(7);
+    ASSERT_EQ(7, first.GetMin());
+    ASSERT_EQ(7, first.GetValueAtPercentile(99.9));
+}
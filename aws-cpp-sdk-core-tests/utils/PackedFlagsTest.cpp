@@ -0,0 +1,65 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/external/gtest.h>
+#include <aws/core/utils/PackedFlags.h>
+
+using namespace Aws::Utils;
+
+static_assert(sizeof(PackedFlags<1>) == 1, "up to 8 flags fit in a byte");
+static_assert(sizeof(PackedFlags<12>) == 2, "up to 16 flags fit in two bytes");
+static_assert(sizeof(PackedFlags<40>) == 8, "up to 64 flags fit in a word");
+static_assert(sizeof(PackedFlags<65>) == 16, "more flags take more words");
+
+TEST(PackedFlagsTest, TestSetAndClear)
+{
+    PackedFlags<40> flags;
+    ASSERT_FALSE(flags.Any());
+    for (size_t i = 0; i < flags.size(); ++i)
+    {
+        ASSERT_FALSE(flags[i]);
+    }
+
+    flags[0] = true;
+    flags[39] = true;
+    ASSERT_TRUE(flags.Any());
+    ASSERT_TRUE(flags[0]);
+    ASSERT_TRUE(flags[39]);
+    ASSERT_FALSE(flags[38]);
+
+    flags[38] = flags[39];
+    flags[0] = false;
+    const PackedFlags<40>& constFlags = flags;
+    ASSERT_FALSE(constFlags[0]);
+    ASSERT_TRUE(constFlags[38]);
+    ASSERT_TRUE(constFlags[39]);
+}
+
+TEST(PackedFlagsTest, TestInitializerAndMultipleWords)
+{
+    PackedFlags<130> flags { 1, 64, 129 };
+    ASSERT_TRUE(flags[1]);
+    ASSERT_TRUE(flags[64]);
+    ASSERT_TRUE(flags[129]);
+    ASSERT_FALSE(flags[0]);
+    ASSERT_FALSE(flags[63]);
+    ASSERT_FALSE(flags[65]);
+    ASSERT_FALSE(flags[128]);
+
+    PackedFlags<130> copy = flags;
+    copy[64] = false;
+    ASSERT_FALSE(copy[64]);
+    ASSERT_TRUE(flags[64]);
+}
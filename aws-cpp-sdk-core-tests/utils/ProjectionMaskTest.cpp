@@ -0,0 +1,73 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/external/gtest.h>
+#include <aws/core/utils/ProjectionMask.h>
+
+using namespace Aws::Utils;
+
+TEST(ProjectionMaskTest, TestEmptyMaskSelectsEverything)
+{
+    ProjectionMask mask;
+    ASSERT_TRUE(mask.SelectsAll());
+    ASSERT_TRUE(mask.Includes("Reservations"));
+    ASSERT_TRUE(mask.GetSubMask("Reservations").SelectsAll());
+
+    mask.AddPath("");
+    ASSERT_TRUE(mask.SelectsAll());
+}
+
+TEST(ProjectionMaskTest, TestNestedPaths)
+{
+    ProjectionMask mask { "Reservations.Instances.InstanceId", "Reservations.Instances.State", "NextToken" };
+    ASSERT_FALSE(mask.SelectsAll());
+    ASSERT_TRUE(mask.Includes("Reservations"));
+    ASSERT_TRUE(mask.Includes("NextToken"));
+    ASSERT_FALSE(mask.Includes("ResponseMetadata"));
+
+    ProjectionMask nextToken = mask.GetSubMask("NextToken");
+    ASSERT_TRUE(nextToken.SelectsAll());
+
+    ProjectionMask instances = mask.GetSubMask("Reservations").GetSubMask("Instances");
+    ASSERT_FALSE(instances.SelectsAll());
+    ASSERT_TRUE(instances.Includes("InstanceId"));
+    ASSERT_TRUE(instances.Includes("State"));
+    ASSERT_FALSE(instances.Includes("ImageId"));
+    ASSERT_TRUE(instances.GetSubMask("State").SelectsAll());
+
+    ProjectionMask unselected = mask.GetSubMask("ResponseMetadata");
+    ASSERT_FALSE(unselected.SelectsAll());
+    ASSERT_FALSE(unselected.Includes("RequestId"));
+
+    //unselected sub masks share their state, extending one leaves the others alone.
+    ProjectionMask otherUnselected = mask.GetSubMask("Marker");
+    unselected.AddPath("RequestId");
+    ASSERT_TRUE(unselected.Includes("RequestId"));
+    ASSERT_FALSE(otherUnselected.Includes("RequestId"));
+    ASSERT_FALSE(mask.GetSubMask("ResponseMetadata").Includes("RequestId"));
+}
+
+TEST(ProjectionMaskTest, TestShorterPathWidensSelection)
+{
+    ProjectionMask mask;
+    mask.AddPath("Contents.Key");
+    ProjectionMask contents = mask.GetSubMask("Contents");
+    ASSERT_FALSE(contents.Includes("Size"));
+
+    mask.AddPath("Contents").AddPath("Contents.ETag");
+    ASSERT_TRUE(mask.GetSubMask("Contents").SelectsAll());
+    //masks handed out before are not affected.
+    ASSERT_FALSE(contents.Includes("Size"));
+}
@@ -0,0 +1,60 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/external/gtest.h>
+#include <aws/core/utils/QueryStringBuilder.h>
+
+#include <climits>
+
+using namespace Aws::Utils;
+
+TEST(QueryStringBuilderTest, TestParameterTypes)
+{
+    QueryStringBuilder builder;
+    builder.AddParameter("Action", "SendMessage");
+    builder.AddParameter("MessageBody", Aws::String("a b&c=d"));
+    builder.AddParameter("DelaySeconds", 0);
+    builder.AddParameter("Offset", -42);
+    builder.AddParameter("Smallest", LLONG_MIN);
+    builder.AddParameter("Enabled", true);
+    builder.AddParameter("Value", 567894.0);
+    builder.AddParameter("Version", "2012-11-05");
+
+    ASSERT_EQ("Action=SendMessage&MessageBody=a%20b%26c%3Dd&DelaySeconds=0&Offset=-42&Smallest=-9223372036854775808"
+        "&Enabled=true&Value=567894&Version=2012-11-05", builder.GetQueryString());
+}
+
+TEST(QueryStringBuilderTest, TestNestedLocations)
+{
+    QueryStringBuilder builder;
+    builder.AddParameter("Namespace", "ns");
+    for (unsigned i = 1; i <= 2; ++i)
+    {
+        size_t metricMark = builder.PushLocation("MetricData.member.", i, "");
+        builder.AddParameter(".MetricName", "Latency");
+        size_t dimensionMark = builder.PushLocation(".Dimensions.member.", 1, "");
+        builder.AddParameter(".Name", "Host");
+        builder.PopLocation(dimensionMark);
+        builder.AddParameter(".Values.", 1, "", 0.5);
+        builder.PopLocation(metricMark);
+    }
+    builder.AddParameter("Version", "2010-08-01");
+
+    Aws::String queryString = builder.TakeQueryString();
+    ASSERT_EQ("Namespace=ns"
+        "&MetricData.member.1.MetricName=Latency&MetricData.member.1.Dimensions.member.1.Name=Host&MetricData.member.1.Values.1=0.5"
+        "&MetricData.member.2.MetricName=Latency&MetricData.member.2.Dimensions.member.1.Name=Host&MetricData.member.2.Values.1=0.5"
+        "&Version=2010-08-01", queryString);
+}
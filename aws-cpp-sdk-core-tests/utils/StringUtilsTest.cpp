@@ -243,6 +243,24 @@ TEST(StringUtilsTest, TestURLEncodeAndDecode)
     ASSERT_STREQ("IShouldNotChange", shouldBeTheSameAsEncoded.c_str());
 }
 
+TEST(StringUtilsTest, TestURLEncodeAllBytes)
+{
+    Aws::String allBytes;
+    for (int c = 1; c < 256; ++c)
+    {
+        allBytes.push_back(static_cast<char>(c));
+    }
+
+    Aws::String encoded = StringUtils::URLEncode(allBytes.c_str());
+    ASSERT_EQ(allBytes, StringUtils::URLDecode(encoded.c_str()));
+    ASSERT_EQ(Aws::String::npos, encoded.find_first_not_of("ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_.~%"));
+    ASSERT_EQ("%C3%A9t%C3%A9", StringUtils::URLEncode("\xC3\xA9t\xC3\xA9"));
+
+    Aws::String appended = "Key=";
+    StringUtils::URLEncodeAppend(appended, "a b\0c", 5);
+    ASSERT_EQ("Key=a%20b%00c", appended);
+}
+
 TEST(StringUtilsTest, TestInt64Conversion)
 {
     long long bigIntValue = LLONG_MAX - 1;
@@ -0,0 +1,83 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/external/gtest.h>
+#include <aws/core/utils/StringView.h>
+#include <aws/core/utils/StringUtils.h>
+#include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/http/URI.h>
+
+using namespace Aws::Utils;
+
+TEST(StringViewTest, TestViewsOfStringsAndBuffers)
+{
+    Aws::String owned = "Hello, World";
+    StringView ownedView = owned;
+    ASSERT_EQ(owned.data(), ownedView.data());
+    ASSERT_EQ(12u, ownedView.size());
+
+    StringView literalView = "Hello";
+    ASSERT_EQ(StringView("Hello, World", 5), literalView);
+    ASSERT_EQ(literalView, ownedView.substr(0, 5));
+    ASSERT_EQ(StringView("World"), ownedView.substr(7));
+    ASSERT_NE(literalView, ownedView);
+    ASSERT_TRUE(literalView < ownedView);
+    ASSERT_TRUE(StringView().empty());
+    ASSERT_TRUE(StringView(nullptr).empty());
+    ASSERT_EQ("Hello", literalView.ToString());
+
+    ownedView.remove_prefix(7);
+    ownedView.remove_suffix(1);
+    ASSERT_EQ(StringView("Worl"), ownedView);
+    ASSERT_EQ('W', ownedView.front());
+    ASSERT_EQ('l', ownedView.back());
+}
+
+TEST(StringViewTest, TestStringUtilsOverloads)
+{
+    const char buffer[] = "  MiXeD Case\t\nmore";
+    StringView view(buffer, 13);
+
+    ASSERT_EQ("  mixed case\t", StringUtils::ToLower(view));
+    ASSERT_EQ("  MIXED CASE\t", StringUtils::ToUpper(view));
+    ASSERT_EQ("MiXeD Case", StringUtils::Trim(view));
+    ASSERT_EQ("MiXeD Case\t", StringUtils::LTrim(view));
+    ASSERT_EQ("  MiXeD Case", StringUtils::RTrim(view));
+    ASSERT_EQ(StringView(buffer + 2, 10), StringUtils::TrimView(view));
+    ASSERT_TRUE(StringUtils::TrimView(StringView(" \t ")).empty());
+    ASSERT_TRUE(StringUtils::CaselessCompare(StringView(buffer + 2, 10), "mixed CASE"));
+    ASSERT_FALSE(StringUtils::CaselessCompare(StringView(buffer + 2, 10), "mixed CAS"));
+    ASSERT_EQ("%20%20MiXeD%20Case%09", StringUtils::URLEncode(view));
+}
+
+TEST(StringViewTest, TestCoreApisTakingViews)
+{
+    const char buffer[] = "valueXX";
+    Aws::Http::URI uri("http://www.amazon.com");
+    uri.AddQueryStringParameter("key", StringView(buffer, 5));
+    uri.AddQueryStringParameter("other key", Aws::String("a&b"));
+    uri.AddQueryStringParameter("literal", "x y");
+    ASSERT_EQ("?key=value&other%20key=a%26b&literal=x%20y", uri.GetQueryString());
+
+    Json::JsonValue json;
+    json.WithString("key", StringView(buffer, 5)).WithString("empty", StringView());
+    json.WithString("literal", "text").WithString(Aws::String("string"), Aws::String("owned"));
+    ASSERT_EQ("value", json.View().GetString("key"));
+    ASSERT_EQ("", json.View().GetString("empty"));
+    ASSERT_EQ("text", json.View().GetString("literal"));
+    ASSERT_EQ("owned", json.View().GetString("string"));
+    ASSERT_EQ("\"value\"", Json::JsonValue().AsString(StringView(buffer, 5)).View().WriteCompact());
+    ASSERT_EQ("\"text\"", Json::JsonValue().AsString("text").View().WriteCompact());
+}
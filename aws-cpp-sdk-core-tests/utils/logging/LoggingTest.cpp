@@ -18,11 +18,18 @@
 #include <aws/external/gtest.h>
 
 #include <aws/core/utils/logging/DefaultLogSystem.h>
+#include <aws/core/utils/logging/RingBufferLogSystem.h>
+#include <aws/core/utils/logging/BinaryLogSystem.h>
 #include <aws/core/utils/logging/LogMacros.h>
 #include <aws/core/utils/memory/AWSMemory.h>
 #include <aws/core/utils/StringUtils.h>
+#include <aws/core/utils/DateTime.h>
+#include <aws/core/platform/FileSystem.h>
+#include <aws/testing/Benchmark.h>
 
 #include <thread>
+#include <condition_variable>
+#include <sstream>
 
 using namespace Aws::Utils;
 using namespace Aws::Utils::Logging;
@@ -96,12 +103,13 @@ void VerifyAllLogsAtOrBelow(LogLevel logLevel, const Aws::String& tag, const Aws
     }
 }
 
+template<typename LogSystemType = DefaultLogSystem>
 void DoLogTest(LogLevel logLevel, const char *testTag)
 {
     auto ss = Aws::MakeShared<Aws::StringStream>(AllocationTag);
 
     {
-        ScopedLogger loggingScope(Aws::MakeShared<DefaultLogSystem>(AllocationTag, logLevel, ss));
+        ScopedLogger loggingScope(Aws::MakeShared<LogSystemType>(AllocationTag, logLevel, ss));
 
         LogAllPossibilities(testTag);
     }
@@ -139,3 +147,341 @@ TEST(LoggingTest, testTraceLogLevel)
 {
     DoLogTest(LogLevel::Trace, "LoggingTest_testTraceLogLevel");    
 }
+
+TEST(LoggingTest, testRingBufferLogSystem)
+{
+    DoLogTest<RingBufferLogSystem>(LogLevel::Trace, "LoggingTest_testRingBufferLogSystem");
+}
+
+//holds up the logging thread in its first write until it is opened.
+class GatedStreamBuf : public std::stringbuf
+{
+public:
+    GatedStreamBuf() : m_entered(false), m_open(false) {}
+
+    void WaitUntilEntered()
+    {
+        std::unique_lock<std::mutex> locker(m_lock);
+        m_signal.wait(locker, [this]() { return m_entered; });
+    }
+
+    void Open()
+    {
+        std::lock_guard<std::mutex> locker(m_lock);
+        m_open = true;
+        m_signal.notify_all();
+    }
+
+protected:
+    std::streamsize xsputn(const char* s, std::streamsize n) override
+    {
+        {
+            std::unique_lock<std::mutex> locker(m_lock);
+            m_entered = true;
+            m_signal.notify_all();
+            m_signal.wait(locker, [this]() { return m_open; });
+        }
+        return std::stringbuf::xsputn(s, n);
+    }
+
+private:
+    std::mutex m_lock;
+    std::condition_variable m_signal;
+    bool m_entered;
+    bool m_open;
+};
+
+TEST(LoggingTest, testRingBufferDropsWhenFull)
+{
+    GatedStreamBuf streamBuf;
+    auto stream = Aws::MakeShared<Aws::OStream>(AllocationTag, &streamBuf);
+    {
+        RingBufferLogSystem logSystem(LogLevel::Info, stream, 2, LogOverflowPolicy::Drop);
+        logSystem.Log(LogLevel::Info, "tag", "taken by the logging thread");
+        streamBuf.WaitUntilEntered();
+
+        for (int i = 0; i < 12; ++i)
+        {
+            logSystem.Log(LogLevel::Info, "tag", "message %d", i);
+        }
+        ASSERT_EQ(10u, logSystem.GetDroppedMessageCount());
+        streamBuf.Open();
+    }
+
+    Aws::String output = streamBuf.str().c_str();
+    ASSERT_NE(Aws::String::npos, output.find("message 1\n"));
+    ASSERT_EQ(Aws::String::npos, output.find("message 2\n"));
+    ASSERT_NE(Aws::String::npos, output.find("10 log messages were dropped"));
+}
+
+TEST(LoggingTest, testRingBufferBlocksWhenFull)
+{
+    GatedStreamBuf streamBuf;
+    auto stream = Aws::MakeShared<Aws::OStream>(AllocationTag, &streamBuf);
+    {
+        RingBufferLogSystem logSystem(LogLevel::Info, stream, 2, LogOverflowPolicy::Block);
+        logSystem.Log(LogLevel::Info, "tag", "taken by the logging thread");
+        streamBuf.WaitUntilEntered();
+
+        std::thread producer([&logSystem]()
+        {
+            for (int i = 0; i < 12; ++i)
+            {
+                logSystem.Log(LogLevel::Info, "tag", "message %d", i);
+            }
+        });
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        streamBuf.Open();
+        producer.join();
+        ASSERT_EQ(0u, logSystem.GetDroppedMessageCount());
+    }
+
+    Aws::String output = streamBuf.str().c_str();
+    for (int i = 0; i < 12; ++i)
+    {
+        ASSERT_NE(Aws::String::npos, output.find("message " + StringUtils::to_string(i) + "\n"));
+    }
+}
+
+namespace
+{
+    static const int MESSAGES_PER_THREAD = 20000;
+
+    void RecordDroppedMessages(const DefaultLogSystem&, const Aws::String&)
+    {
+    }
+
+    //a message dropped costs its thread less than one written, so the time alone flatters the drop policy.
+    void RecordDroppedMessages(const RingBufferLogSystem& logSystem, const Aws::String& name)
+    {
+        ::testing::Test::RecordProperty(("Dropped" + name).c_str(), static_cast<int>(logSystem.GetDroppedMessageCount()));
+    }
+
+    //logs from threadCount threads into a log file and records the ns each message took on the thread that logged it.
+    template<typename LogSystemType, typename... Args>
+    void RunLoggingLoad(size_t threadCount, const Aws::String& name, Args... args)
+    {
+        Aws::String filenamePrefix = Aws::FileSystem::CreateTempFilePath();
+        {
+            LogSystemType logSystem(LogLevel::Debug, filenamePrefix, args...);
+            Aws::Vector<std::thread> threads;
+            Aws::Testing::BenchmarkTimer timer;
+            for (size_t thread = 0; thread < threadCount; ++thread)
+            {
+                threads.emplace_back([&logSystem]()
+                {
+                    for (int i = 0; i < MESSAGES_PER_THREAD; ++i)
+                    {
+                        logSystem.Log(LogLevel::Debug, "LoggingTest", "benchmark message %d of %d", i, MESSAGES_PER_THREAD);
+                    }
+                });
+            }
+            for (auto& thread : threads)
+            {
+                thread.join();
+            }
+            timer.RecordNanosPerOperation(name.c_str(), static_cast<long long>(threadCount) * MESSAGES_PER_THREAD);
+            RecordDroppedMessages(logSystem, name);
+        }
+        Aws::FileSystem::RemoveFileIfExists((filenamePrefix + DateTime::CalculateGmtTimestampAsString("%Y-%m-%d-%H") + ".log").c_str());
+    }
+}
+
+//Run with --gtest_also_run_disabled_tests. Records ns per debug message for DefaultLogSystem and RingBufferLogSystem
+//at several thread counts.
+TEST(LoggingTest, DISABLED_BenchmarkRingBufferAgainstDefault)
+{
+    const size_t threadCounts[] = { 1, 8, 32 };
+    for (size_t threadCount : threadCounts)
+    {
+        Aws::String threads = StringUtils::to_string(threadCount) + "Threads";
+        RunLoggingLoad<DefaultLogSystem>(threadCount, "DefaultNs" + threads);
+        RunLoggingLoad<RingBufferLogSystem>(threadCount, "RingBlockNs" + threads, static_cast<size_t>(8192), LogOverflowPolicy::Block);
+        RunLoggingLoad<RingBufferLogSystem>(threadCount, "RingDropNs" + threads, static_cast<size_t>(8192), LogOverflowPolicy::Drop);
+    }
+}
+
+static Aws::Vector<Aws::String> DecodeBinaryLog(const Aws::StringStream& log)
+{
+    Aws::StringStream input(log.str());
+    Aws::StringStream output;
+    EXPECT_TRUE(BinaryLogDecoder::Decode(input, output));
+    return StringUtils::SplitOnLine(output.str());
+}
+
+//what follows "[LEVEL] date time tag [thread] ".
+static Aws::String GetMessage(const Aws::String& line)
+{
+    return line.substr(line.find("] ", line.find(" [")) + 2);
+}
+
+TEST(LoggingTest, testBinaryLogSystem)
+{
+    auto ss = Aws::MakeShared<Aws::StringStream>(AllocationTag);
+    {
+        ScopedLogger loggingScope(Aws::MakeShared<BinaryLogSystem>(AllocationTag, LogLevel::Debug, ss));
+        LogAllPossibilities("LoggingTest_testBinaryLogSystem");
+    }
+
+    VerifyAllLogsAtOrBelow(LogLevel::Debug, "LoggingTest_testBinaryLogSystem", DecodeBinaryLog(*ss));
+}
+
+TEST(LoggingTest, testBinaryLogSystemFormatsArguments)
+{
+    auto ss = Aws::MakeShared<Aws::StringStream>(AllocationTag);
+    {
+        BinaryLogSystem logSystem(LogLevel::Info, ss);
+        logSystem.Log(LogLevel::Info, "tag", "%d %u %ld %lld %zu %x %c %%", -1, 2u, -3L, 4LL, static_cast<size_t>(5), 255u, 'z');
+        logSystem.Log(LogLevel::Info, "tag", "[%5.2f] [%-*d] [%.*s] [%s]", 3.14159, 4, 7, 3, "abcdef", static_cast<const char*>(nullptr));
+        logSystem.Log(LogLevel::Info, "tag", "%2$s %1$s", "world", "hello");
+        logSystem.Log(LogLevel::Warn, "other tag", "%s", Aws::String(3000, 'x').c_str());
+    }
+
+    Aws::Vector<Aws::String> lines = DecodeBinaryLog(*ss);
+    ASSERT_EQ(4u, lines.size());
+    ASSERT_EQ("-1 2 -3 4 5 ff z %", GetMessage(lines[0]));
+    ASSERT_EQ("[ 3.14] [7   ] [abc] [(null)]", GetMessage(lines[1]));
+    //positional arguments are formatted right away.
+    ASSERT_EQ("hello world", GetMessage(lines[2]));
+    ASSERT_EQ(0u, lines[3].find("[WARN] "));
+    ASSERT_NE(Aws::String::npos, lines[3].find(" other tag ["));
+    //long strings are cut short.
+    ASSERT_EQ(Aws::String(2044, 'x'), GetMessage(lines[3]));
+}
+
+TEST(LoggingTest, testBinaryLogSystemKeepsMessagesOfExitedThreads)
+{
+    static const int THREAD_COUNT = 4;
+    static const int MESSAGE_COUNT = 500;
+
+    auto ss = Aws::MakeShared<Aws::StringStream>(AllocationTag);
+    uint64_t dropped = 0;
+    {
+        BinaryLogSystem logSystem(LogLevel::Info, ss, 16 * 1024);
+        Aws::Vector<std::thread> threads;
+        for (int i = 0; i < THREAD_COUNT; ++i)
+        {
+            threads.emplace_back([&logSystem, i]()
+            {
+                for (int j = 0; j < MESSAGE_COUNT; ++j)
+                {
+                    Aws::OStringStream message;
+                    message << "thread " << i << " message " << j << " " << Aws::String(200, '.');
+                    logSystem.LogStream(LogLevel::Info, "tag", message);
+                }
+            });
+        }
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+        dropped = logSystem.GetDroppedMessageCount();
+    }
+
+    Aws::Vector<Aws::String> lines = DecodeBinaryLog(*ss);
+    uint64_t messages = 0;
+    uint64_t reportedDropped = 0;
+    for (const auto& line : lines)
+    {
+        size_t countEnd = line.find(" log messages were dropped");
+        if (countEnd != Aws::String::npos)
+        {
+            size_t countBegin = line.rfind(' ', countEnd - 1) + 1;
+            reportedDropped += StringUtils::ConvertToInt64(line.substr(countBegin, countEnd - countBegin).c_str());
+        }
+        else
+        {
+            ++messages;
+        }
+    }
+    ASSERT_EQ(dropped, reportedDropped);
+    ASSERT_EQ(static_cast<uint64_t>(THREAD_COUNT * MESSAGE_COUNT), messages + dropped);
+}
+
+TEST(LoggingTest, testBinaryLogDecoderRejectsOtherInput)
+{
+    Aws::StringStream input("[INFO] 2017-01-01 00:00:00 tag [1] not a binary log\n");
+    Aws::StringStream output;
+    ASSERT_FALSE(BinaryLogDecoder::Decode(input, output));
+    ASSERT_TRUE(output.str().empty());
+}
+
+template<typename T>
+static void Append(Aws::String& log, T value)
+{
+    log.append(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+//the file header and the header of an entry, as BinaryLogSystem writes them.
+static Aws::String MakeBinaryLogEntry(uint32_t type, uint32_t length)
+{
+    Aws::String log("AWSBLOG\x01", 8);
+    Append<uint32_t>(log, 0x01020304);
+    Append<uint32_t>(log, 0);
+    Append<uint32_t>(log, type);
+    Append<uint32_t>(log, length);
+    return log;
+}
+
+TEST(LoggingTest, testBinaryLogDecoderRejectsCorruptLengths)
+{
+    //an entry that claims more than the log holds.
+    Aws::StringStream truncated(MakeBinaryLogEntry(3, 0xFFFFFFF0) + Aws::String(16, '\0'));
+    Aws::StringStream output;
+    ASSERT_FALSE(BinaryLogDecoder::Decode(truncated, output));
+
+    //a text record whose inline tag runs past its end.
+    Aws::String log = MakeBinaryLogEntry(3, 8 + 24);
+    Append<uint32_t>(log, 0);
+    Append<uint32_t>(log, 0);
+    Append<uint32_t>(log, 24);
+    Append<uint8_t>(log, 2);
+    Append<uint8_t>(log, static_cast<uint8_t>(LogLevel::Info));
+    Append<uint16_t>(log, 1000);
+    Append<uint32_t>(log, 0);
+    Append<uint32_t>(log, 0);
+    Append<int64_t>(log, 0);
+    Aws::StringStream corrupt(log);
+    ASSERT_FALSE(BinaryLogDecoder::Decode(corrupt, output));
+    ASSERT_TRUE(output.str().empty());
+}
+
+TEST(LoggingTest, testTagLogLevels)
+{
+    auto ss = Aws::MakeShared<Aws::StringStream>(AllocationTag);
+    {
+        ScopedLogger loggingScope(Aws::MakeShared<DefaultLogSystem>(AllocationTag, LogLevel::Warn, ss));
+        SetLogLevelForTag("traced", LogLevel::Trace);
+        SetLogLevelForTag("quiet", LogLevel::Error);
+
+        AWS_LOG_TRACE("traced", "traced trace");
+        AWS_LOGSTREAM_DEBUG("traced", "traced " << "debug");
+        AWS_LOG_INFO("other", "other info");
+        AWS_LOG_WARN("other", "other warn");
+        AWS_LOGSTREAM_WARN("quiet", "quiet " << "warn");
+        AWS_LOG_ERROR("quiet", "quiet error");
+
+        //a tag kept elsewhere than in a literal is recognized by its text.
+        Aws::String tracedCopy("traced");
+        AWS_LOG_TRACE(tracedCopy.c_str(), "traced copy trace");
+
+        ResetLogLevelForTag("traced");
+        AWS_LOG_TRACE("traced", "traced trace after reset");
+        AWS_LOG_WARN("quiet", "quiet warn still");
+
+        ResetTagLogLevels();
+        AWS_LOG_WARN("quiet", "quiet warn after reset");
+    }
+
+    Aws::String output = ss->str();
+    ASSERT_NE(Aws::String::npos, output.find("traced trace\n"));
+    ASSERT_NE(Aws::String::npos, output.find("traced debug\n"));
+    ASSERT_EQ(Aws::String::npos, output.find("other info"));
+    ASSERT_NE(Aws::String::npos, output.find("other warn\n"));
+    ASSERT_EQ(Aws::String::npos, output.find("quiet warn\n"));
+    ASSERT_NE(Aws::String::npos, output.find("quiet error\n"));
+    ASSERT_NE(Aws::String::npos, output.find("traced copy trace\n"));
+    ASSERT_EQ(Aws::String::npos, output.find("traced trace after reset"));
+    ASSERT_EQ(Aws::String::npos, output.find("quiet warn still"));
+    ASSERT_NE(Aws::String::npos, output.find("quiet warn after reset\n"));
+}
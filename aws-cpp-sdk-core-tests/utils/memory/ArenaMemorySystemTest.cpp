@@ -0,0 +1,149 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/external/gtest.h>
+#include <aws/core/utils/memory/ArenaMemorySystem.h>
+#include <aws/core/utils/memory/AWSMemory.h>
+#include <aws/core/utils/memory/stl/AWSString.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+
+#include <thread>
+
+using namespace Aws::Utils::Memory;
+
+static const char* ALLOCATION_TAG = "ArenaMemorySystemTest";
+
+TEST(ArenaMemorySystemTest, TestScopeWithoutArenaSystemIsHarmless)
+{
+    ArenaScope scope;
+    void* memory = Aws::Malloc(ALLOCATION_TAG, 64);
+    ASSERT_NE(nullptr, memory);
+    Aws::Free(memory);
+}
+
+#ifdef USE_AWS_MEMORY_MANAGEMENT
+
+namespace
+{
+    //installs an arena system over whatever memory system the tests run with for the lifetime of a test.
+    class ArenaMemorySystemInstaller
+    {
+    public:
+        ArenaMemorySystemInstaller(std::size_t blockSize, std::size_t blockCount) :
+            m_previous(GetMemorySystem()), m_arenaSystem(blockSize, blockCount, m_previous)
+        {
+            InitializeAWSMemorySystem(m_arenaSystem);
+        }
+
+        ~ArenaMemorySystemInstaller()
+        {
+            if (m_previous)
+            {
+                InitializeAWSMemorySystem(*m_previous);
+            }
+            else
+            {
+                ShutdownAWSMemorySystem();
+            }
+        }
+
+        ArenaMemorySystem& GetArenaSystem() { return m_arenaSystem; }
+
+    private:
+        MemorySystemInterface* m_previous;
+        ArenaMemorySystem m_arenaSystem;
+    };
+
+    const Aws::String LONG_STRING(200, 'a');
+}
+
+TEST(ArenaMemorySystemTest, TestScopeServesSmallAllocations)
+{
+    ArenaMemorySystemInstaller installer(4096, 8);
+    ArenaMemorySystem& arenaSystem = installer.GetArenaSystem();
+
+    void* outsideScope = Aws::Malloc(ALLOCATION_TAG, 64);
+    ASSERT_EQ(0u, arenaSystem.GetArenaAllocationCount());
+    {
+        ArenaScope scope;
+        ASSERT_EQ(1u, arenaSystem.GetLiveArenaCount());
+
+        Aws::Vector<Aws::String> strings;
+        for (int i = 0; i < 50; ++i)
+        {
+            strings.push_back(LONG_STRING);
+        }
+        ASSERT_LT(50u, arenaSystem.GetArenaAllocationCount());
+
+        std::size_t arenaAllocations = arenaSystem.GetArenaAllocationCount();
+        void* large = Aws::Malloc(ALLOCATION_TAG, 2048);
+        {
+            HeapScope heapScope;
+            Aws::String cached(LONG_STRING);
+        }
+        ASSERT_EQ(arenaAllocations, arenaSystem.GetArenaAllocationCount());
+        Aws::Free(large);
+    }
+    ASSERT_EQ(0u, arenaSystem.GetLiveArenaCount());
+    Aws::Free(outsideScope);
+}
+
+TEST(ArenaMemorySystemTest, TestMemoryOutlivingItsScope)
+{
+    ArenaMemorySystemInstaller installer(4096, 8);
+    ArenaMemorySystem& arenaSystem = installer.GetArenaSystem();
+
+    Aws::String escaped;
+    {
+        ArenaScope scope;
+        Aws::String local(LONG_STRING);
+        {
+            ArenaScope nestedScope;
+            ASSERT_EQ(2u, arenaSystem.GetLiveArenaCount());
+            escaped = LONG_STRING + "b";
+        }
+        ASSERT_EQ(2u, arenaSystem.GetLiveArenaCount());
+    }
+    ASSERT_EQ(1u, arenaSystem.GetLiveArenaCount());
+    ASSERT_EQ(LONG_STRING + "b", escaped);
+
+    //the last reference may as well go away on another thread.
+    std::thread([&escaped]() { Aws::String().swap(escaped); }).join();
+    ASSERT_EQ(0u, arenaSystem.GetLiveArenaCount());
+}
+
+TEST(ArenaMemorySystemTest, TestFallsBackToHeapWhenSlabIsExhausted)
+{
+    ArenaMemorySystemInstaller installer(1024, 2);
+    ArenaMemorySystem& arenaSystem = installer.GetArenaSystem();
+
+    for (int round = 0; round < 3; ++round)
+    {
+        ArenaScope scope;
+        Aws::Vector<Aws::String> strings;
+        for (int i = 0; i < 100; ++i)
+        {
+            strings.push_back(LONG_STRING);
+        }
+        for (const auto& item : strings)
+        {
+            ASSERT_EQ(LONG_STRING, item);
+        }
+    }
+    ASSERT_LT(0u, arenaSystem.GetArenaAllocationCount());
+    ASSERT_EQ(0u, arenaSystem.GetLiveArenaCount());
+}
+
+#endif // USE_AWS_MEMORY_MANAGEMENT
@@ -0,0 +1,240 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/external/gtest.h>
+#include <aws/core/utils/memory/PooledMemorySystem.h>
+#include <aws/core/utils/memory/AWSMemory.h>
+#include <aws/testing/Benchmark.h>
+
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace Aws::Utils::Memory;
+
+TEST(PooledMemorySystemTest, TestBlocksAreReused)
+{
+    //whatever the tests run with checks that every chunk is given back.
+    PooledMemorySystem pool(64 * 1024, GetMemorySystem());
+
+    void* first = pool.AllocateMemory(24, 16);
+    ASSERT_EQ(0u, reinterpret_cast<uintptr_t>(first) % alignof(max_align_t));
+    memset(first, 0xAB, 24);
+    pool.FreeMemory(first);
+    ASSERT_EQ(first, pool.AllocateMemory(20, 16));
+    ASSERT_NE(first, pool.AllocateMemory(24, 16));
+
+    std::vector<void*> blocks;
+    for (std::size_t size = 0; size <= PooledMemorySystem::MAX_POOLED_SIZE; size += 7)
+    {
+        void* block = pool.AllocateMemory(size, 16);
+        memset(block, 0xCD, size);
+        blocks.push_back(block);
+    }
+    std::size_t chunkBytes = pool.GetChunkBytes();
+
+    void* large = pool.AllocateMemory(PooledMemorySystem::MAX_POOLED_SIZE + 1, 16);
+    memset(large, 0xEF, PooledMemorySystem::MAX_POOLED_SIZE + 1);
+    pool.FreeMemory(large);
+    ASSERT_EQ(chunkBytes, pool.GetChunkBytes());
+
+    for (void* block : blocks)
+    {
+        pool.FreeMemory(block);
+    }
+    for (std::size_t size = 0; size <= PooledMemorySystem::MAX_POOLED_SIZE; size += 7)
+    {
+        blocks.push_back(pool.AllocateMemory(size, 16));
+    }
+    ASSERT_EQ(chunkBytes, pool.GetChunkBytes());
+}
+
+TEST(PooledMemorySystemTest, TestCrossThreadFreesReturnToOwner)
+{
+    PooledMemorySystem pool;
+    std::vector<void*> blocks;
+
+    std::thread producer([&pool, &blocks]()
+    {
+        for (int i = 0; i < 1000; ++i)
+        {
+            blocks.push_back(pool.AllocateMemory(48, 16));
+        }
+    });
+    producer.join();
+    std::size_t chunkBytes = pool.GetChunkBytes();
+
+    std::thread consumer([&pool, &blocks]()
+    {
+        for (void* block : blocks)
+        {
+            pool.FreeMemory(block);
+        }
+    });
+    consumer.join();
+    blocks.clear();
+
+    //the producer's cache went to the next thread that asked for one, remote frees included.
+    std::thread second([&pool, &blocks]()
+    {
+        for (int i = 0; i < 1000; ++i)
+        {
+            blocks.push_back(pool.AllocateMemory(48, 16));
+        }
+        for (void* block : blocks)
+        {
+            pool.FreeMemory(block);
+        }
+    });
+    second.join();
+
+    ASSERT_EQ(chunkBytes, pool.GetChunkBytes());
+    ASSERT_EQ(1u, pool.GetThreadCacheCount());
+}
+
+TEST(PooledMemorySystemTest, TestConcurrentAllocation)
+{
+    PooledMemorySystem pool;
+    std::thread workers[4];
+    for (auto& worker : workers)
+    {
+        worker = std::thread([&pool]()
+        {
+            std::vector<char*> blocks;
+            for (int i = 0; i < 10000; ++i)
+            {
+                std::size_t size = 8 + (i * 37) % 600;
+                char* block = static_cast<char*>(pool.AllocateMemory(size, 16));
+                block[0] = static_cast<char>(size);
+                block[size - 1] = static_cast<char>(size);
+                blocks.push_back(block);
+                if (blocks.size() > 64)
+                {
+                    pool.FreeMemory(blocks.front());
+                    blocks.erase(blocks.begin());
+                }
+            }
+            for (char* block : blocks)
+            {
+                pool.FreeMemory(block);
+            }
+        });
+    }
+    for (auto& worker : workers)
+    {
+        worker.join();
+    }
+    //threads that are done early hand their cache to the ones started after them.
+    ASSERT_LE(1u, pool.GetThreadCacheCount());
+    ASSERT_GE(4u, pool.GetThreadCacheCount());
+}
+
+namespace
+{
+    class MallocMemorySystem : public MemorySystemInterface
+    {
+    public:
+        void Begin() override {}
+        void End() override {}
+        void* AllocateMemory(std::size_t blockSize, std::size_t, const char*) override { return malloc(blockSize); }
+        void FreeMemory(void* memoryPtr) override { free(memoryPtr); }
+    };
+
+    static const int REQUESTS_PER_THREAD = 20000;
+    static const int ALLOCATIONS_PER_REQUEST = 40;
+
+    //Each request allocates what a small call does: header strings and map nodes, a few body buffers and now and
+    //then a large response buffer, frees it all at the end and hands one small block to the next thread to free.
+    void RunRequestLoad(MemorySystemInterface& memorySystem, std::size_t threadCount, const std::string& name)
+    {
+        std::vector<std::vector<void*>> handoffs(threadCount);
+        for (auto& handoff : handoffs)
+        {
+            handoff.reserve(REQUESTS_PER_THREAD);
+        }
+        std::vector<std::thread> workers;
+        Aws::Testing::BenchmarkTimer timer;
+        for (std::size_t thread = 0; thread < threadCount; ++thread)
+        {
+            workers.emplace_back([&memorySystem, &handoffs, thread]()
+            {
+                void* blocks[ALLOCATIONS_PER_REQUEST];
+                std::vector<void*>& handoff = handoffs[thread];
+                for (int request = 0; request < REQUESTS_PER_THREAD; ++request)
+                {
+                    for (int i = 0; i < ALLOCATIONS_PER_REQUEST; ++i)
+                    {
+                        std::size_t size = i % 10 == 9 ? 256 + (request * 131 + i) % 3840 : 16 + (request * 37 + i * 11) % 112;
+                        if (i == 0 && request % 16 == 0)
+                        {
+                            size = 16 * 1024;
+                        }
+                        char* block = static_cast<char*>(memorySystem.AllocateMemory(size, 16));
+                        block[0] = block[size - 1] = static_cast<char>(i);
+                        blocks[i] = block;
+                    }
+                    //a small block, like the string or shared state a request leaves behind for another thread.
+                    handoff.push_back(blocks[1]);
+                    blocks[1] = nullptr;
+                    for (void* block : blocks)
+                    {
+                        if (block)
+                        {
+                            memorySystem.FreeMemory(block);
+                        }
+                    }
+                }
+            });
+        }
+        for (auto& worker : workers)
+        {
+            worker.join();
+        }
+        //the handed off blocks are freed by a different thread than the one that allocated them.
+        workers.clear();
+        for (std::size_t thread = 0; thread < threadCount; ++thread)
+        {
+            workers.emplace_back([&memorySystem, &handoffs, thread, threadCount]()
+            {
+                for (void* block : handoffs[(thread + 1) % threadCount])
+                {
+                    memorySystem.FreeMemory(block);
+                }
+            });
+        }
+        for (auto& worker : workers)
+        {
+            worker.join();
+        }
+        timer.RecordNanosPerOperation(name.c_str(), static_cast<long long>(threadCount) * REQUESTS_PER_THREAD * ALLOCATIONS_PER_REQUEST);
+    }
+}
+
+//Run with --gtest_also_run_disabled_tests. Records ns per allocate/free pair for the pool and for malloc at
+//several thread counts.
+TEST(PooledMemorySystemTest, DISABLED_BenchmarkRequestLoadAgainstMalloc)
+{
+    const std::size_t threadCounts[] = { 1, 4, 16 };
+    for (std::size_t threadCount : threadCounts)
+    {
+        MallocMemorySystem mallocSystem;
+        RunRequestLoad(mallocSystem, threadCount, "MallocNs" + std::to_string(threadCount) + "Threads");
+
+        PooledMemorySystem pool;
+        RunRequestLoad(pool, threadCount, "PooledNs" + std::to_string(threadCount) + "Threads");
+    }
+}
@@ -0,0 +1,125 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/external/gtest.h>
+#include <aws/core/utils/memory/TagProfilingMemorySystem.h>
+#include <aws/core/utils/memory/stl/AWSStringStream.h>
+
+#include <thread>
+
+using namespace Aws::Utils::Memory;
+
+static const TagAllocationStatistics* FindStatistics(const Aws::Vector<TagAllocationStatistics>& snapshot, const char* tag)
+{
+    for (const auto& statistics : snapshot)
+    {
+        if (statistics.tag == tag)
+        {
+            return &statistics;
+        }
+    }
+    return nullptr;
+}
+
+TEST(TagProfilingMemorySystemTest, TestPerTagStatistics)
+{
+    TagProfilingMemorySystem profiler;
+
+    void* first = profiler.AllocateMemory(100, 16, "Buffers");
+    void* second = profiler.AllocateMemory(300, 16, "Buffers");
+    void* parser = profiler.AllocateMemory(40, 16, "JsonParser");
+    void* untagged = profiler.AllocateMemory(8, 16);
+    ASSERT_EQ(0u, reinterpret_cast<uintptr_t>(first) % alignof(max_align_t));
+    profiler.FreeMemory(first);
+
+    auto snapshot = profiler.GetSnapshot();
+    ASSERT_EQ(3u, snapshot.size());
+    ASSERT_EQ("Buffers", snapshot[0].tag);
+
+    const TagAllocationStatistics* buffers = FindStatistics(snapshot, "Buffers");
+    ASSERT_NE(nullptr, buffers);
+    ASSERT_EQ(300u, buffers->liveBytes);
+    ASSERT_EQ(400u, buffers->peakBytes);
+    ASSERT_EQ(1u, buffers->liveAllocations);
+    ASSERT_EQ(2u, buffers->totalAllocations);
+    ASSERT_EQ(400u, buffers->totalBytes);
+    ASSERT_NE(nullptr, FindStatistics(snapshot, "(untagged)"));
+
+    profiler.FreeMemory(second);
+    profiler.FreeMemory(parser);
+    profiler.FreeMemory(untagged);
+
+    snapshot = profiler.GetSnapshot();
+    buffers = FindStatistics(snapshot, "Buffers");
+    ASSERT_EQ(0u, buffers->liveBytes);
+    ASSERT_EQ(400u, buffers->peakBytes);
+    ASSERT_EQ(0u, buffers->liveAllocations);
+}
+
+TEST(TagProfilingMemorySystemTest, TestTagsAreAggregatedByContent)
+{
+    TagProfilingMemorySystem profiler;
+    char firstCopy[] = "SharedTag";
+    char secondCopy[] = "SharedTag";
+
+    void* first = profiler.AllocateMemory(10, 16, firstCopy);
+    void* second = profiler.AllocateMemory(20, 16, secondCopy);
+
+    auto snapshot = profiler.GetSnapshot();
+    ASSERT_EQ(1u, snapshot.size());
+    ASSERT_EQ(30u, snapshot[0].liveBytes);
+
+    profiler.FreeMemory(second);
+    profiler.FreeMemory(first);
+}
+
+TEST(TagProfilingMemorySystemTest, TestOverflowAndThreads)
+{
+    TagProfilingMemorySystem profiler(1);
+    const char* tags[] = { "FirstTag", "SecondTag" };
+
+    std::thread workers[4];
+    for (int i = 0; i < 4; ++i)
+    {
+        workers[i] = std::thread([&profiler, &tags, i]()
+        {
+            for (int j = 0; j < 1000; ++j)
+            {
+                profiler.FreeMemory(profiler.AllocateMemory(16, 16, tags[(i + j) % 2]));
+            }
+        });
+    }
+    for (auto& worker : workers)
+    {
+        worker.join();
+    }
+
+    auto snapshot = profiler.GetSnapshot();
+    ASSERT_EQ(2u, snapshot.size());
+    uint64_t totalAllocations = 0;
+    for (const auto& statistics : snapshot)
+    {
+        ASSERT_EQ(0u, statistics.liveBytes);
+        ASSERT_EQ(2000u, statistics.totalAllocations);
+        totalAllocations += statistics.totalAllocations;
+    }
+    ASSERT_EQ(4000u, totalAllocations);
+    ASSERT_NE(nullptr, FindStatistics(snapshot, "(overflow)"));
+
+    Aws::StringStream dump;
+    profiler.Dump(dump);
+    ASSERT_NE(Aws::String::npos, dump.str().find("(overflow)"));
+    ASSERT_NE(Aws::String::npos, dump.str().find("Total"));
+}
@@ -0,0 +1,120 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/external/gtest.h>
+
+#include <aws/core/utils/xml/XmlListView.h>
+#include <aws/core/utils/memory/AWSMemory.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+
+using namespace Aws::Utils::Xml;
+
+static const char* ALLOCATION_TAG = "XmlListViewTest";
+
+namespace
+{
+    struct TestObject
+    {
+        TestObject(const XmlNode& node) : key(node.FirstChild("Key").GetText()) {}
+
+        Aws::String key;
+    };
+
+    std::shared_ptr<const XmlDocument> CreateDocument(const char* xml)
+    {
+        return Aws::MakeShared<XmlDocument>(ALLOCATION_TAG, XmlDocument::CreateFromXmlString(xml));
+    }
+}
+
+TEST(XmlListViewTest, TestIteratesMatchingSiblings)
+{
+    auto document = CreateDocument("<ListBucketResult><Name>bucket</Name>"
+        "<Contents><Key>a</Key></Contents>"
+        "<Contents><Key>b</Key></Contents>"
+        "<CommonPrefixes><Prefix>p</Prefix></CommonPrefixes>"
+        "<Contents><Key>c</Key></Contents></ListBucketResult>");
+
+    XmlNode root = document->GetRootElement();
+    XmlListView<TestObject> view(document, root.FirstChild("Contents"), "Contents");
+    document = nullptr;
+
+    ASSERT_FALSE(view.empty());
+    ASSERT_EQ(3u, view.size());
+
+    Aws::Vector<Aws::String> keys;
+    for (const auto& object : view)
+    {
+        keys.push_back(object.key);
+    }
+    ASSERT_EQ(3u, keys.size());
+    ASSERT_EQ("a", keys[0]);
+    ASSERT_EQ("b", keys[1]);
+    ASSERT_EQ("c", keys[2]);
+
+    auto iter = view.begin();
+    ASSERT_EQ("Contents", iter.GetNode().GetName());
+    ASSERT_EQ("b", (++iter).GetNode().FirstChild("Key").GetText());
+    ASSERT_TRUE(iter != view.begin());
+    ASSERT_EQ(3, std::distance(view.begin(), view.end()));
+}
+
+TEST(XmlListViewTest, TestEmptyViews)
+{
+    XmlListView<TestObject> defaultView;
+    ASSERT_TRUE(defaultView.empty());
+    ASSERT_EQ(0u, defaultView.size());
+    ASSERT_TRUE(defaultView.begin() == defaultView.end());
+    ASSERT_TRUE(defaultView.GetDecoded().empty());
+
+    auto document = CreateDocument("<ListBucketResult><Name>bucket</Name></ListBucketResult>");
+    XmlListView<TestObject> view(document, document->GetRootElement().FirstChild("Contents"), "Contents");
+    ASSERT_TRUE(view.empty());
+    ASSERT_TRUE(view.begin() == view.end());
+}
+
+TEST(XmlListViewTest, TestIteratorsOutliveTheirView)
+{
+    auto document = CreateDocument("<ListBucketResult>"
+        "<Contents><Key>a</Key></Contents>"
+        "<Contents><Key>b</Key></Contents></ListBucketResult>");
+
+    auto view = Aws::MakeUnique<XmlListView<TestObject>>(ALLOCATION_TAG, document, document->GetRootElement().FirstChild("Contents"), "Contents");
+    auto iter = view->begin();
+    XmlListView<TestObject> movedView(std::move(*view));
+    view = nullptr;
+
+    ASSERT_EQ("a", (*iter).key);
+    ASSERT_EQ("b", (*++iter).key);
+    ASSERT_TRUE(++iter == movedView.end());
+}
+
+TEST(XmlListViewTest, TestDecodedElementsAreSharedByCopies)
+{
+    XmlListView<TestObject> unboundView;
+    ASSERT_FALSE(unboundView.IsBound());
+
+    auto document = CreateDocument("<ListBucketResult>"
+        "<Contents><Key>a</Key></Contents>"
+        "<Contents><Key>b</Key></Contents></ListBucketResult>");
+    XmlListView<TestObject> view(document, document->GetRootElement().FirstChild("Contents"), "Contents");
+    ASSERT_TRUE(view.IsBound());
+    XmlListView<TestObject> copy(view);
+
+    const auto& decoded = view.GetDecoded();
+    ASSERT_EQ(2u, decoded.size());
+    ASSERT_EQ("a", decoded[0].key);
+    ASSERT_EQ("b", decoded[1].key);
+    ASSERT_EQ(&decoded, &copy.GetDecoded());
+}
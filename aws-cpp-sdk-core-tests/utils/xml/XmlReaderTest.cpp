@@ -0,0 +1,203 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/external/gtest.h>
+
+#include <aws/core/utils/xml/XmlReader.h>
+#include <aws/core/utils/StringUtils.h>
+#include <aws/core/utils/memory/stl/AWSStringStream.h>
+
+using namespace Aws::Utils::Xml;
+
+TEST(XmlReaderTest, TestReadTokens)
+{
+    Aws::StringStream ss;
+    ss << "<?xml version=\"1.0\" ?>\n"
+        "<!-- Our to do list data -->\n"
+        "<ToDo>\n"
+        "<Item priority=\"1\"> Go to the <bold>Toy store!</bold></Item>\n"
+        "<Item priority='2'/>\n"
+        "</ToDo>";
+
+    XmlReader reader(ss);
+    ASSERT_TRUE(reader.ReadToRootElement());
+    ASSERT_EQ("ToDo", reader.GetName());
+    ASSERT_EQ(0u, reader.GetDepth());
+
+    ASSERT_TRUE(reader.ReadChildElement(0));
+    ASSERT_EQ("Item", reader.GetName());
+    ASSERT_EQ(1u, reader.GetDepth());
+    ASSERT_EQ("1", reader.GetAttributeValue("priority"));
+    ASSERT_FALSE(reader.IsEmptyElement());
+    ASSERT_EQ(" Go to the Toy store!", reader.ReadElementText());
+    ASSERT_EQ(XmlTokenType::EndElement, reader.GetTokenType());
+    ASSERT_EQ("Item", reader.GetName());
+
+    ASSERT_TRUE(reader.ReadChildElement(0));
+    ASSERT_EQ("2", reader.GetAttributeValue("priority"));
+    ASSERT_TRUE(reader.IsEmptyElement());
+    ASSERT_TRUE(reader.Read());
+    ASSERT_EQ(XmlTokenType::EndElement, reader.GetTokenType());
+    ASSERT_EQ("Item", reader.GetName());
+
+    ASSERT_FALSE(reader.ReadChildElement(0));
+    ASSERT_EQ(XmlTokenType::EndElement, reader.GetTokenType());
+    ASSERT_EQ("ToDo", reader.GetName());
+    ASSERT_FALSE(reader.Read());
+    ASSERT_EQ(XmlTokenType::EndOfDocument, reader.GetTokenType());
+    ASSERT_TRUE(reader.WasParseSuccessful());
+}
+
+TEST(XmlReaderTest, TestDecodesEntitiesAndCData)
+{
+    Aws::StringStream ss;
+    ss << "<Root a=\"&lt;&amp;&gt;\"><Key>a&amp;b &#65;&#x42; &quot;&apos; &unknown;</Key><Data><![CDATA[<raw & data>]]></Data></Root>";
+
+    XmlReader reader(ss);
+    ASSERT_TRUE(reader.ReadToRootElement());
+    ASSERT_EQ("<&>", reader.GetAttributeValue("a"));
+    ASSERT_TRUE(reader.ReadChildElement(0));
+    ASSERT_EQ("a&b AB \"' &unknown;", reader.ReadElementText());
+    ASSERT_TRUE(reader.ReadChildElement(0));
+    ASSERT_EQ("<raw & data>", reader.ReadElementText());
+    ASSERT_FALSE(reader.ReadChildElement(0));
+    ASSERT_TRUE(reader.WasParseSuccessful());
+}
+
+TEST(XmlReaderTest, TestSkipsUnconsumedChildren)
+{
+    Aws::StringStream ss;
+    ss << "<ListBucketResult><Name>bucket</Name>"
+        "<Owner><ID>1234</ID><DisplayName>owner</DisplayName></Owner>"
+        "<Contents><Key>a</Key><Size>1</Size></Contents>"
+        "<Contents><Key>b</Key><Size>2</Size></Contents>"
+        "<IsTruncated>false</IsTruncated></ListBucketResult>";
+
+    XmlReader reader(ss);
+    ASSERT_TRUE(reader.ReadToRootElement());
+    size_t rootDepth = reader.GetDepth();
+
+    Aws::Vector<Aws::String> keys;
+    Aws::String isTruncated;
+    while (reader.ReadChildElement(rootDepth))
+    {
+        if (reader.GetName() == "Contents")
+        {
+            size_t contentsDepth = reader.GetDepth();
+            while (reader.ReadChildElement(contentsDepth))
+            {
+                if (reader.GetName() == "Key")
+                {
+                    keys.push_back(reader.ReadElementText());
+                }
+            }
+        }
+        else if (reader.GetName() == "IsTruncated")
+        {
+            isTruncated = reader.ReadElementText();
+        }
+        else if (reader.GetName() == "Owner")
+        {
+            reader.SkipElement();
+        }
+    }
+
+    ASSERT_TRUE(reader.WasParseSuccessful());
+    ASSERT_EQ(2u, keys.size());
+    ASSERT_EQ("a", keys[0]);
+    ASSERT_EQ("b", keys[1]);
+    ASSERT_EQ("false", isTruncated);
+}
+
+TEST(XmlReaderTest, TestLargeDocumentSpanningChunks)
+{
+    static const size_t itemCount = 5000;
+    Aws::StringStream ss;
+    ss << "<Items>";
+    for (size_t i = 0; i < itemCount; ++i)
+    {
+        ss << "<Item id=\"" << i << "\"><Value>value &amp; " << i << "</Value></Item>\n";
+    }
+    ss << "</Items>";
+
+    XmlReader reader(ss);
+    ASSERT_TRUE(reader.ReadToRootElement());
+    size_t count = 0;
+    while (reader.ReadChildElement(0))
+    {
+        ASSERT_EQ(Aws::Utils::StringUtils::to_string(count), reader.GetAttributeValue("id"));
+        ASSERT_TRUE(reader.ReadChildElement(1));
+        ASSERT_EQ("value & " + Aws::Utils::StringUtils::to_string(count), reader.ReadElementText());
+        ++count;
+    }
+
+    ASSERT_TRUE(reader.WasParseSuccessful());
+    ASSERT_EQ(itemCount, count);
+}
+
+TEST(XmlReaderTest, TestSkipsDoctypeInternalSubset)
+{
+    Aws::StringStream ss;
+    ss << "<?xml version=\"1.0\"?>\n"
+        "<!DOCTYPE Root [\n"
+        "  <!ELEMENT Root (Key)>\n"
+        "  <!-- the subset's own > and ] -->\n"
+        "  <!ENTITY note \"a > b\">\n"
+        "]>\n"
+        "<Root><Key>value</Key></Root>";
+
+    XmlReader reader(ss);
+    ASSERT_TRUE(reader.ReadToRootElement());
+    ASSERT_EQ("Root", reader.GetName());
+    ASSERT_TRUE(reader.ReadChildElement(0));
+    ASSERT_EQ("Key", reader.GetName());
+    ASSERT_EQ("value", reader.ReadElementText());
+    ASSERT_FALSE(reader.ReadChildElement(0));
+    ASSERT_TRUE(reader.WasParseSuccessful());
+}
+
+TEST(XmlReaderTest, TestEmptyDocument)
+{
+    Aws::StringStream ss;
+    XmlReader reader(ss);
+    ASSERT_FALSE(reader.ReadToRootElement());
+    ASSERT_TRUE(reader.WasParseSuccessful());
+}
+
+TEST(XmlReaderTest, TestMalformedDocuments)
+{
+    {
+        Aws::StringStream ss;
+        ss << "blah blah blah";
+        XmlReader reader(ss);
+        ASSERT_FALSE(reader.ReadToRootElement());
+        ASSERT_FALSE(reader.WasParseSuccessful());
+    }
+    {
+        Aws::StringStream ss;
+        ss << "<Root><Child></Root>";
+        XmlReader reader(ss);
+        while (reader.Read()) {}
+        ASSERT_FALSE(reader.WasParseSuccessful());
+    }
+    {
+        Aws::StringStream ss;
+        ss << "<Root><Child>text</Child>";
+        XmlReader reader(ss);
+        while (reader.Read()) {}
+        ASSERT_FALSE(reader.WasParseSuccessful());
+        ASSERT_FALSE(reader.GetErrorMessage().empty());
+    }
+}
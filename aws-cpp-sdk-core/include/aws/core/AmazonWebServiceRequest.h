@@ -23,6 +23,7 @@
 #include <aws/core/http/HttpRequest.h>
 #include <aws/core/utils/memory/stl/AWSStreamFwd.h>
 #include <aws/core/utils/stream/ResponseStream.h>
+#include <aws/core/utils/ProjectionMask.h>
 #include <aws/core/auth/AWSAuthSigner.h>
 
 namespace Aws
@@ -136,6 +137,16 @@ namespace Aws
          */
         inline virtual bool ShouldComputeContentMd5() const { return false; }
 
+        /**
+         * Restricts which members of the response are deserialized, see Aws::Utils::ProjectionMask.
+         * Honored by clients generated with the projection option; everything is deserialized by default.
+         */
+        inline void SetResponseProjection(const Aws::Utils::ProjectionMask& projection) { m_responseProjection = projection; }
+        /**
+         * Gets the members of the response that will be deserialized.
+         */
+        inline const Aws::Utils::ProjectionMask& GetResponseProjection() const { return m_responseProjection; }
+
         virtual const char* GetServiceRequestName() const = 0;
 
     protected:
@@ -152,6 +163,7 @@ namespace Aws
         Aws::Http::DataSentEventHandler m_onDataSent;
         Aws::Http::ContinueRequestHandler m_continueRequest;
         RequestRetryHandler m_requestRetryHandler;
+        Aws::Utils::ProjectionMask m_responseProjection;
     };
 
 } // namespace Aws
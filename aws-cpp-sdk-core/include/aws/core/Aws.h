@@ -56,7 +56,7 @@ namespace Aws
      */
     struct MemoryManagementOptions
     {
-        MemoryManagementOptions() : memoryManager(nullptr)
+        MemoryManagementOptions() : memoryManager(nullptr), bufferPoolMaxRetainedBytes(0)
         { }
 
         /**
@@ -65,6 +65,13 @@ namespace Aws
          * at startup time.
          */
         Aws::Utils::Memory::MemorySystemInterface* memoryManager;
+
+        /**
+         * Defaults to 0, which turns buffer pooling off. Otherwise stream buffers and scratch buffers are drawn from a pool
+         * that keeps up to this many bytes of released buffers for reuse, see Aws::Utils::BufferPool. With pooling on, the
+         * default response streams are backed by Aws::Utils::Stream::SimpleStreamBuf.
+         */
+        size_t bufferPoolMaxRetainedBytes;
     };
 
     /**
@@ -82,6 +89,8 @@ namespace Aws
         /**
         * libCurl infects everything with its global state. If it is being used then we automatically initialize and clean it up.
         * If this is a problem for you, set this to false. If you manually initialize libcurl please add the option CURL_GLOBAL_ALL to your init call.
+        * libcurl is initialized when the first http client is created rather than in InitAPI; with libcurl versions older than 7.84
+        * that is only safe if no other thread uses libcurl at that moment.
         */
         bool initAndCleanupCurl;
         /**
@@ -138,6 +147,7 @@ namespace Aws
          * OpenSSL infects everything with its global state. If it is being used then we automatically initialize and clean it up.
          * If this is a problem for you, set this to false. Be aware that if you don't use our init and cleanup and you are using 
          * crypto functionality, you are responsible for installing thread locking, and loading strings and error messages.
+         * OpenSSL is initialized the first time a hash, hmac, cipher or secure random implementation is created rather than in InitAPI.
          */
         bool initAndCleanupOpenSSL;
     };
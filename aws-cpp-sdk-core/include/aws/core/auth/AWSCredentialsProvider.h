@@ -17,8 +17,10 @@
 #pragma once
 
 #include <aws/core/Core_EXPORTS.h>
+#include <aws/core/auth/BackgroundCredentialsRefresher.h>
 #include <aws/core/utils/UnreferencedParam.h>
 #include <aws/core/utils/DateTime.h>
+#include <aws/core/utils/memory/AWSMemory.h>
 #include <aws/core/utils/memory/stl/AWSMap.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/core/utils/threading/ReaderWriterLock.h>
@@ -55,6 +57,13 @@ namespace Aws
             {
             }
 
+            inline bool operator==(const AWSCredentials& other) const
+            {
+                return m_accessKeyId == other.m_accessKeyId && m_secretKey == other.m_secretKey && m_sessionToken == other.m_sessionToken;
+            }
+
+            inline bool operator!=(const AWSCredentials& other) const { return !(*this == other); }
+
             /**
              * Gets the underlying access key credential
              */
@@ -133,6 +142,26 @@ namespace Aws
             Aws::String m_sessionToken;
         };
 
+        /**
+         * Latest credentials of a provider that serves snapshots, swapped atomically so readers never wait.
+         */
+        class AWS_CORE_API PublishedCredentials
+        {
+        public:
+            /**
+             * Makes an immutable copy of credentials the snapshot handed out from now on.
+             */
+            void Publish(const AWSCredentials& credentials);
+
+            /**
+             * Last snapshot published, or empty credentials when none was.
+             */
+            std::shared_ptr<const AWSCredentials> Get() const;
+
+        private:
+            std::shared_ptr<const AWSCredentials> m_snapshot;
+        };
+
         /**
           * Abstract class for retrieving AWS credentials. Create a derived class from this to allow
           * various methods of storing and retrieving credentials. Examples would be cognito-identity, some encrypted store etc...
@@ -163,10 +192,31 @@ namespace Aws
             virtual bool IsTimeToRefresh(long reloadFrequency);
             virtual void Reload();
             mutable Aws::Utils::Threading::ReaderWriterLock m_reloadLock;
+
+        public:
+            /**
+             * Same credentials as GetAWSCredentials, shared rather than copied: callers keep the snapshot as long as they
+             * need it while the provider publishes newer ones. Never null. The default implementation wraps a call to
+             * GetAWSCredentials.
+             */
+            virtual std::shared_ptr<const AWSCredentials> GetAWSCredentialsSnapshot();
+
+            /**
+             * Whether the signer and chains read this provider through GetAWSCredentialsSnapshot instead of
+             * GetAWSCredentials. The providers of the SDK caching their credentials return true; a class deriving from one
+             * of them and overriding GetAWSCredentials should return false, or its override is not called for signing.
+             */
+            virtual bool ServesCredentialsSnapshots() const;
+
         private:
             long long m_lastLoadedMs;
         };
 
+        /**
+         * Credentials of provider for one use: its snapshot when it serves them, a copy of GetAWSCredentials otherwise.
+         */
+        AWS_CORE_API std::shared_ptr<const AWSCredentials> GetCredentialsSnapshot(AWSCredentialsProvider& provider);
+
         /**
          * Simply a provider that always returns empty credentials. This is useful for a client that needs to make unsigned
          * calls.
@@ -174,10 +224,19 @@ namespace Aws
         class AWS_CORE_API AnonymousAWSCredentialsProvider : public AWSCredentialsProvider
         {
         public:
+            AnonymousAWSCredentialsProvider() { m_publishedCredentials.Publish(AWSCredentials("", "")); }
+
             /**
              * Returns empty credentials object.
              */
             inline AWSCredentials GetAWSCredentials() override { return AWSCredentials("", ""); }
+
+            inline std::shared_ptr<const AWSCredentials> GetAWSCredentialsSnapshot() override { return m_publishedCredentials.Get(); }
+
+            inline bool ServesCredentialsSnapshots() const override { return true; }
+
+        private:
+            PublishedCredentials m_publishedCredentials;
         };
 
         /**
@@ -193,7 +252,9 @@ namespace Aws
              */
             inline SimpleAWSCredentialsProvider(const Aws::String& awsAccessKeyId, const Aws::String& awsSecretAccessKey, const Aws::String& sessionToken = "")
                 : m_accessKeyId(awsAccessKeyId), m_secretAccessKey(awsSecretAccessKey), m_sessionToken(sessionToken)
-            { }
+            {
+                m_publishedCredentials.Publish(AWSCredentials(m_accessKeyId, m_secretAccessKey, m_sessionToken));
+            }
 
             /**
             * Initializes object from credentials object. everything is copied.
@@ -201,7 +262,9 @@ namespace Aws
             inline SimpleAWSCredentialsProvider(const AWSCredentials& credentials)
                 : m_accessKeyId(credentials.GetAWSAccessKeyId()), m_secretAccessKey(credentials.GetAWSSecretKey()),
                 m_sessionToken(credentials.GetSessionToken())
-            { }
+            {
+                m_publishedCredentials.Publish(credentials);
+            }
 
             /**
              * Returns the credentials this object was initialized with as an AWSCredentials object.
@@ -211,10 +274,15 @@ namespace Aws
                 return AWSCredentials(m_accessKeyId, m_secretAccessKey, m_sessionToken);
             }
 
+            inline std::shared_ptr<const AWSCredentials> GetAWSCredentialsSnapshot() override { return m_publishedCredentials.Get(); }
+
+            inline bool ServesCredentialsSnapshots() const override { return true; }
+
         private:
             Aws::String m_accessKeyId;
             Aws::String m_secretAccessKey;
             Aws::String m_sessionToken;
+            PublishedCredentials m_publishedCredentials;
         };
 
         /**
@@ -258,6 +326,10 @@ namespace Aws
             */
             AWSCredentials GetAWSCredentials() override;
 
+            std::shared_ptr<const AWSCredentials> GetAWSCredentialsSnapshot() override;
+
+            inline bool ServesCredentialsSnapshots() const override { return true; }
+
             /**
              * Returns the fullpath of the calculated config profile file
              */
@@ -273,6 +345,11 @@ namespace Aws
              */
             static Aws::String GetProfileDirectory();
 
+            /**
+             * Returns the profile used when none is given: AWS_DEFAULT_PROFILE, else AWS_PROFILE, else "default".
+             */
+            static Aws::String GetDefaultProfileName();
+
         protected:
             void Reload() override;
         private:
@@ -281,11 +358,13 @@ namespace Aws
             * Checks to see if the refresh interval has expired and reparses the file if it has.
             */
             void RefreshIfExpired();
+            AWSCredentials FindCredentials() const;
 
             Aws::String m_profileToUse;
             std::shared_ptr<Aws::Config::AWSProfileConfigLoader> m_configFileLoader;
             std::shared_ptr<Aws::Config::AWSProfileConfigLoader> m_credentialsFileLoader;
             long m_loadFrequencyMs;
+            PublishedCredentials m_publishedCredentials;
         };
 
         /**
@@ -298,28 +377,38 @@ namespace Aws
             /**
              * Initializes the provider to refresh credentials form the EC2 instance metadata service every 5 minutes.
              * Constructs an EC2MetadataClient using the default http stack (most likely what you want).
+             * With CredentialsRefreshMode::Background, the refreshes happen on a thread of the provider's own.
              */
-            InstanceProfileCredentialsProvider(long refreshRateMs = REFRESH_THRESHOLD);
+            InstanceProfileCredentialsProvider(long refreshRateMs = REFRESH_THRESHOLD, CredentialsRefreshMode refreshMode = CredentialsRefreshMode::OnDemand);
 
             /**
              * Initializes the provider to refresh credentials form the EC2 instance metadata service every 5 minutes,
              * uses a supplied EC2MetadataClient.
              */
-            InstanceProfileCredentialsProvider(const std::shared_ptr<Aws::Config::EC2InstanceProfileConfigLoader>&, long refreshRateMs = REFRESH_THRESHOLD);
+            InstanceProfileCredentialsProvider(const std::shared_ptr<Aws::Config::EC2InstanceProfileConfigLoader>&, long refreshRateMs = REFRESH_THRESHOLD,
+                CredentialsRefreshMode refreshMode = CredentialsRefreshMode::OnDemand);
 
             /**
             * Retrieves the credentials if found, otherwise returns empty credential set.
             */
             AWSCredentials GetAWSCredentials() override;
 
+            std::shared_ptr<const AWSCredentials> GetAWSCredentialsSnapshot() override;
+
+            inline bool ServesCredentialsSnapshots() const override { return true; }
+
         protected:
             void Reload() override;
 
         private:
             void RefreshIfExpired();
+            bool RefreshInBackground();
+            void StartBackgroundRefresh(CredentialsRefreshMode refreshMode);
 
             std::shared_ptr<Aws::Config::AWSProfileConfigLoader> m_ec2MetadataConfigLoader;
             long m_loadFrequencyMs;
+            Aws::UniquePtr<BackgroundCredentialsRefresher> m_backgroundRefresher;
+            PublishedCredentials m_publishedCredentials;
         };
 
         /**
@@ -334,8 +423,10 @@ namespace Aws
              * or before it expires.
              * @param resourcePath A path appended to the metadata service endpoint.
              * @param refreshRateMs The number of milliseconds after which the credentials will be fetched again.
+             * @param refreshMode Whether credentials are fetched by GetAWSCredentials or by a background thread.
              */
-            TaskRoleCredentialsProvider(const char* resourcePath, long refreshRateMs = REFRESH_THRESHOLD);
+            TaskRoleCredentialsProvider(const char* resourcePath, long refreshRateMs = REFRESH_THRESHOLD,
+                CredentialsRefreshMode refreshMode = CredentialsRefreshMode::OnDemand);
 
             /**
              * Initializes the provider to retrieve credentials from a provided endpoint every 5 minutes or before it
@@ -343,32 +434,44 @@ namespace Aws
              * @param endpoint The full URI to resolve to get credentials.
              * @param token An optional authorization token passed to the URI via the 'Authorization' HTTP header.
              * @param refreshRateMs The number of milliseconds after which the credentials will be fetched again.
+             * @param refreshMode Whether credentials are fetched by GetAWSCredentials or by a background thread.
              */
-            TaskRoleCredentialsProvider(const char* endpoint, const char* token, long refreshRateMs = REFRESH_THRESHOLD);
+            TaskRoleCredentialsProvider(const char* endpoint, const char* token, long refreshRateMs = REFRESH_THRESHOLD,
+                CredentialsRefreshMode refreshMode = CredentialsRefreshMode::OnDemand);
 
             /**
              * Initializes the provider to retrieve credentials using the provided client.
              * @param client The ECSCredentialsClient instance to use when retrieving credentials.
              * @param refreshRateMs The number of milliseconds after which the credentials will be fetched again.
+             * @param refreshMode Whether credentials are fetched by GetAWSCredentials or by a background thread.
              */
             TaskRoleCredentialsProvider(const std::shared_ptr<Aws::Internal::ECSCredentialsClient>& client,
-                    long refreshRateMs = REFRESH_THRESHOLD);
+                    long refreshRateMs = REFRESH_THRESHOLD, CredentialsRefreshMode refreshMode = CredentialsRefreshMode::OnDemand);
             /**
             * Retrieves the credentials if found, otherwise returns empty credential set.
             */
             AWSCredentials GetAWSCredentials() override;
 
+            std::shared_ptr<const AWSCredentials> GetAWSCredentialsSnapshot() override;
+
+            inline bool ServesCredentialsSnapshots() const override { return true; }
+
         protected:
             void Reload() override;
         private:
             bool ExpiresSoon() const;
             void RefreshIfExpired();
+            bool FetchCredentials(Aws::Auth::AWSCredentials& credentials, Aws::Utils::DateTime& expiration) const;
+            bool RefreshInBackground(Aws::Utils::DateTime& expiration);
+            void StartBackgroundRefresh(CredentialsRefreshMode refreshMode);
 
         private:
             std::shared_ptr<Aws::Internal::ECSCredentialsClient> m_ecsCredentialsClient;
             long m_loadFrequencyMs;
             Aws::Utils::DateTime m_expirationDate;
             Aws::Auth::AWSCredentials m_credentials;
+            Aws::UniquePtr<BackgroundCredentialsRefresher> m_backgroundRefresher;
+            PublishedCredentials m_publishedCredentials;
         };
 
     } // namespace Auth
@@ -19,11 +19,35 @@
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/core/auth/AWSCredentialsProvider.h>
 #include <memory>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <atomic>
 
 namespace Aws
 {
     namespace Auth
     {
+        /**
+         * How a chain looks for the first provider with credentials.
+         */
+        enum class ChainResolutionMode
+        {
+            /**
+             * Asks one provider after the other.
+             */
+            Sequential,
+            /**
+             * Asks every provider at once, each on its own thread, and returns as soon as every provider ahead of one with
+             * credentials came back empty, so a slow provider, such as the instance metadata service off EC2, only delays
+             * resolution when nothing ahead of it has credentials. Later calls ask the providers up to the one that answered
+             * in order and only probe concurrently again once all of them come back empty. When no provider has credentials,
+             * the chain returns empty credentials without asking again for a second, doubling up to five minutes while it
+             * keeps finding none.
+             */
+            Concurrent
+        };
+
         /**
          * Abstract class for providing chains of credentials providers. When a credentials provider in the chain returns empty credentials,
          * We go on to the next provider until we have either exhausted the installed providers in the chain or something returns non-empty credentials.
@@ -31,24 +55,36 @@ namespace Aws
         class AWS_CORE_API AWSCredentialsProviderChain : public AWSCredentialsProvider
         {
         public:
-            virtual ~AWSCredentialsProviderChain() = default;
+            /**
+             * Waits for the probes the chain abandoned in Concurrent mode, which can take as long as the slowest provider
+             * takes to give up, such as the instance metadata service off EC2. The probes use the providers, which may be
+             * gone after the chain, so they are not left running.
+             */
+            virtual ~AWSCredentialsProviderChain();
 
             /**
              * When a credentials provider in the chain returns empty credentials,
              * We go on to the next provider until we have either exhausted the installed providers in the chain or something returns non-empty credentials.
              */
-            virtual AWSCredentials GetAWSCredentials();
+            AWSCredentials GetAWSCredentials() override;
+
+            /**
+             * Snapshot of the first provider in the chain with non-empty credentials, see GetAWSCredentials.
+             */
+            std::shared_ptr<const AWSCredentials> GetAWSCredentialsSnapshot() override;
 
             /**
              * Gets all providers stored in this chain.
              */
             const Aws::Vector<std::shared_ptr<AWSCredentialsProvider>>& GetProviders() { return m_providerChain; }
 
+            inline ChainResolutionMode GetResolutionMode() const { return m_resolutionMode; }
+
         protected:
             /**
              * This class is only allowed to be initialized by subclasses.
              */
-            AWSCredentialsProviderChain() = default;
+            AWSCredentialsProviderChain(ChainResolutionMode resolutionMode = ChainResolutionMode::Sequential);
 
             /**
              * Adds a provider to the back of the chain.
@@ -56,8 +92,29 @@ namespace Aws
             void AddProvider(const std::shared_ptr<AWSCredentialsProvider>& provider) { m_providerChain.push_back(provider); }
 
 
-        private:            
+        private:
+            struct ProviderProbe
+            {
+                ProviderProbe() : running(false), done(false) {}
+
+                std::thread thread;
+                bool running;
+                bool done;
+                std::shared_ptr<const AWSCredentials> credentials;
+            };
+
+            std::shared_ptr<const AWSCredentials> ResolveConcurrently(size_t firstProvider);
+
             Aws::Vector<std::shared_ptr<AWSCredentialsProvider> > m_providerChain;
+            ChainResolutionMode m_resolutionMode;
+            std::atomic<size_t> m_resolvedProviderCount;
+            //when a Concurrent chain that found no credentials probes again, and how long it waits after that.
+            std::atomic<int64_t> m_nextProbeMs;
+            int64_t m_probeBackoffMs;
+            std::mutex m_resolveLock;
+            std::mutex m_probeLock;
+            std::condition_variable m_probeSignal;
+            Aws::Vector<ProviderProbe> m_probes;
         };
 
         /**
@@ -69,9 +126,11 @@ namespace Aws
         public:
             /**
              * Initializes the provider chain with EnvironmentAWSCredentialsProvider, ProfileConfigFileAWSCredentialsProvider,
-             * and InstanceProfileCredentialsProvider in that order.
+             * and InstanceProfileCredentialsProvider in that order, resolved as resolutionMode says.
+             * Between InitAPI and ShutdownAPI the providers come from the CredentialsProviderCache, so chains built under the
+             * same environment share them.
              */
-            DefaultAWSCredentialsProviderChain();
+            DefaultAWSCredentialsProviderChain(ChainResolutionMode resolutionMode = ChainResolutionMode::Sequential);
         };
 
     } // namespace Auth
@@ -0,0 +1,103 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+#include <aws/core/utils/DateTime.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+namespace Aws
+{
+    namespace Auth
+    {
+        /**
+         * How a credentials provider that fetches credentials from a remote service keeps them fresh.
+         */
+        enum class CredentialsRefreshMode
+        {
+            /**
+             * GetAWSCredentials fetches new credentials once the cached ones are due, holding the provider's lock, so the
+             * caller and every other caller waiting on the lock wait for the round trip.
+             */
+            OnDemand,
+
+            /**
+             * A background thread fetches new credentials ahead of expiry. GetAWSCredentials only copies the cached ones,
+             * and keeps returning them while they are still valid if a refresh fails.
+             */
+            Background
+        };
+
+        /**
+         * Thread calling a credentials provider's refresh function right away, then again before the credentials are due:
+         * after refreshRateMs, or ahead of their expiration when they have one, less a random jitter of up to a tenth of
+         * the wait so that processes started together do not refresh together. A failed refresh is retried with
+         * exponential backoff.
+         */
+        class AWS_CORE_API BackgroundCredentialsRefresher
+        {
+        public:
+            /**
+             * Fetches new credentials and swaps them into the provider. Sets expiration when the new credentials have one.
+             * Returns false when nothing was fetched, in which case the provider must keep the credentials it has.
+             */
+            typedef std::function<bool(Aws::Utils::DateTime& expiration)> RefreshFunction;
+
+            /**
+             * Starts the thread. refresh must stay callable until this object is destroyed.
+             */
+            BackgroundCredentialsRefresher(const RefreshFunction& refresh, long refreshRateMs);
+
+            /**
+             * Stops the thread, waiting for a refresh in progress to finish.
+             */
+            ~BackgroundCredentialsRefresher();
+
+            BackgroundCredentialsRefresher(const BackgroundCredentialsRefresher&) = delete;
+            BackgroundCredentialsRefresher& operator=(const BackgroundCredentialsRefresher&) = delete;
+
+            /**
+             * Waits for the first refresh to finish, since until then the provider has nothing to return. Returns right away
+             * afterwards.
+             */
+            void WaitForFirstRefresh();
+
+            /**
+             * Number of refreshes that failed since the last one that succeeded.
+             */
+            inline unsigned GetConsecutiveFailures() const { return m_consecutiveFailures.load(); }
+
+        private:
+            void Run();
+            long GetDelayAfterRefreshMs(bool succeeded, const Aws::Utils::DateTime& expiration);
+
+            RefreshFunction m_refresh;
+            long m_refreshRateMs;
+            std::atomic<bool> m_firstRefreshDone;
+            std::atomic<unsigned> m_consecutiveFailures;
+            bool m_stopping;
+            std::mutex m_mutex;
+            std::condition_variable m_signal;
+            unsigned m_jitterState;
+            std::thread m_thread;
+        };
+    } // namespace Auth
+} // namespace Aws
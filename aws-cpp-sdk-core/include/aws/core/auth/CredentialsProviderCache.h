@@ -0,0 +1,82 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+#include <aws/core/auth/AWSCredentialsProvider.h>
+#include <aws/core/utils/memory/stl/AWSMap.h>
+#include <aws/core/utils/memory/stl/AWSString.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+
+#include <functional>
+#include <memory>
+#include <mutex>
+
+namespace Aws
+{
+    namespace Auth
+    {
+        typedef Aws::Vector<std::shared_ptr<AWSCredentialsProvider>> CredentialsProviders;
+
+        /**
+         * Process-wide cache of credentials providers, keyed by the configuration they were built from.
+         *
+         * DefaultAWSCredentialsProviderChain takes its providers from here, so every client of the process built with the
+         * same environment and profile shares one parsed profile set and one metadata service refresh cycle. The cache only
+         * holds weak references: providers are released once the last chain using them is destroyed.
+         */
+        class AWS_CORE_API CredentialsProviderCache
+        {
+        public:
+            /**
+             * Providers cached under key, or the ones createProviders returns, cached under key, when none are alive.
+             */
+            CredentialsProviders GetOrCreate(const Aws::String& key, const std::function<CredentialsProviders()>& createProviders);
+
+            /**
+             * Number of keys whose providers are still in use.
+             */
+            size_t GetSize() const;
+
+            /**
+             * Forgets every key, providers in use stay alive with their owners.
+             */
+            void Clear();
+
+        private:
+            void PurgeExpired();
+
+            mutable std::mutex m_cacheLock;
+            Aws::Map<Aws::String, Aws::Vector<std::weak_ptr<AWSCredentialsProvider>>> m_providers;
+        };
+
+        /**
+         * Cache installed by InitAPI, nullptr outside of InitAPI/ShutdownAPI.
+         */
+        AWS_CORE_API CredentialsProviderCache* GetCredentialsProviderCache();
+
+        /**
+         * Installs the process-wide cache. This should only be called once from within Aws::InitAPI.
+         */
+        AWS_CORE_API void InitCredentialsProviderCache();
+
+        /**
+         * Destroys the process-wide cache. This should only be called once from within Aws::ShutdownAPI.
+         */
+        AWS_CORE_API void CleanupCredentialsProviderCache();
+
+    } // namespace Auth
+} // namespace Aws
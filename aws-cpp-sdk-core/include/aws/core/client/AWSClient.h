@@ -24,6 +24,8 @@
 #include <aws/core/auth/AWSAuthSignerProvider.h>
 #include <memory>
 #include <atomic>
+#include <functional>
+#include <mutex>
 
 namespace Aws
 {
@@ -87,6 +89,12 @@ namespace Aws
         typedef Utils::Outcome<std::shared_ptr<Aws::Http::HttpResponse>, AWSError<CoreErrors>> HttpResponseOutcome;
         typedef Utils::Outcome<AmazonWebServiceResult<Utils::Stream::ResponseStream>, AWSError<CoreErrors>> StreamOutcome;
 
+        /**
+         * Parses the response of a successful attempt while the call is still in flight, so that monitors see the time
+         * it takes as the ResponseParsing phase.
+         */
+        typedef std::function<void(const std::shared_ptr<Aws::Http::HttpResponse>&)> ResponseParser;
+
         /**
          * Abstract AWS Client. Contains most of the functionality necessary to build an http request, get it signed, and send it accross the wire.
          */
@@ -162,12 +170,14 @@ namespace Aws
         protected:
             /**
              * Calls AttemptOnRequest until it either, succeeds, runs out of retries from the retry strategy,
-             * or encounters and error that is not retryable.
+             * or encounters and error that is not retryable. responseParser, when set, is run on the successful response
+             * before monitors are told about it.
              */
             HttpResponseOutcome AttemptExhaustively(const Aws::Http::URI& uri,
                     const Aws::AmazonWebServiceRequest& request,
                     Http::HttpMethod httpMethod,
-                    const char* signerName) const;
+                    const char* signerName,
+                    const ResponseParser& responseParser = nullptr) const;
 
             /**
              * Calls AttemptOnRequest until it either, succeeds, runs out of retries from the retry strategy,
@@ -176,7 +186,8 @@ namespace Aws
             HttpResponseOutcome AttemptExhaustively(const Aws::Http::URI& uri, 
                     Http::HttpMethod httpMethod,
                     const char* signerName,
-                    const char* requestName = nullptr) const;
+                    const char* requestName = nullptr,
+                    const ResponseParser& responseParser = nullptr) const;
 
             /**
              * Build an Http Request from the AmazonWebServiceRequest object. Signs the request, sends it accross the wire
@@ -247,10 +258,18 @@ namespace Aws
                                          const std::shared_ptr<Aws::IOStream>& body, bool needsContentMd5 = false) const;
             void AddCommonHeaders(Aws::Http::HttpRequest& httpRequest) const;
             void InitializeGlobalStatics();
+            /**
+             * The http client is created the first time it is needed rather than with the client, so a process constructing
+             * clients it might not use doesn't pay for http clients and their connection pools up front.
+             */
+            const std::shared_ptr<Aws::Http::HttpClient>& GetHttpClient() const;
             std::shared_ptr<Aws::Http::HttpRequest> ConvertToRequestForPresigning(const Aws::AmazonWebServiceRequest& request, Aws::Http::URI& uri,
                 Aws::Http::HttpMethod method, const Aws::Http::QueryStringParameterCollection& extraParams) const;
 
-            std::shared_ptr<Aws::Http::HttpClient> m_httpClient;
+            mutable std::shared_ptr<Aws::Http::HttpClient> m_httpClient;
+            //kept until the http client is created.
+            mutable std::shared_ptr<const ClientConfiguration> m_httpClientConfiguration;
+            mutable std::once_flag m_httpClientCreated;
             std::shared_ptr<Aws::Auth::AWSAuthSignerProvider> m_signerProvider;
             std::shared_ptr<AWSErrorMarshaller> m_errorMarshaller;
             std::shared_ptr<RetryStrategy> m_retryStrategy;
@@ -259,6 +278,10 @@ namespace Aws
             Aws::String m_userAgent;
             std::shared_ptr<Aws::Utils::Crypto::Hash> m_hash;
             bool m_enableClockSkewAdjustment;
+            //set once m_httpClient can be used without GetHttpClient, which would create it.
+            mutable std::atomic<bool> m_httpClientReady;
+            //what Disable/EnableRequestProcessing asked for, applied to the http client when it is created.
+            std::atomic<bool> m_requestProcessingDisabled;
         };
 
         typedef Utils::Outcome<AmazonWebServiceResult<Utils::Json::JsonValue>, AWSError<CoreErrors>> JsonOutcome;
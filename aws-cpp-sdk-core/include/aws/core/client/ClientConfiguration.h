@@ -68,6 +68,11 @@ namespace Aws
              * Max concurrent tcp connections for a single http client to use. Default 25.
              */
             unsigned maxConnections;
+            /**
+             * Max concurrent tcp connections to any one host, within maxConnections. Default 0, no limit but maxConnections.
+             * Only for CURL client currently.
+             */
+            unsigned maxConnectionsPerHost;
             /**
              * Socket read timeouts for HTTP clients on Windows. Default 3000 ms. This should be more than adequate for most services. However, if you are transfering large amounts of data
              * or are worried about higher latencies, you should set to something that makes more sense for your use case.
@@ -174,6 +179,12 @@ namespace Aws
              * If set to true clock skew will be adjusted after each http attempt, default to true.
              */
             bool enableClockSkewAdjustment;
+            /**
+             * If set to true the client takes its http client, and so its connection pool, from the process-wide
+             * HttpClientRegistry, shared with every other client created with this option and the same http settings.
+             * Disabling request processing on one of these clients then disables it on all of them. Default false.
+             */
+            bool shareHttpClient;
         };
 
     } // namespace Client
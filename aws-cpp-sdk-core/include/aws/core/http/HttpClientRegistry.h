@@ -0,0 +1,90 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+#include <aws/core/utils/memory/stl/AWSMap.h>
+#include <aws/core/utils/memory/stl/AWSString.h>
+
+#include <memory>
+#include <mutex>
+
+namespace Aws
+{
+    namespace Client
+    {
+        struct ClientConfiguration;
+    } // namespace Client
+    namespace Http
+    {
+        class HttpClient;
+
+        /**
+         * Process-wide registry of http clients, keyed by the settings of a ClientConfiguration that shape an http client
+         * and its connection pool: connection limits, timeouts, keep-alive, proxy, TLS, redirects, user agent and the http
+         * library.
+         *
+         * Service clients created with ClientConfiguration::shareHttpClient take their http client from here, so clients
+         * talking to the same endpoints reuse each other's connections. The registry only holds weak references: an http
+         * client is released once the last service client using it is destroyed.
+         */
+        class AWS_CORE_API HttpClientRegistry
+        {
+        public:
+            /**
+             * Http client registered for the settings of clientConfiguration, created through the installed
+             * HttpClientFactory and registered when none is alive.
+             */
+            std::shared_ptr<HttpClient> GetOrCreate(const Aws::Client::ClientConfiguration& clientConfiguration);
+
+            /**
+             * Number of http clients still in use.
+             */
+            size_t GetSize() const;
+
+            /**
+             * Forgets every http client, the ones in use stay alive with their owners.
+             */
+            void Clear();
+
+            /**
+             * Key the http client for clientConfiguration is registered under: a SHA256 digest, hex encoded, of every
+             * setting the http clients read, proxy credentials included.
+             */
+            static Aws::String ComputeKey(const Aws::Client::ClientConfiguration& clientConfiguration);
+
+        private:
+            mutable std::mutex m_registryLock;
+            Aws::Map<Aws::String, std::weak_ptr<HttpClient>> m_httpClients;
+        };
+
+        /**
+         * Registry installed by InitAPI, nullptr outside of InitAPI/ShutdownAPI.
+         */
+        AWS_CORE_API HttpClientRegistry* GetHttpClientRegistry();
+
+        /**
+         * Installs the process-wide registry. This should only be called once from within Aws::InitAPI.
+         */
+        AWS_CORE_API void InitHttpClientRegistry();
+
+        /**
+         * Destroys the process-wide registry. This should only be called once from within Aws::ShutdownAPI.
+         */
+        AWS_CORE_API void CleanupHttpClientRegistry();
+
+    } // namespace Http
+} // namespace Aws
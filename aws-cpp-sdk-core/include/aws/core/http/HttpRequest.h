@@ -23,6 +23,7 @@
 #include <aws/core/utils/memory/stl/AWSStreamFwd.h>
 #include <aws/core/utils/stream/ResponseStream.h>
 #include <aws/core/monitoring/HttpClientMetrics.h>
+#include <aws/core/monitoring/RequestPhaseTimings.h>
 #include <memory>
 #include <functional>
 
@@ -478,6 +479,16 @@ namespace Aws
             */
             virtual const HttpClientMetricsCollection& GetRequestMetrics() const { return m_httpRequestMetrics; }
 
+            /**
+             * Adds duration to the time this request spent in phase.
+             */
+            inline void AddPhaseDuration(Aws::Monitoring::RequestPhase phase, std::chrono::steady_clock::duration duration) { m_phaseTimings.Add(phase, duration); }
+
+            /**
+             * Gets the time this request spent in each phase so far.
+             */
+            inline const Aws::Monitoring::RequestPhaseTimings& GetPhaseTimings() const { return m_phaseTimings; }
+
         private:
             URI m_uri;
             HttpMethod m_method;
@@ -487,6 +498,7 @@ namespace Aws
             Aws::String m_signingRegion;
             Aws::String m_signingAccessKey;
             HttpClientMetricsCollection m_httpRequestMetrics;
+            Aws::Monitoring::RequestPhaseTimings m_phaseTimings;
         };
 
     } // namespace Http
@@ -20,6 +20,7 @@
 #include <aws/core/http/Scheme.h>
 #include <aws/core/utils/memory/stl/AWSMap.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
+#include <aws/core/utils/StringView.h>
 
 #include <stdint.h>
 
@@ -138,6 +139,8 @@ namespace Aws
             * Adds query string parameter to underlying query string.
             */
             void AddQueryStringParameter(const char* key, const Aws::String& value);
+            void AddQueryStringParameter(const char* key, const char* value);
+            void AddQueryStringParameter(const char* key, Aws::Utils::StringView value);
 
             /**
             * Adds multiple query string parameters to underlying query string.
@@ -21,7 +21,10 @@
 #include <aws/core/http/curl/CurlHandleContainer.h>
 #include <aws/core/client/ClientConfiguration.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
+#include <aws/core/utils/memory/stl/AWSMap.h>
 #include <atomic>
+#include <mutex>
+#include <condition_variable>
 
 namespace Aws
 {
@@ -66,8 +69,17 @@ private:
     Aws::String m_caFile;
     bool m_disableExpectHeader;
     bool m_allowRedirects;
+    unsigned m_maxConnectionsPerHost;
+    //connections in use by host, when they are limited per host.
+    mutable Aws::Map<Aws::String, unsigned> m_hostConnections;
+    mutable std::mutex m_hostConnectionsLock;
+    mutable std::condition_variable m_hostConnectionReleased;
     static std::atomic<bool> isInit;
 
+    //Blocks until one more connection to host fits within maxConnectionsPerHost, false if request processing got disabled first
+    bool AcquireHostConnection(const Aws::String& host) const;
+    void ReleaseHostConnection(const Aws::String& host) const;
+
     void MakeRequestInternal(HttpRequest& request, std::shared_ptr<Standard::StandardHttpResponse>& response,
         Aws::Utils::RateLimits::RateLimiterInterface* readLimiter, 
         Aws::Utils::RateLimits::RateLimiterInterface* writeLimiter) const;
@@ -20,6 +20,7 @@
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/core/client/ClientConfiguration.h>
 #include <memory>
+#include <mutex>
 
 namespace Aws
 {
@@ -65,8 +66,17 @@ namespace Aws
             Aws::String m_logtag;
 
         private:
+            /**
+             * Creates the http client on the first request, so credentials providers that are constructed but never
+             * consulted don't create one.
+             */
+            const std::shared_ptr<Http::HttpClient>& GetHttpClient() const;
+
             std::shared_ptr<Client::RetryStrategy> m_retryStrategy;
-            std::shared_ptr<Http::HttpClient> m_httpClient;
+            mutable std::shared_ptr<Http::HttpClient> m_httpClient;
+            //kept until the http client is created.
+            mutable std::shared_ptr<const Client::ClientConfiguration> m_httpClientConfiguration;
+            mutable std::once_flag m_httpClientCreated;
         };
 
         /**
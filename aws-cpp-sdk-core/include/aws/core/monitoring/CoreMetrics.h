@@ -16,6 +16,7 @@
 #pragma once
 #include <aws/core/Core_EXPORTS.h>
 #include <aws/core/monitoring/HttpClientMetrics.h>
+#include <aws/core/monitoring/RequestPhaseTimings.h>
 
 namespace Aws
 {
@@ -31,6 +32,11 @@ namespace Aws
              */
             HttpClientMetricsCollection httpClientMetrics;
 
+            /**
+             * Time spent in each phase of the attempt.
+             */
+            RequestPhaseTimings phaseTimings;
+
             // Add Other types of metrics here.
         };
     }
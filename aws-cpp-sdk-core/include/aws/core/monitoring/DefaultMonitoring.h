@@ -19,10 +19,17 @@
 #include <aws/core/monitoring/MonitoringInterface.h>
 #include <aws/core/monitoring/MonitoringFactory.h>
 #include <aws/core/net/SimpleUDP.h>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
 namespace Aws
 {
     namespace Monitoring
     {
+        class DatagramBatcher;
+
         /**
          * Default monitoring implementation definition
          */
@@ -36,6 +43,9 @@ namespace Aws
             const static char DEFAULT_CSM_ENVIRONMENT_VAR_ENABLED[];
             const static char DEFAULT_CSM_ENVIRONMENT_VAR_CLIENT_ID[];
             const static char DEFAULT_CSM_ENVIRONMENT_VAR_PORT[];
+            const static char DEFAULT_CSM_CONFIG_BATCH_EVENTS[];
+            const static char DEFAULT_CSM_ENVIRONMENT_VAR_BATCH_EVENTS[];
+            const static int DEFAULT_BATCH_FLUSH_INTERVAL_MS;
 
             /**
              * @brief Construct a default monitoring instance
@@ -44,6 +54,22 @@ namespace Aws
              */
             DefaultMonitoring(const Aws::String& clientId, unsigned short port);
 
+            /**
+             * @brief Construct a default monitoring instance that packs events into datagrams instead of sending one per event.
+             * Events are separated by a newline in each datagram, so the agent has to accept that format.
+             * @param clientId, used to identify the application
+             * @param port, used to send collected metric to a local agent listen on this port.
+             * @param maxDatagramSize, datagrams are sent once the next event would not fit, a larger event is sent on its own.
+             * @param flushInterval, longest time an event waits for its datagram to fill up.
+             */
+            DefaultMonitoring(const Aws::String& clientId, unsigned short port, size_t maxDatagramSize,
+                std::chrono::milliseconds flushInterval = std::chrono::milliseconds(DEFAULT_BATCH_FLUSH_INTERVAL_MS));
+
+            ~DefaultMonitoring();
+
+            DefaultMonitoring(const DefaultMonitoring&) = delete;
+            DefaultMonitoring& operator=(const DefaultMonitoring&) = delete;
+
             void* OnRequestStarted(const Aws::String& serviceName, const Aws::String& requestName, const std::shared_ptr<const Aws::Http::HttpRequest>& request) const override;
 
             void OnRequestSucceeded(const Aws::String& serviceName, const Aws::String& requestName, const std::shared_ptr<const Aws::Http::HttpRequest>& request,
@@ -62,7 +88,21 @@ namespace Aws
                 const std::shared_ptr<const Aws::Http::HttpRequest>& request, void* context) const override;
 
             static inline int GetVersion() { return DEFAULT_MONITORING_VERSION; }
+
+            /**
+             * Sends every batched event right away. Does nothing when events are not batched.
+             */
+            void Flush() const;
+
+            /**
+             * Number of batched events discarded because the agent did not keep up, either because too many datagrams were
+             * waiting to be sent or because sending one failed.
+             */
+            uint64_t GetDroppedEventCount() const;
+
         private:
+            void SendEvent(const Aws::String& event) const;
+
             void CollectAndSendAttemptData(const Aws::String& serviceName, const Aws::String& requestName, 
                 const std::shared_ptr<const Aws::Http::HttpRequest>& request, const Aws::Client::HttpResponseOutcome& outcome, 
                 const CoreMetricsCollection& metricsFromCore, void* context) const;
@@ -70,6 +110,7 @@ namespace Aws
             Aws::Net::SimpleUDP m_udp;
             Aws::String m_clientId;
             unsigned short m_port;
+            DatagramBatcher* m_batcher;
         };
 
         class AWS_CORE_API DefaultMonitoringFactory : public MonitoringFactory
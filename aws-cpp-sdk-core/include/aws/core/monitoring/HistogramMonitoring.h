@@ -0,0 +1,164 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#pragma once
+#include <aws/core/Core_EXPORTS.h>
+#include <aws/core/monitoring/MonitoringInterface.h>
+#include <aws/core/monitoring/MonitoringFactory.h>
+#include <aws/core/utils/HdrHistogram.h>
+#include <aws/core/utils/memory/stl/AWSString.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+#include <aws/core/utils/memory/stl/AWSStreamFwd.h>
+
+#include <memory>
+#include <cstddef>
+
+namespace Aws
+{
+    namespace Monitoring
+    {
+        struct HistogramShard;
+
+        /**
+         * Histogram of one metric for the calls or attempts of one operation that ended with one http status code.
+         */
+        struct AWS_CORE_API MetricHistogram
+        {
+            MetricHistogram(const Aws::String& service, const Aws::String& request, int status, const Aws::String& metric,
+                const Aws::Utils::HdrHistogram& values) :
+                serviceName(service), requestName(request), statusCode(status), metricName(metric), histogram(values)
+            {}
+
+            Aws::String serviceName;
+            Aws::String requestName;
+            /**
+             * Http status code of the attempt, or of the last attempt of the call; -1 (REQUEST_NOT_MADE) when no response
+             * was received.
+             */
+            int statusCode;
+            /**
+             * "CallLatency", "AttemptLatency", "Retries", the name of a latency HttpClientMetricsType or the name of a
+             * RequestPhase.
+             */
+            Aws::String metricName;
+            Aws::Utils::HdrHistogram histogram;
+        };
+
+        /**
+         * Latency histograms shared by every HistogramMonitoring instance created from it, which is what an application
+         * keeps to read them back.
+         *
+         * Latencies are kept in microseconds, including the ones http clients report in milliseconds. Each thread records
+         * into one of a fixed number of shards, each with its own lock, so recording threads rarely wait on each other;
+         * a snapshot merges the shards.
+         */
+        class AWS_CORE_API LatencyHistograms
+        {
+        public:
+            static const char CALL_LATENCY[];
+            static const char ATTEMPT_LATENCY[];
+            static const char RETRIES[];
+
+            /**
+             * significantFigures is the precision every histogram keeps, see Aws::Utils::HdrHistogram.
+             */
+            LatencyHistograms(size_t shardCount = 8, int significantFigures = 2);
+            ~LatencyHistograms();
+
+            LatencyHistograms(const LatencyHistograms&) = delete;
+            LatencyHistograms& operator=(const LatencyHistograms&) = delete;
+
+            /**
+             * Adds value to the named histogram of the operation and status code. metricName must be one of the names
+             * listed in MetricHistogram.
+             */
+            void Record(const Aws::String& serviceName, const Aws::String& requestName, int statusCode, const char* metricName, int64_t value);
+
+            /**
+             * Every histogram recorded since the last reset, merged across shards and ordered by service, operation,
+             * status code and metric.
+             */
+            Aws::Vector<MetricHistogram> GetSnapshot() const;
+
+            /**
+             * Forgets everything recorded.
+             */
+            void Reset();
+
+            /**
+             * Writes one line per histogram of the snapshot with its count, p50, p99, p999 and max.
+             */
+            void Export(Aws::OStream& output) const;
+
+        private:
+            HistogramShard& GetShard() const;
+
+            size_t m_shardCount;
+            int m_significantFigures;
+            HistogramShard* m_shards;
+        };
+
+        /**
+         * Monitor recording call latency, attempt latency, retries, the latencies reported by the http client and the time
+         * spent in each request phase into LatencyHistograms, per service, operation and http status code, without leaving
+         * the process.
+         */
+        class AWS_CORE_API HistogramMonitoring : public MonitoringInterface
+        {
+        public:
+            HistogramMonitoring(const std::shared_ptr<LatencyHistograms>& histograms);
+
+            void* OnRequestStarted(const Aws::String& serviceName, const Aws::String& requestName, const std::shared_ptr<const Aws::Http::HttpRequest>& request) const override;
+
+            void OnRequestSucceeded(const Aws::String& serviceName, const Aws::String& requestName, const std::shared_ptr<const Aws::Http::HttpRequest>& request,
+                const Aws::Client::HttpResponseOutcome& outcome, const CoreMetricsCollection& metricsFromCore, void* context) const override;
+
+            void OnRequestFailed(const Aws::String& serviceName, const Aws::String& requestName, const std::shared_ptr<const Aws::Http::HttpRequest>& request,
+                const Aws::Client::HttpResponseOutcome& outcome, const CoreMetricsCollection& metricsFromCore, void* context) const override;
+
+            void OnRequestRetry(const Aws::String& serviceName, const Aws::String& requestName,
+                const std::shared_ptr<const Aws::Http::HttpRequest>& request, void* context) const override;
+
+            void OnFinish(const Aws::String& serviceName, const Aws::String& requestName,
+                const std::shared_ptr<const Aws::Http::HttpRequest>& request, void* context) const override;
+
+            inline const std::shared_ptr<LatencyHistograms>& GetHistograms() const { return m_histograms; }
+
+        private:
+            void RecordAttempt(const Aws::String& serviceName, const Aws::String& requestName,
+                const Aws::Client::HttpResponseOutcome& outcome, const CoreMetricsCollection& metricsFromCore, void* context) const;
+
+            std::shared_ptr<LatencyHistograms> m_histograms;
+        };
+
+        /**
+         * Creates HistogramMonitoring instances recording into the same histograms, for SDKOptions::monitoringOptions:
+         *
+         *     auto histograms = Aws::MakeShared<Aws::Monitoring::LatencyHistograms>(ALLOCATION_TAG);
+         *     options.monitoringOptions.customizedMonitoringFactory_create_fn.push_back([histograms]() {
+         *         return Aws::MakeUnique<Aws::Monitoring::HistogramMonitoringFactory>(ALLOCATION_TAG, histograms); });
+         */
+        class AWS_CORE_API HistogramMonitoringFactory : public MonitoringFactory
+        {
+        public:
+            HistogramMonitoringFactory(const std::shared_ptr<LatencyHistograms>& histograms) : m_histograms(histograms) {}
+
+            Aws::UniquePtr<MonitoringInterface> CreateMonitoringInstance() const override;
+
+        private:
+            std::shared_ptr<LatencyHistograms> m_histograms;
+        };
+    } // namespace Monitoring
+} // namespace Aws
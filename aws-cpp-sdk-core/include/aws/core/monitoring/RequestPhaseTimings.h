@@ -0,0 +1,122 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#pragma once
+#include <aws/core/Core_EXPORTS.h>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+namespace Aws
+{
+    namespace Monitoring
+    {
+        /**
+         * Phases of one attempt of a request.
+         */
+        enum class RequestPhase
+        {
+            /**
+             * Building the http request from the service request, payload included.
+             */
+            Serialization = 0,
+
+            /**
+             * Creating the http request for the endpoint uri the service client computed.
+             */
+            EndpointResolution,
+
+            /**
+             * Signing the http request.
+             */
+            Signing,
+
+            /**
+             * Getting a connection from the http client's pool, plus DNS lookup, TCP and TLS handshakes when it is a new one.
+             */
+            AcquireConnection,
+
+            /**
+             * Sending the request line, headers and body.
+             */
+            Send,
+
+            /**
+             * From the end of the request to the first byte of the response.
+             */
+            TimeToFirstByte,
+
+            /**
+             * From the first byte of the response to its last.
+             */
+            ReceiveBody,
+
+            /**
+             * Parsing the response of a successful attempt, or the error in the response of a failed one.
+             */
+            ResponseParsing,
+
+            /**
+             * Waiting before this attempt after the previous one failed.
+             */
+            RetryBackoff
+        };
+
+        static const size_t REQUEST_PHASE_COUNT = static_cast<size_t>(RequestPhase::RetryBackoff) + 1;
+
+        /**
+         * "Serialization", "EndpointResolution", ... for the phase.
+         */
+        AWS_CORE_API const char* GetRequestPhaseName(RequestPhase phase);
+
+        /**
+         * Time spent in each phase of one attempt, measured with a monotonic clock. Phases the http client in use does not
+         * report, and phases the attempt never got to, are not recorded.
+         */
+        class AWS_CORE_API RequestPhaseTimings
+        {
+        public:
+            RequestPhaseTimings() { Reset(); }
+
+            /**
+             * Adds duration to the time spent in phase.
+             */
+            inline void Add(RequestPhase phase, std::chrono::steady_clock::duration duration)
+            {
+                size_t index = static_cast<size_t>(phase);
+                m_nanoseconds[index] += std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count();
+                m_recorded |= 1u << index;
+            }
+
+            inline bool WasRecorded(RequestPhase phase) const { return (m_recorded & (1u << static_cast<size_t>(phase))) != 0; }
+
+            inline std::chrono::nanoseconds Get(RequestPhase phase) const { return std::chrono::nanoseconds(m_nanoseconds[static_cast<size_t>(phase)]); }
+
+            inline void Reset()
+            {
+                for (size_t i = 0; i < REQUEST_PHASE_COUNT; ++i)
+                {
+                    m_nanoseconds[i] = 0;
+                }
+                m_recorded = 0;
+            }
+
+        private:
+            int64_t m_nanoseconds[REQUEST_PHASE_COUNT];
+            uint32_t m_recorded;
+        };
+    } // namespace Monitoring
+} // namespace Aws
@@ -0,0 +1,166 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+
+#include <aws/core/utils/memory/stl/AWSVector.h>
+
+#include <atomic>
+#include <mutex>
+#include <cstddef>
+
+namespace Aws
+{
+    namespace Utils
+    {
+        /**
+         * Cache of byte buffers in power of two sizes, from MIN_POOLED_SIZE up to a configurable maximum, so buffers that are
+         * allocated and dropped for every request (stream buffers, scratch space) are reused instead of going back to the
+         * allocator each time.
+         *
+         * Every size keeps at most as many buffers as were in use at once during the last trim interval, and the pool as a
+         * whole at most maxRetainedBytes. Buffers are plain Aws::Malloc allocations, so one acquired without a pool can be
+         * released to it; the pool only counts and caches buffers it handed out itself, and frees any other.
+         */
+        class AWS_CORE_API BufferPool
+        {
+        public:
+            static const size_t MIN_POOLED_SIZE = 256;
+
+            /**
+             * Buffers larger than maxPooledSize are never kept. trimInterval is the number of releases of one size after
+             * which its cache is trimmed down to what was used since the previous trim.
+             */
+            BufferPool(size_t maxRetainedBytes, size_t maxPooledSize = 1024 * 1024, size_t trimInterval = 1024);
+            ~BufferPool();
+
+            BufferPool(const BufferPool&) = delete;
+            BufferPool& operator=(const BufferPool&) = delete;
+
+            /**
+             * Buffer of at least size bytes, its actual size is written to capacity.
+             */
+            char* Acquire(size_t size, size_t& capacity);
+
+            /**
+             * Hands back a buffer with the capacity Acquire reported for it.
+             */
+            void Release(char* buffer, size_t capacity);
+
+            /**
+             * Frees every cached buffer beyond the number in use since the last trim.
+             */
+            void Trim();
+
+            /**
+             * Frees every cached buffer.
+             */
+            void Clear();
+
+            inline size_t GetRetainedBytes() const { return m_retainedBytes.load(std::memory_order_relaxed); }
+
+        private:
+            struct Bucket
+            {
+                Bucket() : windowPeak(0), highWater(0), releasesSinceTrim(0) {}
+
+                std::mutex lock;
+                Aws::Vector<char*> cached;
+                Aws::Vector<char*> inUse;
+                size_t windowPeak;
+                size_t highWater;
+                size_t releasesSinceTrim;
+            };
+
+            size_t GetBucketIndex(size_t size) const;
+            void MarkInUse(Bucket& bucket, char* buffer);
+            void TrimBucket(Bucket& bucket, size_t bucketSize);
+
+            size_t m_maxRetainedBytes;
+            size_t m_maxPooledSize;
+            size_t m_trimInterval;
+            size_t m_bucketCount;
+            Bucket* m_buckets;
+            std::atomic<size_t> m_retainedBytes;
+        };
+
+        /**
+         * Buffer of at least size bytes from the pool installed by InitAPI, or straight from Aws::Malloc when there is none.
+         */
+        AWS_CORE_API char* AcquireBuffer(size_t size, size_t& capacity);
+
+        /**
+         * Gives back a buffer obtained from AcquireBuffer.
+         */
+        AWS_CORE_API void ReleaseBuffer(char* buffer, size_t capacity);
+
+        /**
+         * Owns a buffer obtained from AcquireBuffer for its lifetime.
+         */
+        class AWS_CORE_API PooledBuffer
+        {
+        public:
+            PooledBuffer() : m_data(nullptr), m_capacity(0) {}
+            explicit PooledBuffer(size_t size) : m_data(nullptr), m_capacity(0) { m_data = AcquireBuffer(size, m_capacity); }
+            PooledBuffer(PooledBuffer&& toMove) : m_data(toMove.m_data), m_capacity(toMove.m_capacity)
+            {
+                toMove.m_data = nullptr;
+                toMove.m_capacity = 0;
+            }
+            ~PooledBuffer() { ReleaseBuffer(m_data, m_capacity); }
+
+            PooledBuffer(const PooledBuffer&) = delete;
+            PooledBuffer& operator=(const PooledBuffer&) = delete;
+
+            PooledBuffer& operator=(PooledBuffer&& toMove)
+            {
+                if (this != &toMove)
+                {
+                    ReleaseBuffer(m_data, m_capacity);
+                    m_data = toMove.m_data;
+                    m_capacity = toMove.m_capacity;
+                    toMove.m_data = nullptr;
+                    toMove.m_capacity = 0;
+                }
+                return *this;
+            }
+
+            inline char* GetData() const { return m_data; }
+            inline size_t GetCapacity() const { return m_capacity; }
+
+        private:
+            char* m_data;
+            size_t m_capacity;
+        };
+
+        /**
+         * Pool installed by InitAPI, nullptr when buffer pooling is off.
+         */
+        AWS_CORE_API BufferPool* GetBufferPool();
+
+        /**
+         * Installs a pool retaining up to maxRetainedBytes. This should only be called once from within Aws::InitAPI.
+         */
+        AWS_CORE_API void InitializeBufferPool(size_t maxRetainedBytes);
+
+        /**
+         * Destroys the installed pool. This should only be called once from within Aws::ShutdownAPI.
+         */
+        AWS_CORE_API void CleanupBufferPool();
+
+    } // namespace Utils
+} // namespace Aws
@@ -63,6 +63,11 @@ namespace Aws
         class AWS_CORE_API DateTime
         {
         public:
+            /**
+             * Size of a buffer that holds any timestamp formatted in a predefined format, including the terminating null.
+             */
+            static const size_t MAX_GMT_STRING_LENGTH = 64;
+
             /**
              *  Initializes time point to epoch
              */
@@ -143,6 +148,13 @@ namespace Aws
             */
             Aws::String ToGmtString(DateFormat format) const;
 
+            /**
+             * Convert dateTime to GMT time string using predefined format, written into buffer without allocating.
+             * Returns the length of the string, not counting the terminating null, or 0 if buffer is too small.
+             * A buffer of MAX_GMT_STRING_LENGTH always fits.
+             */
+            size_t ToGmtString(DateFormat format, char* buffer, size_t bufferSize) const;
+
             /**
             * Convert dateTime to GMT time string using arbitrary format.
             */
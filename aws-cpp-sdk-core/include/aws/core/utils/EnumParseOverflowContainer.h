@@ -15,10 +15,11 @@
 
 #pragma once
 
-#include <aws/core/utils/memory/stl/AWSMap.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/core/Core_EXPORTS.h>
-#include <aws/core/utils/threading/ReaderWriterLock.h>
+
+#include <atomic>
+#include <mutex>
 
 namespace Aws
 {
@@ -28,16 +29,50 @@ namespace Aws
          * This container is for storing unknown enum values that are encountered during parsing.
          * This is to work around the round-tripping enums problem. It's really just a simple thread-safe
          * hashmap.
+         *
+         * Entries are only ever prepended to their bucket and never removed, so lookups walk the buckets without taking
+         * a lock. Only storing a value the container has not seen yet serializes on a mutex.
          */
         class AWS_CORE_API EnumParseOverflowContainer
         {
         public:
+            EnumParseOverflowContainer();
+            ~EnumParseOverflowContainer();
+
+            EnumParseOverflowContainer(const EnumParseOverflowContainer&) = delete;
+            EnumParseOverflowContainer& operator=(const EnumParseOverflowContainer&) = delete;
+
             const Aws::String& RetrieveOverflow(int hashCode) const;
             void StoreOverflow(int hashCode, const Aws::String& value);
 
         private:
-            mutable Aws::Utils::Threading::ReaderWriterLock m_overflowLock;
-            Aws::Map<int, Aws::String> m_overflowMap;
+            struct Value
+            {
+                Value(const Aws::String& str, Value* nextValue) : value(str), next(nextValue) {}
+
+                Aws::String value;
+                Value* next;
+            };
+
+            //one entry per hash code, holding every value stored for it; current is the one stored last.
+            struct Entry
+            {
+                Entry(int code, Value* firstValue, Entry* nextEntry) : hashCode(code), current(firstValue), values(firstValue), next(nextEntry) {}
+
+                int hashCode;
+                std::atomic<const Value*> current;
+                Value* values;
+                Entry* next;
+            };
+
+            static const size_t BUCKET_COUNT = 64;
+
+            Entry* FindEntry(int hashCode) const;
+            std::atomic<Entry*>& GetBucket(int hashCode) { return m_buckets[static_cast<unsigned>(hashCode) % BUCKET_COUNT]; }
+            const std::atomic<Entry*>& GetBucket(int hashCode) const { return m_buckets[static_cast<unsigned>(hashCode) % BUCKET_COUNT]; }
+
+            std::atomic<Entry*> m_buckets[BUCKET_COUNT];
+            std::mutex m_storeLock;
             Aws::String m_emptyString;
         };
     }
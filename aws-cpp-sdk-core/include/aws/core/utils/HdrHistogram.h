@@ -0,0 +1,89 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+
+#include <aws/core/utils/memory/stl/AWSVector.h>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace Aws
+{
+    namespace Utils
+    {
+        /**
+         * High dynamic range histogram of non-negative integer values, laid out like HdrHistogram: values are counted in
+         * power of two buckets, each split into linear sub-buckets fine enough to keep significantFigures decimal digits,
+         * so any percentile is reported within that precision no matter how wide the range of recorded values is.
+         *
+         * Counts are only allocated up to the largest value recorded so far. Values above highestTrackableValue are counted
+         * as highestTrackableValue. Not thread safe.
+         */
+        class AWS_CORE_API HdrHistogram
+        {
+        public:
+            /**
+             * significantFigures is clamped to [1, 5].
+             */
+            HdrHistogram(int64_t highestTrackableValue, int significantFigures = 2);
+
+            /**
+             * Counts value count times.
+             */
+            void Record(int64_t value, int64_t count = 1);
+
+            /**
+             * Adds every count of other, which must have been created with the same arguments, to this histogram.
+             */
+            void Add(const HdrHistogram& other);
+
+            /**
+             * Forgets every recorded value.
+             */
+            void Reset();
+
+            /**
+             * Largest value, within the histogram's precision, that percentile percent of the recorded values are at or below.
+             * 0 when nothing was recorded.
+             */
+            int64_t GetValueAtPercentile(double percentile) const;
+
+            inline int64_t GetTotalCount() const { return m_totalCount; }
+            inline int64_t GetMin() const { return m_totalCount ? m_min : 0; }
+            inline int64_t GetMax() const { return m_max; }
+            inline int64_t GetHighestTrackableValue() const { return m_highestTrackableValue; }
+            double GetMean() const;
+
+        private:
+            size_t GetCountsIndex(int64_t value) const;
+            int64_t GetValueFromIndex(size_t index) const;
+            int64_t GetHighestEquivalentValue(int64_t value) const;
+
+            int64_t m_highestTrackableValue;
+            int m_significantFigures;
+            int m_subBucketHalfCountMagnitude;
+            int64_t m_subBucketHalfCount;
+            int64_t m_subBucketMask;
+            Aws::Vector<int64_t> m_counts;
+            int64_t m_totalCount;
+            int64_t m_min;
+            int64_t m_max;
+        };
+
+    } // namespace Utils
+} // namespace Aws
@@ -0,0 +1,100 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <type_traits>
+
+namespace Aws
+{
+    namespace Utils
+    {
+        /**
+         * N boolean flags packed into the smallest unsigned words that hold them, e.g. the HasBeenSet flags of generated
+         * models built with the packed-flags option. Up to 8 flags take a byte, up to 64 flags a single word.
+         * Indexing works like std::bitset, so flags[i] reads a flag and flags[i] = true sets it.
+         */
+        template<size_t N>
+        class PackedFlags
+        {
+            typedef typename std::conditional<N <= 8, uint8_t,
+                typename std::conditional<N <= 16, uint16_t,
+                typename std::conditional<N <= 32, uint32_t, uint64_t>::type>::type>::type Word;
+
+            static const size_t BITS_PER_WORD = sizeof(Word) * 8;
+            static const size_t WORD_COUNT = N == 0 ? 1 : (N + BITS_PER_WORD - 1) / BITS_PER_WORD;
+
+        public:
+            class Reference
+            {
+            public:
+                Reference(Word& word, Word mask) : m_word(word), m_mask(mask) {}
+
+                Reference& operator=(bool value)
+                {
+                    m_word = static_cast<Word>(value ? (m_word | m_mask) : (m_word & ~m_mask));
+                    return *this;
+                }
+
+                Reference& operator=(const Reference& other) { return *this = static_cast<bool>(other); }
+
+                operator bool() const { return (m_word & m_mask) != 0; }
+
+            private:
+                Word& m_word;
+                Word m_mask;
+            };
+
+            PackedFlags() : m_words() {}
+
+            /**
+             * Creates the flags with the flags at the given positions set.
+             */
+            PackedFlags(std::initializer_list<size_t> setFlags) : m_words()
+            {
+                for (size_t pos : setFlags)
+                {
+                    (*this)[pos] = true;
+                }
+            }
+
+            bool operator[](size_t pos) const { return (m_words[pos / BITS_PER_WORD] & Mask(pos)) != 0; }
+            Reference operator[](size_t pos) { return Reference(m_words[pos / BITS_PER_WORD], Mask(pos)); }
+
+            static constexpr size_t size() { return N; }
+
+            bool Any() const
+            {
+                for (Word word : m_words)
+                {
+                    if (word)
+                    {
+                        return true;
+                    }
+                }
+                return false;
+            }
+
+        private:
+            static Word Mask(size_t pos) { return static_cast<Word>(Word(1) << (pos % BITS_PER_WORD)); }
+
+            Word m_words[WORD_COUNT];
+        };
+
+    } // namespace Utils
+} // namespace Aws
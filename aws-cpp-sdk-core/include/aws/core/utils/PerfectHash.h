@@ -0,0 +1,78 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#pragma once
+
+#include <aws/core/utils/memory/stl/AWSString.h>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace Aws
+{
+    namespace Utils
+    {
+        /**
+         * Lookups into the minimal perfect hash tables the code generator emits for enum names.
+         *
+         * Keys are hashed with HashingUtils::HashString and bucketed by hashCode % tableSize. A negative displacement
+         * stores the slot of a bucket's only key directly, otherwise the slot is Mix(hashCode, displacement) % tableSize.
+         * The generator builds the tables with the same functions, the two must be kept in sync.
+         */
+        class PerfectHash
+        {
+        public:
+            static inline uint32_t Mix(uint32_t hashCode, uint32_t displacement)
+            {
+                uint32_t x = hashCode ^ (displacement * 0x9E3779B9u);
+                x ^= x >> 16;
+                x *= 0x85EBCA6Bu;
+                x ^= x >> 13;
+                x *= 0xC2B2AE35u;
+                x ^= x >> 16;
+                return x;
+            }
+
+            static inline size_t FindSlot(int hashCode, const int* displacements, size_t tableSize)
+            {
+                uint32_t unsignedHash = static_cast<uint32_t>(hashCode);
+                int displacement = displacements[unsignedHash % tableSize];
+                if (displacement < 0)
+                {
+                    return static_cast<size_t>(-displacement - 1);
+                }
+
+                return Mix(unsignedHash, static_cast<uint32_t>(displacement)) % tableSize;
+            }
+
+            /**
+             * Returns the value (one based index into names) stored in the slot name hashes to, or 0 if name is not in the table.
+             * The name is always compared in full, so strings colliding with a key are rejected.
+             */
+            static inline int Find(const Aws::String& name, int hashCode, const int* displacements, const int* slotValues,
+                const char* const* names, size_t tableSize)
+            {
+                if (tableSize == 0)
+                {
+                    return 0;
+                }
+
+                int value = slotValues[FindSlot(hashCode, displacements, tableSize)];
+                return name == names[value - 1] ? value : 0;
+            }
+        };
+
+    } // namespace Utils
+} // namespace Aws
@@ -0,0 +1,86 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+
+#include <aws/core/utils/memory/stl/AWSString.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+
+#include <initializer_list>
+#include <memory>
+#include <utility>
+
+namespace Aws
+{
+    namespace Utils
+    {
+        /**
+         * Selects the members of a response that generated deserializers decode; everything else is skipped without
+         * building strings, containers or nested models for it.
+         *
+         * Paths are dot separated model member names, e.g. "Reservations.Instances.InstanceId". The elements of a list
+         * are addressed through the list member itself. Naming a member selects it with everything below it.
+         * An empty mask selects everything, which is what responses are decoded with by default.
+         */
+        class AWS_CORE_API ProjectionMask
+        {
+        public:
+            /**
+             * Creates a mask that selects everything.
+             */
+            ProjectionMask() = default;
+            ProjectionMask(std::initializer_list<const char*> paths);
+
+            /**
+             * Adds a dot separated member path to the selection.
+             */
+            ProjectionMask& AddPath(const Aws::String& path);
+            inline ProjectionMask& WithPath(const Aws::String& path) { return AddPath(path); }
+
+            /**
+             * Returns true if this mask selects everything.
+             */
+            bool SelectsAll() const;
+            /**
+             * Returns true if the member named memberName, or any part of it, is selected.
+             */
+            bool Includes(const char* memberName) const;
+            /**
+             * Mask to decode the member named memberName with. Cheap, the returned mask shares state with this one.
+             */
+            ProjectionMask GetSubMask(const char* memberName) const;
+
+        private:
+            struct Node
+            {
+                Node() : selectsAll(false) {}
+
+                bool selectsAll;
+                Aws::Vector<std::pair<Aws::String, std::shared_ptr<Node>>> children;
+            };
+
+            ProjectionMask(const std::shared_ptr<Node>& root) : m_root(root) {}
+
+            const std::shared_ptr<Node>* FindChild(const char* memberName) const;
+            static std::shared_ptr<Node> CloneNode(const Node& node);
+
+            //null selects everything.
+            std::shared_ptr<Node> m_root;
+        };
+
+    } // namespace Utils
+} // namespace Aws
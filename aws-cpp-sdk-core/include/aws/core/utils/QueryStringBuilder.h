@@ -0,0 +1,84 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+
+#include <aws/core/utils/memory/stl/AWSString.h>
+
+#include <utility>
+
+namespace Aws
+{
+    namespace Utils
+    {
+        /**
+         * Builds the name=value&name=value bodies of query protocol requests in a single buffer, without streams.
+         *
+         * Parameter names are the current location followed by the name passed in. Serializers of nested members push
+         * their part of the name onto the location, e.g. "Entries.member.3", and pop it again when done, so prefixes are
+         * never copied into temporary strings. Values are percent encoded like StringUtils::URLEncode.
+         */
+        class AWS_CORE_API QueryStringBuilder
+        {
+        public:
+            QueryStringBuilder(size_t initialCapacity = 1024);
+
+            /**
+             * Appends location to the current location. Returns the mark to pass to PopLocation.
+             */
+            size_t PushLocation(const char* location);
+            /**
+             * Appends location, index and locationValue to the current location. Returns the mark to pass to PopLocation.
+             */
+            size_t PushLocation(const char* location, unsigned index, const char* locationValue);
+            /**
+             * Restores the location to what it was before the PushLocation call that returned mark.
+             */
+            void PopLocation(size_t mark);
+
+            void AddParameter(const char* name, const char* value);
+            void AddParameter(const char* name, const char* value, size_t valueLength);
+            void AddParameter(const char* name, const Aws::String& value);
+            void AddParameter(const char* name, bool value);
+            void AddParameter(const char* name, int value);
+            void AddParameter(const char* name, long long value);
+            void AddParameter(const char* name, double value);
+
+            /**
+             * Adds a parameter named location.index.locationValue relative to the current location, the form list
+             * and map entries take.
+             */
+            template<typename T>
+            void AddParameter(const char* location, unsigned index, const char* locationValue, const T& value)
+            {
+                size_t mark = PushLocation(location, index, locationValue);
+                AddParameter("", value);
+                PopLocation(mark);
+            }
+
+            const Aws::String& GetQueryString() const { return m_queryString; }
+            Aws::String TakeQueryString() { return std::move(m_queryString); }
+
+        private:
+            void AppendName(const char* name);
+
+            Aws::String m_queryString;
+            Aws::String m_location;
+        };
+
+    } // namespace Utils
+} // namespace Aws
@@ -20,6 +20,7 @@
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/StringView.h>
 
 
 
@@ -40,24 +41,33 @@ namespace Aws
             * Converts a string to lower case.
             */
             static Aws::String ToLower(const char* source);
+            static Aws::String ToLower(StringView source);
 
 
             /**
             * Converts a string to upper case.
             */
             static Aws::String ToUpper(const char* source);
+            static Aws::String ToUpper(StringView source);
 
 
             /**
             * Does a caseless comparison of two strings.
             */
             static bool CaselessCompare(const char* value1, const char* value2);
+            static bool CaselessCompare(StringView value1, StringView value2);
 
 
             /**
             * URL encodes a string (uses %20 not + for spaces).
             */
             static Aws::String URLEncode(const char* unsafe);
+            static Aws::String URLEncode(StringView unsafe);
+
+            /**
+            * URL encodes length bytes of unsafe onto the end of output, the same way URLEncode does.
+            */
+            static void URLEncodeAppend(Aws::String& output, const char* unsafe, size_t length);
 
             /**
             * Http Clients tend to escape some characters but not all. Escaping all of them causes problems, because the client
@@ -103,17 +113,25 @@ namespace Aws
              *  trim from start
              */
             static Aws::String LTrim(const char* source);
+            static Aws::String LTrim(StringView source);
 
 
             /**
              * trim from end
              */
             static Aws::String RTrim(const char* source);
+            static Aws::String RTrim(StringView source);
 
             /**
              * trim from both ends
              */
             static Aws::String Trim(const char* source);
+            static Aws::String Trim(StringView source);
+
+            /**
+             * The part of source left after trimming both ends, without copying it.
+             */
+            static StringView TrimView(StringView source);
 
 
             /**
@@ -0,0 +1,112 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+#include <aws/core/utils/memory/stl/AWSString.h>
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+
+#if defined(_MSVC_LANG) && _MSVC_LANG >= 201703L || __cplusplus >= 201703L
+#include <string_view>
+#define AWS_HAS_STD_STRING_VIEW 1
+#endif
+
+namespace Aws
+{
+    namespace Utils
+    {
+        /**
+         * Non-owning view of a range of characters, for passing literals, Aws::Strings and external buffers to APIs
+         * that only read them without constructing a temporary Aws::String. The viewed characters must outlive the view.
+         *
+         * This is always its own type, so the SDK's signatures do not change with the language standard it is built
+         * with. When std::string_view is available it converts to and from it implicitly.
+         */
+        class StringView
+        {
+        public:
+            typedef const char* const_iterator;
+            typedef const char* iterator;
+            static const size_t npos = static_cast<size_t>(-1);
+
+            StringView() : m_data(""), m_size(0) {}
+            StringView(const char* str) : m_data(str ? str : ""), m_size(str ? std::strlen(str) : 0) {}
+            StringView(const char* data, size_t size) : m_data(data), m_size(size) {}
+
+            template<typename Traits, typename Allocator>
+            StringView(const std::basic_string<char, Traits, Allocator>& str) : m_data(str.data()), m_size(str.size()) {}
+
+#ifdef AWS_HAS_STD_STRING_VIEW
+            StringView(std::string_view str) : m_data(str.data()), m_size(str.size()) {}
+            operator std::string_view() const { return std::string_view(m_data, m_size); }
+#endif
+
+            inline const char* data() const { return m_data; }
+            inline size_t size() const { return m_size; }
+            inline size_t length() const { return m_size; }
+            inline bool empty() const { return m_size == 0; }
+
+            inline const_iterator begin() const { return m_data; }
+            inline const_iterator end() const { return m_data + m_size; }
+
+            inline char operator[](size_t index) const { return m_data[index]; }
+            inline char front() const { return m_data[0]; }
+            inline char back() const { return m_data[m_size - 1]; }
+
+            inline void remove_prefix(size_t count) { m_data += count; m_size -= count; }
+            inline void remove_suffix(size_t count) { m_size -= count; }
+
+            /**
+             * Up to count characters starting at pos. pos must not be past the end.
+             */
+            inline StringView substr(size_t pos, size_t count = npos) const
+            {
+                return StringView(m_data + pos, (std::min)(count, m_size - pos));
+            }
+
+            inline int compare(StringView other) const
+            {
+                int result = std::memcmp(m_data, other.m_data, (std::min)(m_size, other.m_size));
+                if (result != 0)
+                {
+                    return result;
+                }
+                return m_size < other.m_size ? -1 : (m_size > other.m_size ? 1 : 0);
+            }
+
+            /**
+             * Copies the viewed characters into a new Aws::String.
+             */
+            inline Aws::String ToString() const { return Aws::String(m_data, m_size); }
+
+        private:
+            const char* m_data;
+            size_t m_size;
+        };
+
+        inline bool operator==(StringView lhs, StringView rhs)
+        {
+            return lhs.size() == rhs.size() && std::memcmp(lhs.data(), rhs.data(), lhs.size()) == 0;
+        }
+
+        inline bool operator!=(StringView lhs, StringView rhs) { return !(lhs == rhs); }
+        inline bool operator<(StringView lhs, StringView rhs) { return lhs.compare(rhs) < 0; }
+
+    } // namespace Utils
+} // namespace Aws
@@ -36,6 +36,8 @@ namespace Aws
 
             /**
              * You need to call this before using any of the cryptography libs. Should be called after setting the factories.
+             * Installs the default factories only; the static state of the factories is initialized the first time an
+             * implementation is created.
              */
             AWS_CORE_API void InitCrypto();
             /**
@@ -21,6 +21,7 @@
 #include <aws/core/utils/memory/stl/AWSStreamFwd.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/core/utils/memory/stl/AWSMap.h>
+#include <aws/core/utils/StringView.h>
 #include <aws/core/external/cjson/cJSON.h>
 
 #include <utility>
@@ -90,11 +91,15 @@ namespace Aws
                  */
                 JsonValue& WithString(const Aws::String& key, const Aws::String& value);
                 JsonValue& WithString(const char* key, const Aws::String& value);
+                JsonValue& WithString(const char* key, const char* value);
+                JsonValue& WithString(const char* key, Aws::Utils::StringView value);
 
                 /**
                  * Converts the current JSON node to a string.
                  */
                 JsonValue& AsString(const Aws::String& value);
+                JsonValue& AsString(const char* value);
+                JsonValue& AsString(Aws::Utils::StringView value);
 
                 /**
                  * Adds a bool value with key to the top level of this node.
@@ -25,6 +25,7 @@ namespace Aws
         namespace Logging
         {
             class LogSystemInterface;
+            enum class LogLevel : int;
 
             // Standard interface
 
@@ -43,6 +44,35 @@ namespace Aws
              */
             AWS_CORE_API LogSystemInterface* GetLogSystem();
 
+            /**
+             * Logs statements with the given tag up to logLevel, whatever the level of the log system. For example,
+             * SetLogLevelForTag("CurlHttpClient", LogLevel::Trace) with a log system at LogLevel::Warn traces the http client
+             * alone, and SetLogLevelForTag("AWSClient", LogLevel::Error) quiets one subsystem of a log system at Info.
+             */
+            AWS_CORE_API void SetLogLevelForTag(const char* tag, LogLevel logLevel);
+
+            /**
+             * Statements with the given tag go back to following the level of the log system.
+             */
+            AWS_CORE_API void ResetLogLevelForTag(const char* tag);
+
+            /**
+             * Every tag goes back to following the level of the log system.
+             */
+            AWS_CORE_API void ResetTagLogLevels();
+
+            /**
+             * Whether a statement at logLevel with the given tag is to be logged, by the tag's level if one was set and
+             * logSystem's otherwise. This is what the logging macros check; the tag's level is looked up once and cached
+             * until the tag levels change again.
+             */
+            AWS_CORE_API bool IsLogLevelEnabled(LogSystemInterface* logSystem, LogLevel logLevel, const char* tag);
+
+            /**
+             * Frees the tag levels. This should only be called once from within Aws::ShutdownAPI, when nothing is logging.
+             */
+            AWS_CORE_API void CleanupTagLogLevels();
+
             // Testing interface
 
             /**
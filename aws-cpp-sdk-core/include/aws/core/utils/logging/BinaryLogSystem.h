@@ -0,0 +1,171 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+
+#include <aws/core/utils/logging/LogSystemInterface.h>
+#include <aws/core/utils/logging/LogLevel.h>
+#include <aws/core/utils/memory/stl/AWSString.h>
+#include <aws/core/utils/memory/stl/AWSStreamFwd.h>
+
+#include <thread>
+#include <memory>
+#include <mutex>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+
+namespace Aws
+{
+    namespace Utils
+    {
+        namespace Logging
+        {
+            struct ThreadLogBuffer;
+
+            /**
+             * Logger that leaves formatting to whoever reads the log. A logging thread only copies the level, a timestamp,
+             * the ids of the tag and format string and the raw printf arguments into a buffer of its own; a background thread
+             * writes those buffers out as they are, along with the text of every tag and format string the first time it is
+             * used. BinaryLogDecoder (and the aws-cpp-sdk-binary-log-decoder tool) turn the result into the same text
+             * FormattedLogSystem writes.
+             *
+             * Format strings are recognized by address alone, so they are expected to be string literals or otherwise live,
+             * unchanged, as long as the log system, as they are everywhere in the SDK. Every other address takes one of a
+             * fixed number of string ids; once those run out, messages are formatted as text when they are logged. Tags are
+             * recognized by address and text, since some are kept in strings that come and go. Messages from LogStream are
+             * copied as text.
+             *
+             * When a thread's buffer is full, its messages are dropped and counted rather than waiting for the background
+             * thread; the count is written to the log.
+             */
+            class AWS_CORE_API BinaryLogSystem : public LogSystemInterface
+            {
+            public:
+                /**
+                 * Writes to the supplied stream, which should be opened in binary mode. threadBufferSize is the size of each
+                 * logging thread's buffer, rounded up to a power of two.
+                 */
+                BinaryLogSystem(LogLevel logLevel, const std::shared_ptr<Aws::OStream>& logFile, size_t threadBufferSize = 256 * 1024);
+
+                /**
+                 * Writes to filenamePrefix + "timestamp.blog", rolled every hour like DefaultLogSystem.
+                 */
+                BinaryLogSystem(LogLevel logLevel, const Aws::String& filenamePrefix, size_t threadBufferSize = 256 * 1024);
+
+                virtual ~BinaryLogSystem();
+
+                BinaryLogSystem(const BinaryLogSystem&) = delete;
+                BinaryLogSystem& operator=(const BinaryLogSystem&) = delete;
+
+                /**
+                 * Gets the currently configured log level.
+                 */
+                virtual LogLevel GetLogLevel(void) const override { return m_logLevel; }
+
+                /**
+                 * Set a new log level. This has the immediate effect of changing the log output to the new level.
+                 */
+                void SetLogLevel(LogLevel logLevel) { m_logLevel.store(logLevel); }
+
+                /**
+                 * Records the format string's id and the arguments, to be formatted when the log is decoded.
+                 */
+                virtual void Log(LogLevel logLevel, const char* tag, const char* formatStr, ...) override;
+
+                /**
+                 * Records the text of the stream.
+                 */
+                virtual void LogStream(LogLevel logLevel, const char* tag, const Aws::OStringStream &messageStream) override;
+
+                /**
+                 * Writes out everything logged so far and flushes the output.
+                 */
+                void Flush();
+
+                /**
+                 * Number of messages discarded because their thread's buffer was full.
+                 */
+                inline uint64_t GetDroppedMessageCount() const { return m_droppedMessages.load(std::memory_order_relaxed); }
+
+            private:
+                friend class ThreadLogBufferHolder;
+                struct StringEntry;
+
+                void Start();
+                ThreadLogBuffer* GetThreadBuffer();
+                void RetireThreadBuffer(ThreadLogBuffer* buffer);
+                uint32_t InternString(const char* str, bool compareText);
+                char* Reserve(ThreadLogBuffer* buffer, size_t size);
+                void Commit(ThreadLogBuffer* buffer);
+                void LogText(LogLevel logLevel, const char* tag, const char* text, size_t length);
+                void WriteBuffers();
+                void LoggingThread();
+
+                std::atomic<LogLevel> m_logLevel;
+                std::shared_ptr<Aws::OStream> m_logFile;
+                Aws::String m_filenamePrefix;
+                size_t m_threadBufferSize;
+                uint64_t m_id;
+
+                //tag and format strings by address, filled in under m_stringLock and read without it.
+                StringEntry* m_stringTable;
+                const char** m_strings;
+                const unsigned char** m_signatures;
+                std::atomic<uint32_t> m_stringCount;
+                std::mutex m_stringLock;
+
+                //every thread buffer, guarded by m_bufferLock.
+                std::mutex m_bufferLock;
+                ThreadLogBuffer* m_buffers;
+                uint32_t m_nextThreadIndex;
+
+                //only touched by the writer, under m_writeLock.
+                std::mutex m_writeLock;
+                uint32_t m_writtenStringCount;
+                uint64_t m_reportedDroppedMessages;
+                int32_t m_lastRolledHour;
+
+                std::atomic<uint64_t> m_droppedMessages;
+                std::atomic<bool> m_flushRequested;
+                std::atomic<bool> m_stopLogging;
+                std::mutex m_signalLock;
+                std::condition_variable m_signal;
+                std::thread m_loggingThread;
+
+                //every live binary log system, so exiting threads can tell whether their buffer's owner still exists.
+                BinaryLogSystem* m_nextLive;
+            };
+
+            /**
+             * Turns the output of a BinaryLogSystem back into text.
+             */
+            class AWS_CORE_API BinaryLogDecoder
+            {
+            public:
+                /**
+                 * Writes one line per message of the binary log in input to output, in the format FormattedLogSystem uses.
+                 * Returns false if input is not a binary log or ends in the middle of a record; everything before that point
+                 * is still written.
+                 */
+                static bool Decode(Aws::IStream& input, Aws::OStream& output);
+            };
+
+        } // namespace Logging
+    } // namespace Utils
+} // namespace Aws
@@ -27,6 +27,12 @@
 //  (1) Can be compiled out completely, so you don't even have to pay the cost to check the log level (which will be a virtual function call and a std::atomic<> read) if you don't want any AWS logging
 //  (2) If you use logging and the log statement doesn't pass the conditional log filter level, not only do you not pay the cost of building the log string, you don't pay the cost for allocating or
 //      getting any of the values used in building the log string, as they're in a scope (if-statement) that never gets entered.
+//  (3) Statements more verbose than AWS_MINIMUM_LOG_LEVEL (the MINIMUM_LOG_LEVEL cmake option) are compiled out, whatever the log level at runtime.
+
+// The most verbose level compiled in, as the value of its LogLevel: 1 (Fatal) up to 6 (Trace, everything).
+#ifndef AWS_MINIMUM_LOG_LEVEL
+    #define AWS_MINIMUM_LOG_LEVEL 6
+#endif
 
 #ifdef DISABLE_AWS_LOGGING
 
@@ -51,141 +57,69 @@
     #define AWS_LOG(level, tag, ...) \
         { \
             Aws::Utils::Logging::LogSystemInterface* logSystem = Aws::Utils::Logging::GetLogSystem(); \
-            if ( logSystem && logSystem->GetLogLevel() >= level ) \
+            if ( static_cast<int>(level) <= AWS_MINIMUM_LOG_LEVEL && logSystem && Aws::Utils::Logging::IsLogLevelEnabled(logSystem, level, tag) ) \
             { \
                 logSystem->Log(level, tag, __VA_ARGS__); \
             } \
         }
 
-    #define AWS_LOG_FATAL(tag, ...) \
-        { \
-            Aws::Utils::Logging::LogSystemInterface* logSystem = Aws::Utils::Logging::GetLogSystem(); \
-            if ( logSystem && logSystem->GetLogLevel() >= Aws::Utils::Logging::LogLevel::Fatal ) \
-            { \
-                logSystem->Log(Aws::Utils::Logging::LogLevel::Fatal, tag, __VA_ARGS__); \
-            } \
-        }
-
-    #define AWS_LOG_ERROR(tag, ...) \
-        { \
-            Aws::Utils::Logging::LogSystemInterface* logSystem = Aws::Utils::Logging::GetLogSystem(); \
-            if ( logSystem && logSystem->GetLogLevel() >= Aws::Utils::Logging::LogLevel::Error ) \
-            { \
-                logSystem->Log(Aws::Utils::Logging::LogLevel::Error, tag, __VA_ARGS__); \
-            } \
-        }
-
-    #define AWS_LOG_WARN(tag, ...) \
-        { \
-            Aws::Utils::Logging::LogSystemInterface* logSystem = Aws::Utils::Logging::GetLogSystem(); \
-            if ( logSystem && logSystem->GetLogLevel() >= Aws::Utils::Logging::LogLevel::Warn ) \
-            { \
-                logSystem->Log(Aws::Utils::Logging::LogLevel::Warn, tag, __VA_ARGS__); \
-            } \
-        }
-
-    #define AWS_LOG_INFO(tag, ...) \
-        { \
-            Aws::Utils::Logging::LogSystemInterface* logSystem = Aws::Utils::Logging::GetLogSystem(); \
-            if ( logSystem && logSystem->GetLogLevel() >= Aws::Utils::Logging::LogLevel::Info ) \
-            { \
-                logSystem->Log(Aws::Utils::Logging::LogLevel::Info, tag, __VA_ARGS__); \
-            } \
-        }
-
-    #define AWS_LOG_DEBUG(tag, ...) \
-        { \
-            Aws::Utils::Logging::LogSystemInterface* logSystem = Aws::Utils::Logging::GetLogSystem(); \
-            if ( logSystem && logSystem->GetLogLevel() >= Aws::Utils::Logging::LogLevel::Debug ) \
-            { \
-                logSystem->Log(Aws::Utils::Logging::LogLevel::Debug, tag, __VA_ARGS__); \
-            } \
-        }
-
-    #define AWS_LOG_TRACE(tag, ...) \
-        { \
-            Aws::Utils::Logging::LogSystemInterface* logSystem = Aws::Utils::Logging::GetLogSystem(); \
-            if ( logSystem && logSystem->GetLogLevel() >= Aws::Utils::Logging::LogLevel::Trace ) \
-            { \
-                logSystem->Log(Aws::Utils::Logging::LogLevel::Trace, tag, __VA_ARGS__); \
-            } \
-        }
-
     #define AWS_LOGSTREAM(level, tag, streamExpression) \
         { \
             Aws::Utils::Logging::LogSystemInterface* logSystem = Aws::Utils::Logging::GetLogSystem(); \
-            if ( logSystem && logSystem->GetLogLevel() >= level ) \
-            { \
-                Aws::OStringStream logStream; \
-                logStream << streamExpression; \
-                logSystem->LogStream( logLevel, tag, logStream ); \
-            } \
-        }
-
-    #define AWS_LOGSTREAM_FATAL(tag, streamExpression) \
-        { \
-            Aws::Utils::Logging::LogSystemInterface* logSystem = Aws::Utils::Logging::GetLogSystem(); \
-            if ( logSystem && logSystem->GetLogLevel() >= Aws::Utils::Logging::LogLevel::Fatal ) \
-            { \
-                Aws::OStringStream logStream; \
-                logStream << streamExpression; \
-                logSystem->LogStream( Aws::Utils::Logging::LogLevel::Fatal, tag, logStream ); \
-            } \
-        }
-
-    #define AWS_LOGSTREAM_ERROR(tag, streamExpression) \
-        { \
-            Aws::Utils::Logging::LogSystemInterface* logSystem = Aws::Utils::Logging::GetLogSystem(); \
-            if ( logSystem && logSystem->GetLogLevel() >= Aws::Utils::Logging::LogLevel::Error ) \
-            { \
-                Aws::OStringStream logStream; \
-                logStream << streamExpression; \
-                logSystem->LogStream( Aws::Utils::Logging::LogLevel::Error, tag, logStream ); \
-            } \
-        }
-
-    #define AWS_LOGSTREAM_WARN(tag, streamExpression) \
-        { \
-            Aws::Utils::Logging::LogSystemInterface* logSystem = Aws::Utils::Logging::GetLogSystem(); \
-            if ( logSystem && logSystem->GetLogLevel() >= Aws::Utils::Logging::LogLevel::Warn ) \
-            { \
-                Aws::OStringStream logStream; \
-                logStream << streamExpression; \
-                logSystem->LogStream( Aws::Utils::Logging::LogLevel::Warn, tag, logStream ); \
-            } \
-        }
-
-    #define AWS_LOGSTREAM_INFO(tag, streamExpression) \
-        { \
-            Aws::Utils::Logging::LogSystemInterface* logSystem = Aws::Utils::Logging::GetLogSystem(); \
-            if ( logSystem && logSystem->GetLogLevel() >= Aws::Utils::Logging::LogLevel::Info ) \
+            if ( static_cast<int>(level) <= AWS_MINIMUM_LOG_LEVEL && logSystem && Aws::Utils::Logging::IsLogLevelEnabled(logSystem, level, tag) ) \
             { \
                 Aws::OStringStream logStream; \
                 logStream << streamExpression; \
-                logSystem->LogStream( Aws::Utils::Logging::LogLevel::Info, tag, logStream ); \
+                logSystem->LogStream( level, tag, logStream ); \
             } \
         }
 
-    #define AWS_LOGSTREAM_DEBUG(tag, streamExpression) \
-        { \
-            Aws::Utils::Logging::LogSystemInterface* logSystem = Aws::Utils::Logging::GetLogSystem(); \
-            if ( logSystem && logSystem->GetLogLevel() >= Aws::Utils::Logging::LogLevel::Debug ) \
-            { \
-                Aws::OStringStream logStream; \
-                logStream << streamExpression; \
-                logSystem->LogStream( Aws::Utils::Logging::LogLevel::Debug, tag, logStream ); \
-            } \
-        }
-
-    #define AWS_LOGSTREAM_TRACE(tag, streamExpression) \
-        { \
-            Aws::Utils::Logging::LogSystemInterface* logSystem = Aws::Utils::Logging::GetLogSystem(); \
-            if ( logSystem && logSystem->GetLogLevel() >= Aws::Utils::Logging::LogLevel::Trace ) \
-            { \
-                Aws::OStringStream logStream; \
-                logStream << streamExpression; \
-                logSystem->LogStream( Aws::Utils::Logging::LogLevel::Trace, tag, logStream ); \
-            } \
-        }
+    #if AWS_MINIMUM_LOG_LEVEL >= 1
+        #define AWS_LOG_FATAL(tag, ...) AWS_LOG(Aws::Utils::Logging::LogLevel::Fatal, tag, __VA_ARGS__)
+        #define AWS_LOGSTREAM_FATAL(tag, streamExpression) AWS_LOGSTREAM(Aws::Utils::Logging::LogLevel::Fatal, tag, streamExpression)
+    #else
+        #define AWS_LOG_FATAL(tag, ...)
+        #define AWS_LOGSTREAM_FATAL(tag, streamExpression)
+    #endif
+
+    #if AWS_MINIMUM_LOG_LEVEL >= 2
+        #define AWS_LOG_ERROR(tag, ...) AWS_LOG(Aws::Utils::Logging::LogLevel::Error, tag, __VA_ARGS__)
+        #define AWS_LOGSTREAM_ERROR(tag, streamExpression) AWS_LOGSTREAM(Aws::Utils::Logging::LogLevel::Error, tag, streamExpression)
+    #else
+        #define AWS_LOG_ERROR(tag, ...)
+        #define AWS_LOGSTREAM_ERROR(tag, streamExpression)
+    #endif
+
+    #if AWS_MINIMUM_LOG_LEVEL >= 3
+        #define AWS_LOG_WARN(tag, ...) AWS_LOG(Aws::Utils::Logging::LogLevel::Warn, tag, __VA_ARGS__)
+        #define AWS_LOGSTREAM_WARN(tag, streamExpression) AWS_LOGSTREAM(Aws::Utils::Logging::LogLevel::Warn, tag, streamExpression)
+    #else
+        #define AWS_LOG_WARN(tag, ...)
+        #define AWS_LOGSTREAM_WARN(tag, streamExpression)
+    #endif
+
+    #if AWS_MINIMUM_LOG_LEVEL >= 4
+        #define AWS_LOG_INFO(tag, ...) AWS_LOG(Aws::Utils::Logging::LogLevel::Info, tag, __VA_ARGS__)
+        #define AWS_LOGSTREAM_INFO(tag, streamExpression) AWS_LOGSTREAM(Aws::Utils::Logging::LogLevel::Info, tag, streamExpression)
+    #else
+        #define AWS_LOG_INFO(tag, ...)
+        #define AWS_LOGSTREAM_INFO(tag, streamExpression)
+    #endif
+
+    #if AWS_MINIMUM_LOG_LEVEL >= 5
+        #define AWS_LOG_DEBUG(tag, ...) AWS_LOG(Aws::Utils::Logging::LogLevel::Debug, tag, __VA_ARGS__)
+        #define AWS_LOGSTREAM_DEBUG(tag, streamExpression) AWS_LOGSTREAM(Aws::Utils::Logging::LogLevel::Debug, tag, streamExpression)
+    #else
+        #define AWS_LOG_DEBUG(tag, ...)
+        #define AWS_LOGSTREAM_DEBUG(tag, streamExpression)
+    #endif
+
+    #if AWS_MINIMUM_LOG_LEVEL >= 6
+        #define AWS_LOG_TRACE(tag, ...) AWS_LOG(Aws::Utils::Logging::LogLevel::Trace, tag, __VA_ARGS__)
+        #define AWS_LOGSTREAM_TRACE(tag, streamExpression) AWS_LOGSTREAM(Aws::Utils::Logging::LogLevel::Trace, tag, streamExpression)
+    #else
+        #define AWS_LOG_TRACE(tag, ...)
+        #define AWS_LOGSTREAM_TRACE(tag, streamExpression)
+    #endif
 
 #endif // DISABLE_AWS_LOGGING
@@ -0,0 +1,126 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+
+#include <aws/core/utils/logging/FormattedLogSystem.h>
+#include <aws/core/utils/logging/LogLevel.h>
+#include <aws/core/utils/memory/stl/AWSString.h>
+#include <aws/core/utils/memory/stl/AWSStreamFwd.h>
+
+#include <thread>
+#include <memory>
+#include <mutex>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+
+namespace Aws
+{
+    namespace Utils
+    {
+        namespace Logging
+        {
+            class RingBufferLogSink;
+
+            /**
+             * What a thread logging into a full RingBufferLogSystem does.
+             */
+            enum class LogOverflowPolicy
+            {
+                Drop,  //the message is counted as dropped and discarded
+                Block  //the thread waits until the logging thread has made room
+            };
+
+            /**
+             * Logger for busy multi-threaded processes. Logging threads hand their messages to a bounded lock-free
+             * queue instead of contending on a mutex, and a background thread writes them out in batches: with one writev
+             * call per batch when writing to a file on POSIX, or one write per batch to a stream.
+             *
+             * When the queue is full, messages are either dropped and counted, or the logging thread waits for room,
+             * depending on the overflow policy. The number of dropped messages is reported in the log itself as well.
+             *
+             * InitAPI keeps installing DefaultLogSystem. Formatting a message costs far more than queueing it, so this only
+             * pays off where many threads log at once on enough cores for the mutex to be contended; install it through
+             * LoggingOptions::logger_create_fn there.
+             */
+            class AWS_CORE_API RingBufferLogSystem : public FormattedLogSystem
+            {
+            public:
+                using Base = FormattedLogSystem;
+
+                /**
+                 * Writes to the supplied stream. capacity is rounded up to a power of two.
+                 */
+                RingBufferLogSystem(LogLevel logLevel, const std::shared_ptr<Aws::OStream>& logFile,
+                    size_t capacity = 8192, LogOverflowPolicy policy = LogOverflowPolicy::Drop);
+
+                /**
+                 * Writes to filenamePrefix + "timestamp.log", rolled every hour like DefaultLogSystem.
+                 */
+                RingBufferLogSystem(LogLevel logLevel, const Aws::String& filenamePrefix,
+                    size_t capacity = 8192, LogOverflowPolicy policy = LogOverflowPolicy::Drop);
+
+                virtual ~RingBufferLogSystem();
+
+                RingBufferLogSystem(const RingBufferLogSystem&) = delete;
+                RingBufferLogSystem& operator=(const RingBufferLogSystem&) = delete;
+
+                /**
+                 * Number of messages discarded because the queue was full.
+                 */
+                inline uint64_t GetDroppedMessageCount() const { return m_droppedMessages.load(std::memory_order_relaxed); }
+
+            protected:
+                /**
+                 * Queues the message for the logging thread.
+                 */
+                virtual void ProcessFormattedStatement(Aws::String&& statement) override;
+
+            private:
+                struct Slot;
+
+                void Start(size_t capacity);
+                bool TryPush(Aws::String& statement);
+                size_t DrainBatch();
+                void LoggingThread();
+
+                RingBufferLogSink* m_sink;
+                LogOverflowPolicy m_policy;
+
+                Slot* m_slots;
+                size_t m_mask;
+                std::atomic<size_t> m_enqueuePosition;
+                //only touched by the logging thread.
+                size_t m_dequeuePosition;
+
+                std::atomic<uint64_t> m_droppedMessages;
+                uint64_t m_reportedDroppedMessages;
+
+                std::mutex m_signalLock;
+                std::condition_variable m_dataSignal;
+                std::condition_variable m_spaceSignal;
+                std::atomic<size_t> m_blockedProducers;
+                std::atomic<bool> m_stopLogging;
+
+                std::thread m_loggingThread;
+            };
+
+        } // namespace Logging
+    } // namespace Utils
+} // namespace Aws
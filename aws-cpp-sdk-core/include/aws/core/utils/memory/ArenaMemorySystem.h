@@ -0,0 +1,152 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+
+#include <aws/core/utils/memory/MemorySystemInterface.h>
+
+#include <atomic>
+#include <mutex>
+#include <cstddef>
+
+namespace Aws
+{
+    namespace Utils
+    {
+        namespace Memory
+        {
+            class Arena;
+
+            /**
+             * Memory system that serves the allocations a thread makes inside an ArenaScope from a bump allocator
+             * attached to that scope. Everything else goes to the wrapped memory system, or malloc if there is none.
+             *
+             * Arenas are carved out of fixed size blocks of one slab reserved up front, which is how FreeMemory tells
+             * arena memory from heap memory. Freeing arena memory only drops a reference on its arena. Once the
+             * scope has ended and everything allocated in it has been freed, the whole arena is reset and pooled for
+             * the next scope in one step. Memory that outlives its scope stays valid, it just keeps its arena from being
+             * reused until it is freed.
+             *
+             * Allocations larger than a quarter of a block, and any allocation made once the slab is used up, go to
+             * the heap.
+             *
+             * Install it like any other memory system, e.g. through SDKOptions::memoryManagementOptions. The clients
+             * open an ArenaScope around every request they make while it is installed.
+             */
+            class AWS_CORE_API ArenaMemorySystem : public MemorySystemInterface
+            {
+            public:
+                /**
+                 * blockSize is rounded up to a power of two. underlying serves heap allocations and the slab, and is not owned.
+                 */
+                ArenaMemorySystem(std::size_t blockSize = 16 * 1024, std::size_t blockCount = 256, MemorySystemInterface* underlying = nullptr);
+                ~ArenaMemorySystem();
+
+                ArenaMemorySystem(const ArenaMemorySystem&) = delete;
+                ArenaMemorySystem& operator=(const ArenaMemorySystem&) = delete;
+
+                void Begin() override;
+                void End() override;
+
+                void* AllocateMemory(std::size_t blockSize, std::size_t alignment, const char* allocationTag = nullptr) override;
+                void FreeMemory(void* memoryPtr) override;
+
+                /**
+                 * Number of allocations served from arenas so far.
+                 */
+                inline std::size_t GetArenaAllocationCount() const { return m_arenaAllocations.load(std::memory_order_relaxed); }
+
+                /**
+                 * Number of arenas whose scope is still open or that still have memory outstanding.
+                 */
+                inline std::size_t GetLiveArenaCount() const { return m_liveArenas.load(std::memory_order_relaxed); }
+
+            private:
+                friend class Arena;
+                friend class ArenaScope;
+
+                static ArenaMemorySystem* GetInstalledSystem();
+
+                Arena* AcquireArena();
+                void RecycleArena(Arena* arena);
+                char* AcquireBlock(Arena* owner);
+                void ReleaseBlock(char* block);
+
+                void* AllocateFromHeap(std::size_t blockSize, std::size_t alignment, const char* allocationTag);
+                void FreeToHeap(void* memoryPtr);
+
+                MemorySystemInterface* m_underlying;
+                std::size_t m_blockShift;
+                std::size_t m_blockCount;
+                void* m_slabAllocation;
+                char* m_slabBegin;
+                char* m_slabEnd;
+
+                //owning arena of every block, indexed by block.
+                std::atomic<Arena*>* m_blockOwners;
+
+                std::mutex m_poolLock;
+                std::size_t* m_freeBlocks;
+                std::size_t m_freeBlockCount;
+                Arena* m_freeArenas;
+
+                std::atomic<std::size_t> m_arenaAllocations;
+                std::atomic<std::size_t> m_liveArenas;
+            };
+
+            /**
+             * While alive, small allocations this thread makes through an installed ArenaMemorySystem come from an arena
+             * owned by this scope. Scopes nest, the innermost one is used. Does nothing when no ArenaMemorySystem is installed.
+             *
+             * The clients open one around each request: everything made for the request that is neither cached nor handed
+             * to the caller goes away with its arena.
+             */
+            class AWS_CORE_API ArenaScope
+            {
+            public:
+                ArenaScope();
+                ~ArenaScope();
+
+                ArenaScope(const ArenaScope&) = delete;
+                ArenaScope& operator=(const ArenaScope&) = delete;
+
+            protected:
+                /**
+                 * Scope that routes this thread's allocations to arena, which may be null for the heap.
+                 */
+                ArenaScope(Arena* arena);
+
+            private:
+                Arena* m_arena;
+                Arena* m_previous;
+            };
+
+            /**
+             * Sends the allocations this thread makes back to the heap inside an ArenaScope, for state that is cached
+             * beyond the request that happens to create it: lazily created http clients and crypto state, credentials
+             * providers reloading, signing keys, request templates, pooled handles and anything else that grows on first
+             * use. Cached state built in an arena would otherwise keep that arena from being reused for as long as it lives.
+             */
+            class AWS_CORE_API HeapScope : public ArenaScope
+            {
+            public:
+                HeapScope() : ArenaScope(nullptr) {}
+            };
+
+        } // namespace Memory
+    } // namespace Utils
+} // namespace Aws
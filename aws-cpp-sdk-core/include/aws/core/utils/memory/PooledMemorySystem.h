@@ -0,0 +1,109 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+
+#include <aws/core/utils/memory/MemorySystemInterface.h>
+
+#include <atomic>
+#include <mutex>
+#include <cstddef>
+#include <cstdint>
+
+namespace Aws
+{
+    namespace Utils
+    {
+        namespace Memory
+        {
+            struct ThreadCache;
+
+            /**
+             * General purpose memory system with size classes and thread local caches, for builds that route everything
+             * through Aws::Malloc and want something tuned for the SDK's many small, short lived allocations (strings, map
+             * nodes, small buffers) instead of the system allocator.
+             *
+             * Every thread gets a cache with a free list per size class, refilled from chunks of chunkSize bytes taken from
+             * the wrapped memory system, or malloc if there is none. A block freed by another thread is queued back to the
+             * cache it came from without taking a lock. The caches of threads that exit are handed to the next thread that
+             * needs one. Requests above MAX_POOLED_SIZE go straight to the wrapped memory system.
+             *
+             * Memory in the caches is kept for reuse until the memory system is destroyed, so its footprint follows the
+             * process' peak. Like any memory system that tags its allocations, it has to be installed before the first
+             * allocation and stay installed until the last one is freed.
+             */
+            class AWS_CORE_API PooledMemorySystem : public MemorySystemInterface
+            {
+            public:
+                static const std::size_t MAX_POOLED_SIZE = 4096;
+
+                /**
+                 * underlying serves the chunks and large allocations and is not owned.
+                 */
+                PooledMemorySystem(std::size_t chunkSize = 64 * 1024, MemorySystemInterface* underlying = nullptr);
+                ~PooledMemorySystem();
+
+                PooledMemorySystem(const PooledMemorySystem&) = delete;
+                PooledMemorySystem& operator=(const PooledMemorySystem&) = delete;
+
+                void Begin() override;
+                void End() override;
+
+                void* AllocateMemory(std::size_t blockSize, std::size_t alignment, const char* allocationTag = nullptr) override;
+                void FreeMemory(void* memoryPtr) override;
+
+                /**
+                 * Bytes taken from the wrapped memory system for chunks so far.
+                 */
+                inline std::size_t GetChunkBytes() const { return m_chunkBytes.load(std::memory_order_relaxed); }
+
+                /**
+                 * Number of thread caches created so far, live or waiting to be reused.
+                 */
+                inline std::size_t GetThreadCacheCount() const { return m_threadCacheCount.load(std::memory_order_relaxed); }
+
+            private:
+                friend struct ThreadCache;
+                friend class ThreadCacheHolder;
+
+                ThreadCache* GetThreadCache();
+                ThreadCache* AcquireThreadCache();
+                void RetireThreadCache(ThreadCache* cache);
+                bool RefillChunk(ThreadCache* cache, std::size_t blockSize);
+
+                void* AllocateFromHeap(std::size_t blockSize, std::size_t alignment, const char* allocationTag);
+                void FreeToHeap(void* memoryPtr);
+
+                MemorySystemInterface* m_underlying;
+                std::size_t m_chunkSize;
+                uint64_t m_id;
+
+                std::mutex m_cacheLock;
+                ThreadCache* m_allCaches;
+                ThreadCache* m_retiredCaches;
+                void* m_chunks;
+
+                std::atomic<std::size_t> m_chunkBytes;
+                std::atomic<std::size_t> m_threadCacheCount;
+
+                //every live pooled memory system, so exiting threads can tell whether their cache's owner still exists.
+                PooledMemorySystem* m_nextLive;
+            };
+
+        } // namespace Memory
+    } // namespace Utils
+} // namespace Aws
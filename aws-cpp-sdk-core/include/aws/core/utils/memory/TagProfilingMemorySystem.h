@@ -0,0 +1,116 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+
+#include <aws/core/utils/memory/MemorySystemInterface.h>
+#include <aws/core/utils/memory/stl/AWSString.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+#include <aws/core/utils/memory/stl/AWSStreamFwd.h>
+
+#include <atomic>
+#include <mutex>
+#include <cstddef>
+#include <cstdint>
+
+namespace Aws
+{
+    namespace Utils
+    {
+        namespace Memory
+        {
+            /**
+             * Allocation statistics of one allocation tag.
+             */
+            struct AWS_CORE_API TagAllocationStatistics
+            {
+                Aws::String tag;
+                std::size_t liveBytes;
+                std::size_t peakBytes;
+                uint64_t liveAllocations;
+                uint64_t totalAllocations;
+                uint64_t totalBytes;
+            };
+
+            /**
+             * Memory system that keeps live bytes, peak bytes and allocation counts per allocation tag, so memory held by
+             * a long running process can be attributed to the part of the SDK that allocated it. Allocations are served by
+             * the wrapped memory system, or malloc if there is none.
+             *
+             * Tags are aggregated by content, so the same tag defined in several translation units is reported once.
+             * Allocation counts are kept in per-thread stripes so that threads allocating under the same tag do not contend
+             * on one counter. Tags past tagCapacity are reported together as "(overflow)", allocations without a tag as
+             * "(untagged)".
+             *
+             * Every allocation carries a small header, so this has to be installed before the first allocation is made and
+             * stay installed until the last one is freed, e.g. through SDKOptions::memoryManagementOptions.
+             */
+            class AWS_CORE_API TagProfilingMemorySystem : public MemorySystemInterface
+            {
+            public:
+                /**
+                 * underlying serves the actual allocations and is not owned.
+                 */
+                TagProfilingMemorySystem(std::size_t tagCapacity = 512, MemorySystemInterface* underlying = nullptr);
+                ~TagProfilingMemorySystem();
+
+                TagProfilingMemorySystem(const TagProfilingMemorySystem&) = delete;
+                TagProfilingMemorySystem& operator=(const TagProfilingMemorySystem&) = delete;
+
+                void Begin() override;
+                void End() override;
+
+                void* AllocateMemory(std::size_t blockSize, std::size_t alignment, const char* allocationTag = nullptr) override;
+                void FreeMemory(void* memoryPtr) override;
+
+                /**
+                 * Statistics of every tag seen so far, ordered by live bytes, largest first. Counters keep moving while the
+                 * snapshot is taken, so tags are each consistent on their own but not necessarily with one another.
+                 */
+                Aws::Vector<TagAllocationStatistics> GetSnapshot() const;
+
+                /**
+                 * Writes the current snapshot as a table, one tag per line, followed by the totals.
+                 */
+                void Dump(Aws::OStream& out) const;
+
+            private:
+                struct TagStripe;
+                struct TagRecord;
+                struct TagLookupEntry;
+
+                std::size_t FindTag(const char* allocationTag);
+                std::size_t AddTag(const char* allocationTag);
+
+                void* AllocateFromHeap(std::size_t blockSize, std::size_t alignment, const char* allocationTag);
+                void FreeToHeap(void* memoryPtr);
+
+                MemorySystemInterface* m_underlying;
+                std::size_t m_tagCapacity;
+                void* m_tagsAllocation;
+                TagRecord* m_tags;
+                std::atomic<std::size_t> m_tagCount;
+
+                //open addressed, maps tag pointers to records, written under m_tagLock and read without it.
+                TagLookupEntry* m_lookup;
+                std::size_t m_lookupMask;
+                std::mutex m_tagLock;
+            };
+
+        } // namespace Memory
+    } // namespace Utils
+} // namespace Aws
@@ -0,0 +1,183 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#pragma once
+
+#include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/memory/AWSMemory.h>
+#include <aws/core/utils/memory/stl/AWSString.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <mutex>
+
+namespace Aws
+{
+    namespace Utils
+    {
+        namespace Xml
+        {
+            /**
+             * Read only view over a run of sibling elements of a parsed response, e.g. the <Contents> elements of a
+             * ListObjects response. Nothing is decoded up front: each element is turned into a T only when its
+             * iterator is dereferenced, and GetNode() gives access to the raw element for callers that only need
+             * one or two of its fields.
+             *
+             * The view and its iterators share ownership of the document and of the element name, so they stay valid after
+             * the result they came from is copied, moved or gone.
+             * T must be constructible from an XmlNode, which is the case for all generated models.
+             */
+            template<typename T>
+            class XmlListView
+            {
+            public:
+                class const_iterator
+                {
+                public:
+                    typedef std::forward_iterator_tag iterator_category;
+                    typedef T value_type;
+                    typedef std::ptrdiff_t difference_type;
+                    typedef const T* pointer;
+                    typedef T reference;
+
+                    const_iterator() : m_index(0) {}
+
+                    /**
+                     * Decodes the current element.
+                     */
+                    T operator*() const { return T(m_node); }
+                    /**
+                     * The current element, undecoded.
+                     */
+                    const XmlNode& GetNode() const { return m_node; }
+
+                    const_iterator& operator++()
+                    {
+                        m_node = m_node.NextNode(m_elementName->c_str());
+                        ++m_index;
+                        return *this;
+                    }
+
+                    const_iterator operator++(int)
+                    {
+                        const_iterator previous(*this);
+                        ++(*this);
+                        return previous;
+                    }
+
+                    bool operator==(const const_iterator& other) const
+                    {
+                        if (m_node.IsNull() || other.m_node.IsNull())
+                        {
+                            return m_node.IsNull() && other.m_node.IsNull();
+                        }
+                        return m_index == other.m_index;
+                    }
+
+                    bool operator!=(const const_iterator& other) const { return !(*this == other); }
+
+                private:
+                    const_iterator(const XmlNode& node, const std::shared_ptr<const Aws::String>& elementName) :
+                        m_node(node), m_elementName(elementName), m_index(0)
+                    {
+                    }
+
+                    XmlNode m_node;
+                    std::shared_ptr<const Aws::String> m_elementName;
+                    size_t m_index;
+
+                    friend class XmlListView;
+                };
+
+                typedef const_iterator iterator;
+
+                /**
+                 * Creates an empty view.
+                 */
+                XmlListView() {}
+
+                /**
+                 * Creates a view starting at firstElement (which may be null) and continuing over its following siblings named elementName.
+                 * firstElement must belong to document.
+                 */
+                XmlListView(const std::shared_ptr<const XmlDocument>& document, const XmlNode& firstElement, const Aws::String& elementName) :
+                    m_document(document), m_firstElement(firstElement),
+                    m_elementName(Aws::MakeShared<Aws::String>("XmlListView", elementName)),
+                    m_decoded(Aws::MakeShared<DecodedElements>("XmlListView"))
+                {
+                }
+
+                /**
+                 * Whether the view was created over a document, as opposed to default constructed.
+                 */
+                bool IsBound() const { return m_document != nullptr; }
+
+                /**
+                 * Every element decoded, in order. The elements are decoded by the first call, which copies of the view
+                 * share; safe to call from several threads. An unbound view has no elements.
+                 */
+                const Aws::Vector<T>& GetDecoded() const
+                {
+                    if (!m_decoded)
+                    {
+                        static const Aws::Vector<T> noElements;
+                        return noElements;
+                    }
+                    std::call_once(m_decoded->once, [this]()
+                    {
+                        for (const_iterator iter = begin(); iter != end(); ++iter)
+                        {
+                            m_decoded->elements.push_back(*iter);
+                        }
+                    });
+                    return m_decoded->elements;
+                }
+
+                const_iterator begin() const { return const_iterator(m_firstElement, m_elementName); }
+                const_iterator end() const { return const_iterator(); }
+
+                bool empty() const { return m_firstElement.IsNull(); }
+
+                /**
+                 * Counts the elements. This walks the siblings but doesn't decode them.
+                 */
+                size_t size() const
+                {
+                    size_t count = 0;
+                    for (XmlNode node = m_firstElement; !node.IsNull(); node = node.NextNode(m_elementName->c_str()))
+                    {
+                        ++count;
+                    }
+                    return count;
+                }
+
+            private:
+                struct DecodedElements
+                {
+                    std::once_flag once;
+                    Aws::Vector<T> elements;
+                };
+
+                std::shared_ptr<const XmlDocument> m_document;
+                XmlNode m_firstElement;
+                std::shared_ptr<const Aws::String> m_elementName;
+                std::shared_ptr<DecodedElements> m_decoded;
+            };
+
+        } // namespace Xml
+    } // namespace Utils
+} // namespace Aws
@@ -0,0 +1,156 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+
+#include <aws/core/utils/memory/stl/AWSStreamFwd.h>
+#include <aws/core/utils/memory/stl/AWSString.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+
+#include <utility>
+
+namespace Aws
+{
+    namespace Utils
+    {
+        namespace Xml
+        {
+            /**
+             * Kind of token the XmlReader is currently positioned on.
+             */
+            enum class XmlTokenType
+            {
+                None,
+                StartElement,
+                EndElement,
+                Text,
+                EndOfDocument
+            };
+
+            /**
+             * Forward only, pull based xml reader. Unlike XmlDocument, it never builds a tree of the whole document;
+             * the underlying stream is consumed in fixed size chunks and only the current token is kept in memory.
+             * This is intended for deserializing large responses (e.g. list results) directly into models.
+             *
+             * Self closing elements (<Foo/>) are reported as a StartElement immediately followed by an EndElement so
+             * that callers don't need to special case them. Comments, processing instructions and DOCTYPE declarations
+             * are skipped. Text is reported with entities decoded; CDATA sections are reported verbatim.
+             *
+             * An empty document is not considered an error, it simply yields EndOfDocument.
+             */
+            class AWS_CORE_API XmlReader
+            {
+            public:
+                /**
+                 * Reads from stream. The stream is not owned and must outlive the reader.
+                 */
+                XmlReader(Aws::IStream& stream);
+
+                XmlReader(const XmlReader&) = delete;
+                XmlReader& operator=(const XmlReader&) = delete;
+
+                /**
+                 * Advances to the next token. Returns false once the end of the document is reached or a parse error occurs.
+                 */
+                bool Read();
+                /**
+                 * Type of the current token.
+                 */
+                inline XmlTokenType GetTokenType() const { return m_tokenType; }
+                /**
+                 * Name of the current element, valid for StartElement and EndElement tokens.
+                 */
+                inline const Aws::String& GetName() const { return m_name; }
+                /**
+                 * Decoded text of the current token, valid for Text tokens.
+                 */
+                inline const Aws::String& GetValue() const { return m_value; }
+                /**
+                 * Nesting depth of the current token. The root element is at depth 0, its children at depth 1 and so on.
+                 * Text has the depth its parent's children would have.
+                 */
+                inline size_t GetDepth() const { return m_depth; }
+                /**
+                 * Returns true if the current StartElement was written as a self closing tag.
+                 */
+                inline bool IsEmptyElement() const { return m_isEmptyElement; }
+                /**
+                 * Get value of an attribute of the current StartElement, or an empty string if there is no such attribute.
+                 */
+                Aws::String GetAttributeValue(const Aws::String& name) const;
+                /**
+                 * Advances to the root element of the document. Returns false if the document has no root element.
+                 */
+                bool ReadToRootElement();
+                /**
+                 * Advances to the next child element of the element that started at parentDepth, skipping over text and
+                 * over any part of the previous child that the caller didn't consume. Returns false when the parent
+                 * element ends (the reader is then positioned on its EndElement), at the end of the document or on error.
+                 */
+                bool ReadChildElement(size_t parentDepth);
+                /**
+                 * When positioned on a StartElement, reads up to and including the matching EndElement and returns the
+                 * concatenated text of the element. Text of nested elements is included, but their tags are not.
+                 */
+                Aws::String ReadElementText();
+                /**
+                 * When positioned on a StartElement, advances to the matching EndElement without decoding its content.
+                 */
+                void SkipElement();
+                /**
+                 * Returns false if a parse error occurred. Call GetErrorMessage() to see details.
+                 */
+                inline bool WasParseSuccessful() const { return m_errorMessage.empty(); }
+                /**
+                 * Returns the error message if parsing failed.
+                 */
+                inline const Aws::String& GetErrorMessage() const { return m_errorMessage; }
+
+            private:
+                bool FillBuffer();
+                bool EnsureAvailable(size_t count);
+                size_t Find(const char* delimiter, size_t fromOffset);
+                size_t FindTagEnd();
+                bool StartsWith(const char* prefix);
+                bool ReadStartElement();
+                bool ReadEndElement();
+                bool ReadText();
+                bool SkipUntil(const char* delimiter);
+                bool SetError(const char* message);
+                bool SetEndOfDocument();
+
+                Aws::IStream& m_stream;
+                Aws::String m_buffer;
+                size_t m_position;
+                bool m_endOfStream;
+
+                XmlTokenType m_tokenType;
+                Aws::String m_name;
+                Aws::String m_value;
+                Aws::Vector<std::pair<Aws::String, Aws::String>> m_attributes;
+                Aws::Vector<Aws::String> m_openElements;
+                size_t m_depth;
+                bool m_isEmptyElement;
+                bool m_pendingEndElement;
+                bool m_seenRootElement;
+                bool m_skipText;
+                Aws::String m_errorMessage;
+            };
+
+        } // namespace Xml
+    } // namespace Utils
+} // namespace Aws
@@ -62,6 +62,10 @@ namespace Aws
             class AWS_CORE_API XmlNode
             {
             public:
+                /**
+                 * Creates a null node, e.g. to represent the end of a sequence of siblings.
+                 */
+                XmlNode() : m_node(nullptr), m_doc(nullptr) {}
                 /**
                  * copies node and document over.
                  */
@@ -141,7 +145,7 @@ namespace Aws
                 /**
                  * If current node is valid.
                  */
-                bool IsNull();
+                bool IsNull() const;
 
             private:
                 XmlNode(Aws::External::tinyxml2::XMLNode* node, const XmlDocument& document) :
@@ -171,6 +175,9 @@ namespace Aws
                 XmlDocument(XmlDocument&& doc); 
                 XmlDocument(const XmlDocument& other) = delete;
 
+                XmlDocument& operator=(XmlDocument&& other);
+                XmlDocument& operator=(const XmlDocument& other) = delete;
+
                 ~XmlDocument();
 
                 /**
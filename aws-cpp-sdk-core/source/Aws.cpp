@@ -18,6 +18,9 @@
 #include <aws/core/utils/logging/AWSLogging.h>
 #include <aws/core/utils/logging/DefaultLogSystem.h>
 #include <aws/core/Globals.h>
+#include <aws/core/auth/CredentialsProviderCache.h>
+#include <aws/core/http/HttpClientRegistry.h>
+#include <aws/core/utils/BufferPool.h>
 #include <aws/core/external/cjson/cJSON.h>
 #include <aws/core/monitoring/MonitoringManager.h>
 #include <aws/core/net/Net.h>
@@ -35,6 +38,8 @@ namespace Aws
         }
 #endif // USE_AWS_MEMORY_MANAGEMENT
 
+        Aws::Utils::InitializeBufferPool(options.memoryManagementOptions.bufferPoolMaxRetainedBytes);
+
         if(options.loggingOptions.logLevel != Aws::Utils::Logging::LogLevel::Off)
         {
             if(options.loggingOptions.logger_create_fn)
@@ -101,20 +106,24 @@ namespace Aws
         Aws::Http::SetInitCleanupCurlFlag(options.httpOptions.initAndCleanupCurl);
         Aws::Http::SetInstallSigPipeHandlerFlag(options.httpOptions.installSigPipeHandler);
         Aws::Http::InitHttp();
+        Aws::Http::InitHttpClientRegistry();
         Aws::InitializeEnumOverflowContainer();
         cJSON_Hooks hooks;
         hooks.malloc_fn = [](size_t sz) { return Aws::Malloc("cJSON_Tag", sz); };
         hooks.free_fn = Aws::Free;
         cJSON_InitHooks(&hooks);
         Aws::Net::InitNetwork();
+        Aws::Auth::InitCredentialsProviderCache();
         Aws::Monitoring::InitMonitoring(options.monitoringOptions.customizedMonitoringFactory_create_fn);
     }
 
     void ShutdownAPI(const SDKOptions& options)
     {
         Aws::Monitoring::CleanupMonitoring();
+        Aws::Auth::CleanupCredentialsProviderCache();
         Aws::Net::CleanupNetwork();
         Aws::CleanupEnumOverflowContainer();
+        Aws::Http::CleanupHttpClientRegistry();
         Aws::Http::CleanupHttp();
         Aws::Utils::Crypto::CleanupCrypto();
 
@@ -122,6 +131,9 @@ namespace Aws
         {
             Aws::Utils::Logging::ShutdownAWSLogging();
         }
+        Aws::Utils::Logging::CleanupTagLogLevels();
+
+        Aws::Utils::CleanupBufferPool();
 
 #ifdef USE_AWS_MEMORY_MANAGEMENT
         if(options.memoryManagementOptions.memoryManager)
@@ -25,6 +25,7 @@
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/logging/LogMacros.h>
 #include <aws/core/utils/memory/AWSMemory.h>
+#include <aws/core/utils/memory/ArenaMemorySystem.h>
 #include <aws/core/utils/crypto/Sha256.h>
 #include <aws/core/utils/crypto/Sha256HMAC.h>
 
@@ -155,8 +156,8 @@ AWSAuthV4Signer::AWSAuthV4Signer(const std::shared_ptr<Auth::AWSCredentialsProvi
     m_payloadSigningPolicy(signingPolicy),
     m_urlEscapePath(urlEscapePath)
 {
-    //go ahead and warm up the signing cache.
-    ComputeHash(credentialsProvider->GetAWSCredentials().GetAWSSecretKey(), DateTime::CalculateGmtTimestampAsString(SIMPLE_DATE_FORMAT_STR));
+    //the signing key cache fills on the first SignRequest; resolving credentials here would read profiles and probe
+    //the instance metadata service for every client constructed, whether or not it ever sends a request.
 }
 
 AWSAuthV4Signer::~AWSAuthV4Signer()
@@ -177,7 +178,12 @@ bool AWSAuthV4Signer::SignRequest(Aws::Http::HttpRequest& request) const
 
 bool AWSAuthV4Signer::SignRequest(Aws::Http::HttpRequest& request, bool signBody) const
 {
-    AWSCredentials credentials = m_credentialsProvider->GetAWSCredentials();
+    std::shared_ptr<const AWSCredentials> credentialsSnapshot;
+    {
+        Utils::Memory::HeapScope heapScope;
+        credentialsSnapshot = GetCredentialsSnapshot(*m_credentialsProvider);
+    }
+    const AWSCredentials& credentials = *credentialsSnapshot;
 
     //don't sign anonymous requests
     if (credentials.GetAWSAccessKeyId().empty() || credentials.GetAWSSecretKey().empty())
@@ -308,7 +314,12 @@ bool AWSAuthV4Signer::PresignRequest(Aws::Http::HttpRequest& request, const char
 
 bool AWSAuthV4Signer::PresignRequest(Aws::Http::HttpRequest& request, const char* region, const char* serviceName, long long expirationTimeInSeconds) const
 {
-    AWSCredentials credentials = m_credentialsProvider->GetAWSCredentials();
+    std::shared_ptr<const AWSCredentials> credentialsSnapshot;
+    {
+        Utils::Memory::HeapScope heapScope;
+        credentialsSnapshot = GetCredentialsSnapshot(*m_credentialsProvider);
+    }
+    const AWSCredentials& credentials = *credentialsSnapshot;
 
     //don't sign anonymous requests
     if (credentials.GetAWSAccessKeyId().empty() || credentials.GetAWSSecretKey().empty())
@@ -507,6 +518,7 @@ ByteBuffer AWSAuthV4Signer::ComputeHash(const Aws::String& secretKey, const Aws:
         // check again to prevent racing writers
         if (m_currentDateStr != simpleDate || m_currentSecretKey != secretKey)
         {
+            Utils::Memory::HeapScope heapScope;
             m_currentSecretKey = secretKey;
             m_currentDateStr = simpleDate;
             m_partialSignature = ComputeHash(m_currentSecretKey, m_currentDateStr, m_region, m_serviceName);
@@ -61,6 +61,8 @@ static const char DIRECTORY_JOIN[] = "/";
 
 static const int EXPIRATION_GRACE_PERIOD = 5 * 1000;
 
+static const char CREDENTIALS_SNAPSHOT_TAG[] = "AWSCredentialsSnapshot";
+
 void AWSCredentialsProvider::Reload()
 {
     m_lastLoadedMs = DateTime::Now().Millis();
@@ -75,6 +77,37 @@ bool AWSCredentialsProvider::IsTimeToRefresh(long reloadFrequency)
     return false;
 }
 
+std::shared_ptr<const AWSCredentials> AWSCredentialsProvider::GetAWSCredentialsSnapshot()
+{
+    return Aws::MakeShared<AWSCredentials>(CREDENTIALS_SNAPSHOT_TAG, GetAWSCredentials());
+}
+
+bool AWSCredentialsProvider::ServesCredentialsSnapshots() const
+{
+    return false;
+}
+
+std::shared_ptr<const AWSCredentials> Aws::Auth::GetCredentialsSnapshot(AWSCredentialsProvider& provider)
+{
+    if (provider.ServesCredentialsSnapshots())
+    {
+        return provider.GetAWSCredentialsSnapshot();
+    }
+    return Aws::MakeShared<AWSCredentials>(CREDENTIALS_SNAPSHOT_TAG, provider.GetAWSCredentials());
+}
+
+void PublishedCredentials::Publish(const AWSCredentials& credentials)
+{
+    std::shared_ptr<const AWSCredentials> snapshot = Aws::MakeShared<AWSCredentials>(CREDENTIALS_SNAPSHOT_TAG, credentials);
+    std::atomic_store(&m_snapshot, snapshot);
+}
+
+std::shared_ptr<const AWSCredentials> PublishedCredentials::Get() const
+{
+    auto snapshot = std::atomic_load(&m_snapshot);
+    return snapshot ? snapshot : Aws::MakeShared<AWSCredentials>(CREDENTIALS_SNAPSHOT_TAG);
+}
+
 
 static const char* ENVIRONMENT_LOG_TAG = "EnvironmentAWSCredentialsProvider";
 
@@ -147,13 +180,7 @@ Aws::String ProfileConfigFileAWSCredentialsProvider::GetProfileDirectory()
     }
 }
 
-static const char* PROFILE_LOG_TAG = "ProfileConfigFileAWSCredentialsProvider";
-
-
-ProfileConfigFileAWSCredentialsProvider::ProfileConfigFileAWSCredentialsProvider(long refreshRateMs) :
-        m_configFileLoader(Aws::MakeShared<Aws::Config::AWSConfigFileProfileConfigLoader>(PROFILE_LOG_TAG, GetConfigProfileFilename(), true)),
-        m_credentialsFileLoader(Aws::MakeShared<Aws::Config::AWSConfigFileProfileConfigLoader>(PROFILE_LOG_TAG, GetCredentialsProfileFilename())),
-        m_loadFrequencyMs(refreshRateMs)
+Aws::String ProfileConfigFileAWSCredentialsProvider::GetDefaultProfileName()
 {
     auto profileFromVar = Aws::Environment::GetEnv(AWS_PROFILE_DEFAULT_ENV_VAR);
     if (profileFromVar.empty())
@@ -161,15 +188,18 @@ ProfileConfigFileAWSCredentialsProvider::ProfileConfigFileAWSCredentialsProvider
         profileFromVar = Aws::Environment::GetEnv(AWS_PROFILE_ENV_VAR);
     }
 
-    if (!profileFromVar.empty())
-    {
-        m_profileToUse = profileFromVar;
-    }
-    else
-    {
-        m_profileToUse = DEFAULT_PROFILE;
-    }
+    return profileFromVar.empty() ? Aws::String(DEFAULT_PROFILE) : profileFromVar;
+}
+
+static const char* PROFILE_LOG_TAG = "ProfileConfigFileAWSCredentialsProvider";
+
 
+ProfileConfigFileAWSCredentialsProvider::ProfileConfigFileAWSCredentialsProvider(long refreshRateMs) :
+        m_profileToUse(GetDefaultProfileName()),
+        m_configFileLoader(Aws::MakeShared<Aws::Config::AWSConfigFileProfileConfigLoader>(PROFILE_LOG_TAG, GetConfigProfileFilename(), true)),
+        m_credentialsFileLoader(Aws::MakeShared<Aws::Config::AWSConfigFileProfileConfigLoader>(PROFILE_LOG_TAG, GetCredentialsProfileFilename())),
+        m_loadFrequencyMs(refreshRateMs)
+{
     AWS_LOGSTREAM_INFO(PROFILE_LOG_TAG, "Setting provider to read credentials from " <<  GetCredentialsProfileFilename() << " for credentials file"
                                       << " and " <<  GetConfigProfileFilename() << " for the config file "
                                       << ", for use with profile " << m_profileToUse);
@@ -190,6 +220,18 @@ AWSCredentials ProfileConfigFileAWSCredentialsProvider::GetAWSCredentials()
 {
     RefreshIfExpired();
     ReaderLockGuard guard(m_reloadLock);
+    return FindCredentials();
+}
+
+std::shared_ptr<const AWSCredentials> ProfileConfigFileAWSCredentialsProvider::GetAWSCredentialsSnapshot()
+{
+    //the snapshot is published by Reload.
+    RefreshIfExpired();
+    return m_publishedCredentials.Get();
+}
+
+AWSCredentials ProfileConfigFileAWSCredentialsProvider::FindCredentials() const
+{
     auto credsFileProfileIter = m_credentialsFileLoader->GetProfiles().find(m_profileToUse);
 
     if(credsFileProfileIter != m_credentialsFileLoader->GetProfiles().end())
@@ -213,6 +255,7 @@ void ProfileConfigFileAWSCredentialsProvider::Reload()
     {
         m_configFileLoader->Load();
     }
+    m_publishedCredentials.Publish(FindCredentials());
     AWSCredentialsProvider::Reload();
 }
 
@@ -236,25 +279,41 @@ void ProfileConfigFileAWSCredentialsProvider::RefreshIfExpired()
 
 static const char* INSTANCE_LOG_TAG = "InstanceProfileCredentialsProvider";
 
-InstanceProfileCredentialsProvider::InstanceProfileCredentialsProvider(long refreshRateMs) :
+InstanceProfileCredentialsProvider::InstanceProfileCredentialsProvider(long refreshRateMs, CredentialsRefreshMode refreshMode) :
         m_ec2MetadataConfigLoader(Aws::MakeShared<Aws::Config::EC2InstanceProfileConfigLoader>(INSTANCE_LOG_TAG)),
         m_loadFrequencyMs(refreshRateMs)
 {
     AWS_LOGSTREAM_INFO(INSTANCE_LOG_TAG, "Creating Instance with default EC2MetadataClient and refresh rate " << refreshRateMs);
+    StartBackgroundRefresh(refreshMode);
 }
 
 
 InstanceProfileCredentialsProvider::InstanceProfileCredentialsProvider(const std::shared_ptr<Aws::Config::EC2InstanceProfileConfigLoader>& loader,
-                                                                       long refreshRateMs) :
+                                                                       long refreshRateMs, CredentialsRefreshMode refreshMode) :
         m_ec2MetadataConfigLoader(loader),
         m_loadFrequencyMs(refreshRateMs)
 {
     AWS_LOGSTREAM_INFO(INSTANCE_LOG_TAG, "Creating Instance with injected EC2MetadataClient and refresh rate " << refreshRateMs);
+    StartBackgroundRefresh(refreshMode);
 }
 
+void InstanceProfileCredentialsProvider::StartBackgroundRefresh(CredentialsRefreshMode refreshMode)
+{
+    if (refreshMode == CredentialsRefreshMode::Background)
+    {
+        AWS_LOGSTREAM_INFO(INSTANCE_LOG_TAG, "Refreshing credentials in the background.");
+        m_backgroundRefresher = Aws::MakeUnique<BackgroundCredentialsRefresher>(INSTANCE_LOG_TAG,
+            [this](DateTime&) { return RefreshInBackground(); }, m_loadFrequencyMs);
+    }
+}
 
 AWSCredentials InstanceProfileCredentialsProvider::GetAWSCredentials()
 {
+    if (m_backgroundRefresher)
+    {
+        return *GetAWSCredentialsSnapshot();
+    }
+
     RefreshIfExpired();
     ReaderLockGuard guard(m_reloadLock);
     auto profileIter = m_ec2MetadataConfigLoader->GetProfiles().find(Aws::Config::INSTANCE_PROFILE_KEY);
@@ -267,13 +326,46 @@ AWSCredentials InstanceProfileCredentialsProvider::GetAWSCredentials()
     return AWSCredentials();
 }
 
+std::shared_ptr<const AWSCredentials> InstanceProfileCredentialsProvider::GetAWSCredentialsSnapshot()
+{
+    if (m_backgroundRefresher)
+    {
+        m_backgroundRefresher->WaitForFirstRefresh();
+    }
+    else
+    {
+        RefreshIfExpired();
+    }
+    return m_publishedCredentials.Get();
+}
+
 void InstanceProfileCredentialsProvider::Reload()
 {
     AWS_LOGSTREAM_INFO(INSTANCE_LOG_TAG, "Credentials have expired attempting to repull from EC2 Metadata Service.");
     m_ec2MetadataConfigLoader->Load();
+    auto profileIter = m_ec2MetadataConfigLoader->GetProfiles().find(Aws::Config::INSTANCE_PROFILE_KEY);
+    m_publishedCredentials.Publish(profileIter != m_ec2MetadataConfigLoader->GetProfiles().end() ? profileIter->second.GetCredentials() : AWSCredentials());
     AWSCredentialsProvider::Reload();
 }
 
+bool InstanceProfileCredentialsProvider::RefreshInBackground()
+{
+    //the metadata service is only called here, without holding the lock readers take.
+    if (!m_ec2MetadataConfigLoader->Load())
+    {
+        return false;
+    }
+
+    auto profileIter = m_ec2MetadataConfigLoader->GetProfiles().find(Aws::Config::INSTANCE_PROFILE_KEY);
+    if (profileIter == m_ec2MetadataConfigLoader->GetProfiles().end() || profileIter->second.GetCredentials().GetAWSAccessKeyId().empty())
+    {
+        return false;
+    }
+
+    m_publishedCredentials.Publish(profileIter->second.GetCredentials());
+    return true;
+}
+
 void InstanceProfileCredentialsProvider::RefreshIfExpired()
 {
     AWS_LOGSTREAM_DEBUG(INSTANCE_LOG_TAG, "Checking if latest credential pull has expired.");
@@ -293,16 +385,17 @@ void InstanceProfileCredentialsProvider::RefreshIfExpired()
 
 static const char TASK_ROLE_LOG_TAG[] = "TaskRoleCredentialsProvider";
 
-TaskRoleCredentialsProvider::TaskRoleCredentialsProvider(const char* URI, long refreshRateMs) :
+TaskRoleCredentialsProvider::TaskRoleCredentialsProvider(const char* URI, long refreshRateMs, CredentialsRefreshMode refreshMode) :
     m_ecsCredentialsClient(Aws::MakeShared<Aws::Internal::ECSCredentialsClient>(TASK_ROLE_LOG_TAG, URI)),
     m_loadFrequencyMs(refreshRateMs),
     m_expirationDate(DateTime::Now()),
     m_credentials(Aws::Auth::AWSCredentials())
 {
     AWS_LOGSTREAM_INFO(TASK_ROLE_LOG_TAG, "Creating TaskRole with default ECSCredentialsClient and refresh rate " << refreshRateMs);
+    StartBackgroundRefresh(refreshMode);
 }
 
-TaskRoleCredentialsProvider::TaskRoleCredentialsProvider(const char* endpoint, const char* token, long refreshRateMs) :
+TaskRoleCredentialsProvider::TaskRoleCredentialsProvider(const char* endpoint, const char* token, long refreshRateMs, CredentialsRefreshMode refreshMode) :
     m_ecsCredentialsClient(Aws::MakeShared<Aws::Internal::ECSCredentialsClient>(TASK_ROLE_LOG_TAG, ""/*resourcePath*/,
                 endpoint, token)),
     m_loadFrequencyMs(refreshRateMs),
@@ -310,42 +403,70 @@ TaskRoleCredentialsProvider::TaskRoleCredentialsProvider(const char* endpoint, c
     m_credentials(Aws::Auth::AWSCredentials())
 {
     AWS_LOGSTREAM_INFO(TASK_ROLE_LOG_TAG, "Creating TaskRole with default ECSCredentialsClient and refresh rate " << refreshRateMs);
+    StartBackgroundRefresh(refreshMode);
 }
 
 TaskRoleCredentialsProvider::TaskRoleCredentialsProvider(
-        const std::shared_ptr<Aws::Internal::ECSCredentialsClient>& client, long refreshRateMs) :
+        const std::shared_ptr<Aws::Internal::ECSCredentialsClient>& client, long refreshRateMs, CredentialsRefreshMode refreshMode) :
     m_ecsCredentialsClient(client),
     m_loadFrequencyMs(refreshRateMs),
     m_expirationDate(DateTime::Now()),
     m_credentials(Aws::Auth::AWSCredentials())
 {
     AWS_LOGSTREAM_INFO(TASK_ROLE_LOG_TAG, "Creating TaskRole with default ECSCredentialsClient and refresh rate " << refreshRateMs);
+    StartBackgroundRefresh(refreshMode);
+}
+
+void TaskRoleCredentialsProvider::StartBackgroundRefresh(CredentialsRefreshMode refreshMode)
+{
+    if (refreshMode == CredentialsRefreshMode::Background)
+    {
+        AWS_LOGSTREAM_INFO(TASK_ROLE_LOG_TAG, "Refreshing credentials in the background.");
+        m_backgroundRefresher = Aws::MakeUnique<BackgroundCredentialsRefresher>(TASK_ROLE_LOG_TAG,
+            [this](DateTime& expiration) { return RefreshInBackground(expiration); }, m_loadFrequencyMs);
+    }
 }
 
 AWSCredentials TaskRoleCredentialsProvider::GetAWSCredentials()
 {
+    if (m_backgroundRefresher)
+    {
+        return *GetAWSCredentialsSnapshot();
+    }
+
     RefreshIfExpired();
     ReaderLockGuard guard(m_reloadLock);
     return m_credentials;
 }
 
+std::shared_ptr<const AWSCredentials> TaskRoleCredentialsProvider::GetAWSCredentialsSnapshot()
+{
+    if (m_backgroundRefresher)
+    {
+        m_backgroundRefresher->WaitForFirstRefresh();
+    }
+    else
+    {
+        RefreshIfExpired();
+    }
+    return m_publishedCredentials.Get();
+}
+
 bool TaskRoleCredentialsProvider::ExpiresSoon() const
 {
     return (m_expirationDate.Millis() - Aws::Utils::DateTime::Now().Millis() < EXPIRATION_GRACE_PERIOD);
 }
 
-void TaskRoleCredentialsProvider::Reload()
+bool TaskRoleCredentialsProvider::FetchCredentials(AWSCredentials& credentials, DateTime& expiration) const
 {
-    AWS_LOGSTREAM_INFO(TASK_ROLE_LOG_TAG, "Credentials have expired or will expire, attempting to repull from ECS IAM Service.");
-
     auto credentialsStr = m_ecsCredentialsClient->GetECSCredentials();
-    if (credentialsStr.empty()) return;
+    if (credentialsStr.empty()) return false;
 
     Json::JsonValue credentialsDoc(credentialsStr);
     if (!credentialsDoc.WasParseSuccessful()) 
     {
         AWS_LOGSTREAM_ERROR(TASK_ROLE_LOG_TAG, "Failed to parse output from ECSCredentialService with error " << credentialsDoc.GetErrorMessage());
-        return;
+        return false;
     }
 
     Aws::String accessKey, secretKey, token;
@@ -355,11 +476,41 @@ void TaskRoleCredentialsProvider::Reload()
     token = credentialsView.GetString("Token");
     AWS_LOGSTREAM_DEBUG(TASK_ROLE_LOG_TAG, "Successfully pulled credentials from metadata service with access key " << accessKey);
 
-    m_credentials.SetAWSAccessKeyId(accessKey);
-    m_credentials.SetAWSSecretKey(secretKey);
-    m_credentials.SetSessionToken(token);
-    m_expirationDate = Aws::Utils::DateTime(credentialsView.GetString("Expiration"), DateFormat::ISO_8601);
-    AWSCredentialsProvider::Reload();
+    credentials.SetAWSAccessKeyId(accessKey);
+    credentials.SetAWSSecretKey(secretKey);
+    credentials.SetSessionToken(token);
+    expiration = Aws::Utils::DateTime(credentialsView.GetString("Expiration"), DateFormat::ISO_8601);
+    return true;
+}
+
+void TaskRoleCredentialsProvider::Reload()
+{
+    AWS_LOGSTREAM_INFO(TASK_ROLE_LOG_TAG, "Credentials have expired or will expire, attempting to repull from ECS IAM Service.");
+
+    if (FetchCredentials(m_credentials, m_expirationDate))
+    {
+        m_publishedCredentials.Publish(m_credentials);
+        AWSCredentialsProvider::Reload();
+    }
+}
+
+bool TaskRoleCredentialsProvider::RefreshInBackground(DateTime& expiration)
+{
+    //the credentials service is only called here, without holding the lock readers take.
+    AWSCredentials credentials;
+    DateTime fetchedExpiration;
+    if (!FetchCredentials(credentials, fetchedExpiration) || credentials.GetAWSAccessKeyId().empty())
+    {
+        return false;
+    }
+
+    if (fetchedExpiration.WasParseSuccessful())
+    {
+        expiration = fetchedExpiration;
+    }
+
+    m_publishedCredentials.Publish(credentials);
+    return true;
 }
 
 void TaskRoleCredentialsProvider::RefreshIfExpired()
@@ -14,6 +14,7 @@
   */
 
 #include <aws/core/auth/AWSCredentialsProviderChain.h>
+#include <aws/core/auth/CredentialsProviderCache.h>
 #include <aws/core/platform/Environment.h>
 #include <aws/core/utils/memory/AWSMemory.h>
 #include <aws/core/utils/StringUtils.h>
@@ -26,25 +27,132 @@ static const char AWS_ECS_CONTAINER_CREDENTIALS_FULL_URI[] = "AWS_CONTAINER_CRED
 static const char AWS_ECS_CONTAINER_AUTHORIZATION_TOKEN[] = "AWS_CONTAINER_AUTHORIZATION_TOKEN";
 static const char AWS_EC2_METADATA_DISABLED[] = "AWS_EC2_METADATA_DISABLED";
 static const char DefaultCredentialsProviderChainTag[] = "DefaultAWSCredentialsProviderChain";
+static const int64_t MIN_PROBE_BACKOFF_MS = 1000;
+
+static bool HasCredentials(const AWSCredentials& credentials)
+{
+    return !credentials.GetAWSAccessKeyId().empty() && !credentials.GetAWSSecretKey().empty();
+}
+
+AWSCredentialsProviderChain::AWSCredentialsProviderChain(ChainResolutionMode resolutionMode) :
+    m_resolutionMode(resolutionMode),
+    m_resolvedProviderCount(0),
+    m_nextProbeMs(0),
+    m_probeBackoffMs(0)
+{
+}
+
+AWSCredentialsProviderChain::~AWSCredentialsProviderChain()
+{
+    for (auto& probe : m_probes)
+    {
+        if (probe.thread.joinable())
+        {
+            probe.thread.join();
+        }
+    }
+}
 
 AWSCredentials AWSCredentialsProviderChain::GetAWSCredentials()
 {
-    for (auto&& credentialsProvider : m_providerChain)
+    return *GetAWSCredentialsSnapshot();
+}
+
+std::shared_ptr<const AWSCredentials> AWSCredentialsProviderChain::GetAWSCredentialsSnapshot()
+{
+    //in Concurrent mode only the providers up to the last one that answered are asked in order.
+    size_t orderedCount = m_resolutionMode == ChainResolutionMode::Concurrent ? m_resolvedProviderCount.load() : m_providerChain.size();
+    for (size_t i = 0; i < orderedCount && i < m_providerChain.size(); ++i)
+    {
+        auto credentials = GetCredentialsSnapshot(*m_providerChain[i]);
+        if (HasCredentials(*credentials))
+        {
+            return credentials;
+        }
+    }
+
+    if (m_resolutionMode == ChainResolutionMode::Concurrent)
+    {
+        if (orderedCount < m_providerChain.size())
+        {
+            //no provider had credentials the last time, threads are only started again once the backoff runs out.
+            if (Aws::Utils::DateTime::Now().Millis() < m_nextProbeMs.load())
+            {
+                return Aws::MakeShared<AWSCredentials>(DefaultCredentialsProviderChainTag, "", "");
+            }
+            return ResolveConcurrently(orderedCount);
+        }
+        m_resolvedProviderCount = 0;
+    }
+
+    return Aws::MakeShared<AWSCredentials>(DefaultCredentialsProviderChainTag, "", "");
+}
+
+std::shared_ptr<const AWSCredentials> AWSCredentialsProviderChain::ResolveConcurrently(size_t firstProvider)
+{
+    std::lock_guard<std::mutex> resolveLocker(m_resolveLock);
+    std::unique_lock<std::mutex> locker(m_probeLock);
+    if (m_probes.size() < m_providerChain.size())
+    {
+        m_probes.resize(m_providerChain.size());
+    }
+
+    for (size_t i = firstProvider; i < m_providerChain.size(); ++i)
+    {
+        ProviderProbe& probe = m_probes[i];
+        //a probe abandoned by an earlier call is still on its way, its answer is as good as a new one.
+        if (probe.running)
+        {
+            continue;
+        }
+
+        if (probe.thread.joinable())
+        {
+            probe.thread.join();
+        }
+
+        probe.running = true;
+        probe.done = false;
+        probe.credentials = nullptr;
+        auto provider = m_providerChain[i];
+        probe.thread = std::thread([this, provider, i]()
+        {
+            auto credentials = GetCredentialsSnapshot(*provider);
+            std::lock_guard<std::mutex> probeLocker(m_probeLock);
+            m_probes[i].credentials = credentials;
+            m_probes[i].done = true;
+            m_probes[i].running = false;
+            m_probeSignal.notify_all();
+        });
+    }
+
+    //providers behind the one answering keep running, nobody waits for them.
+    for (size_t i = firstProvider; i < m_providerChain.size(); ++i)
     {
-        AWSCredentials credentials = credentialsProvider->GetAWSCredentials();
-        if (!credentials.GetAWSAccessKeyId().empty() && !credentials.GetAWSSecretKey().empty())
+        m_probeSignal.wait(locker, [this, i]() { return m_probes[i].done; });
+        auto credentials = m_probes[i].credentials;
+        if (HasCredentials(*credentials))
         {
+            AWS_LOGSTREAM_DEBUG(DefaultCredentialsProviderChainTag, "Provider " << i << " of the chain answered the concurrent probe.");
+            m_resolvedProviderCount = i + 1;
+            m_probeBackoffMs = 0;
+            m_nextProbeMs = 0;
             return credentials;
         }
     }
 
-    return AWSCredentials("", "");
+    m_resolvedProviderCount = 0;
+    m_probeBackoffMs = (std::min)((std::max)(m_probeBackoffMs * 2, MIN_PROBE_BACKOFF_MS), static_cast<int64_t>(REFRESH_THRESHOLD));
+    m_nextProbeMs = Aws::Utils::DateTime::Now().Millis() + m_probeBackoffMs;
+    AWS_LOGSTREAM_DEBUG(DefaultCredentialsProviderChainTag, "No provider of the chain has credentials, probing again in " << m_probeBackoffMs << " ms.");
+    return Aws::MakeShared<AWSCredentials>(DefaultCredentialsProviderChainTag, "", "");
 }
 
-DefaultAWSCredentialsProviderChain::DefaultAWSCredentialsProviderChain() : AWSCredentialsProviderChain()
+static CredentialsProviders CreateDefaultProviders()
 {
-    AddProvider(Aws::MakeShared<EnvironmentAWSCredentialsProvider>(DefaultCredentialsProviderChainTag));
-    AddProvider(Aws::MakeShared<ProfileConfigFileAWSCredentialsProvider>(DefaultCredentialsProviderChainTag));
+    CredentialsProviders providers;
+    providers.push_back(Aws::MakeShared<EnvironmentAWSCredentialsProvider>(DefaultCredentialsProviderChainTag));
+    providers.push_back(Aws::MakeShared<ProfileConfigFileAWSCredentialsProvider>(DefaultCredentialsProviderChainTag));
  
     //ECS TaskRole Credentials only available when ENVIRONMENT VARIABLE is set
     const auto relativeUri = Aws::Environment::GetEnv(AWS_ECS_CONTAINER_CREDENTIALS_RELATIVE_URI);
@@ -61,14 +169,14 @@ DefaultAWSCredentialsProviderChain::DefaultAWSCredentialsProviderChain() : AWSCr
 
     if (!relativeUri.empty())
     {
-        AddProvider(Aws::MakeShared<TaskRoleCredentialsProvider>(DefaultCredentialsProviderChainTag, relativeUri.c_str()));
+        providers.push_back(Aws::MakeShared<TaskRoleCredentialsProvider>(DefaultCredentialsProviderChainTag, relativeUri.c_str()));
         AWS_LOGSTREAM_INFO(DefaultCredentialsProviderChainTag, "Added ECS metadata service credentials provider with relative path: ["
                 << relativeUri << "] to the provider chain.");
     }
     else if (!absoluteUri.empty())
     {
         const auto token = Aws::Environment::GetEnv(AWS_ECS_CONTAINER_AUTHORIZATION_TOKEN);
-        AddProvider(Aws::MakeShared<TaskRoleCredentialsProvider>(DefaultCredentialsProviderChainTag,
+        providers.push_back(Aws::MakeShared<TaskRoleCredentialsProvider>(DefaultCredentialsProviderChainTag,
                     absoluteUri.c_str(), token.c_str()));
 
         //DO NOT log the value of the authorization token for security purposes.
@@ -78,7 +186,37 @@ DefaultAWSCredentialsProviderChain::DefaultAWSCredentialsProviderChain() : AWSCr
     }
     else if (Aws::Utils::StringUtils::ToLower(ec2MetadataDisabled.c_str()) != "true")
     {
-        AddProvider(Aws::MakeShared<InstanceProfileCredentialsProvider>(DefaultCredentialsProviderChainTag));
+        providers.push_back(Aws::MakeShared<InstanceProfileCredentialsProvider>(DefaultCredentialsProviderChainTag));
         AWS_LOGSTREAM_INFO(DefaultCredentialsProviderChainTag, "Added EC2 metadata service credentials provider to the provider chain.");
     }
+
+    return providers;
+}
+
+/**
+ * Everything that decides which providers CreateDefaultProviders builds and where they read from.
+ */
+static Aws::String GetDefaultProvidersKey()
+{
+    Aws::String key;
+    key.append(ProfileConfigFileAWSCredentialsProvider::GetDefaultProfileName()).push_back('\n');
+    key.append(ProfileConfigFileAWSCredentialsProvider::GetCredentialsProfileFilename()).push_back('\n');
+    key.append(ProfileConfigFileAWSCredentialsProvider::GetConfigProfileFilename()).push_back('\n');
+    key.append(Aws::Environment::GetEnv(AWS_ECS_CONTAINER_CREDENTIALS_RELATIVE_URI)).push_back('\n');
+    key.append(Aws::Environment::GetEnv(AWS_ECS_CONTAINER_CREDENTIALS_FULL_URI)).push_back('\n');
+    key.append(Aws::Environment::GetEnv(AWS_ECS_CONTAINER_AUTHORIZATION_TOKEN)).push_back('\n');
+    key.append(Aws::Utils::StringUtils::ToLower(Aws::Environment::GetEnv(AWS_EC2_METADATA_DISABLED).c_str()));
+    return key;
+}
+
+DefaultAWSCredentialsProviderChain::DefaultAWSCredentialsProviderChain(ChainResolutionMode resolutionMode) :
+    AWSCredentialsProviderChain(resolutionMode)
+{
+    //clients of the process configured alike share one set of providers, hence one profile parse and one metadata refresh cycle.
+    auto cache = GetCredentialsProviderCache();
+    CredentialsProviders providers = cache ? cache->GetOrCreate(GetDefaultProvidersKey(), CreateDefaultProviders) : CreateDefaultProviders();
+    for (const auto& provider : providers)
+    {
+        AddProvider(provider);
+    }
 }
@@ -0,0 +1,126 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/core/auth/BackgroundCredentialsRefresher.h>
+#include <aws/core/utils/logging/LogMacros.h>
+
+#include <algorithm>
+#include <chrono>
+
+using namespace Aws::Auth;
+using namespace Aws::Utils;
+
+static const char BACKGROUND_REFRESHER_LOG_TAG[] = "BackgroundCredentialsRefresher";
+
+//refresh this long before expiry, or half way through the lifetime of credentials that live shorter than twice that.
+static const int64_t REFRESH_AHEAD_OF_EXPIRY_MS = 5 * 60 * 1000;
+static const long MIN_RETRY_DELAY_MS = 1000;
+static const long MAX_RETRY_DELAY_MS = 60 * 1000;
+static const unsigned JITTER_DIVISOR = 10;
+
+BackgroundCredentialsRefresher::BackgroundCredentialsRefresher(const RefreshFunction& refresh, long refreshRateMs) :
+    m_refresh(refresh),
+    m_refreshRateMs((std::max)(refreshRateMs, 1L)),
+    m_firstRefreshDone(false),
+    m_consecutiveFailures(0),
+    m_stopping(false),
+    m_jitterState(static_cast<unsigned>(std::chrono::steady_clock::now().time_since_epoch().count()) ^ static_cast<unsigned>(reinterpret_cast<size_t>(this)))
+{
+    m_thread = std::thread(&BackgroundCredentialsRefresher::Run, this);
+}
+
+BackgroundCredentialsRefresher::~BackgroundCredentialsRefresher()
+{
+    {
+        std::lock_guard<std::mutex> locker(m_mutex);
+        m_stopping = true;
+    }
+    m_signal.notify_all();
+    if (m_thread.joinable())
+    {
+        m_thread.join();
+    }
+}
+
+void BackgroundCredentialsRefresher::WaitForFirstRefresh()
+{
+    if (m_firstRefreshDone.load(std::memory_order_acquire))
+    {
+        return;
+    }
+
+    std::unique_lock<std::mutex> locker(m_mutex);
+    m_signal.wait(locker, [this] { return m_firstRefreshDone.load() || m_stopping; });
+}
+
+void BackgroundCredentialsRefresher::Run()
+{
+    long delayMs = 0;
+    std::unique_lock<std::mutex> locker(m_mutex);
+    while (!m_stopping)
+    {
+        if (delayMs > 0 && m_signal.wait_for(locker, std::chrono::milliseconds(delayMs), [this] { return m_stopping; }))
+        {
+            break;
+        }
+
+        locker.unlock();
+        DateTime expiration;
+        bool succeeded = m_refresh(expiration);
+        delayMs = GetDelayAfterRefreshMs(succeeded, expiration);
+        locker.lock();
+
+        if (!m_firstRefreshDone.load())
+        {
+            m_firstRefreshDone.store(true, std::memory_order_release);
+            m_signal.notify_all();
+        }
+    }
+}
+
+long BackgroundCredentialsRefresher::GetDelayAfterRefreshMs(bool succeeded, const DateTime& expiration)
+{
+    long delayMs = m_refreshRateMs;
+    if (succeeded)
+    {
+        m_consecutiveFailures = 0;
+        int64_t expiresInMs = expiration.Millis() - DateTime::Now().Millis();
+        if (expiration.Millis() > 0)
+        {
+            int64_t untilRefreshMs = expiresInMs - (std::min)(REFRESH_AHEAD_OF_EXPIRY_MS, expiresInMs / 2);
+            delayMs = static_cast<long>((std::min)(static_cast<int64_t>(delayMs), untilRefreshMs));
+            //credentials handed out already expired, or about to, are not worth asking for again right away.
+            delayMs = (std::max)(delayMs, (std::min)(m_refreshRateMs, MIN_RETRY_DELAY_MS));
+        }
+        AWS_LOGSTREAM_DEBUG(BACKGROUND_REFRESHER_LOG_TAG, "Credentials refreshed, next refresh in about " << delayMs << " ms.");
+    }
+    else
+    {
+        unsigned failures = ++m_consecutiveFailures;
+        long backoffMs = MIN_RETRY_DELAY_MS << (std::min)(failures - 1, 6u);
+        delayMs = (std::min)((std::min)(backoffMs, MAX_RETRY_DELAY_MS), m_refreshRateMs);
+        AWS_LOGSTREAM_WARN(BACKGROUND_REFRESHER_LOG_TAG, "Credentials refresh failed " << failures
+                << " time(s) in a row, keeping the cached credentials and retrying in about " << delayMs << " ms.");
+    }
+
+    //jitter only ever makes the wait shorter, so a refresh never lands later than planned.
+    m_jitterState = m_jitterState * 1664525u + 1013904223u;
+    long jitterRangeMs = delayMs / JITTER_DIVISOR;
+    if (jitterRangeMs > 0)
+    {
+        delayMs -= static_cast<long>((m_jitterState >> 8) % static_cast<unsigned>(jitterRangeMs + 1));
+    }
+    return (std::max)(delayMs, 1L);
+}
@@ -0,0 +1,114 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/core/auth/CredentialsProviderCache.h>
+#include <aws/core/utils/memory/AWSMemory.h>
+
+using namespace Aws::Auth;
+
+static const char CREDENTIALS_PROVIDER_CACHE_TAG[] = "CredentialsProviderCache";
+
+CredentialsProviders CredentialsProviderCache::GetOrCreate(const Aws::String& key, const std::function<CredentialsProviders()>& createProviders)
+{
+    std::lock_guard<std::mutex> locker(m_cacheLock);
+    auto cached = m_providers.find(key);
+    if (cached != m_providers.end())
+    {
+        CredentialsProviders providers;
+        for (const auto& provider : cached->second)
+        {
+            auto alive = provider.lock();
+            if (!alive)
+            {
+                break;
+            }
+            providers.push_back(alive);
+        }
+
+        if (providers.size() == cached->second.size())
+        {
+            return providers;
+        }
+    }
+
+    //creating providers under the lock keeps concurrent clients from building them twice.
+    PurgeExpired();
+    CredentialsProviders providers = createProviders();
+    m_providers[key] = Aws::Vector<std::weak_ptr<AWSCredentialsProvider>>(providers.begin(), providers.end());
+    return providers;
+}
+
+size_t CredentialsProviderCache::GetSize() const
+{
+    std::lock_guard<std::mutex> locker(m_cacheLock);
+    size_t size = 0;
+    for (const auto& entry : m_providers)
+    {
+        if (!entry.second.empty() && !entry.second.front().expired())
+        {
+            ++size;
+        }
+    }
+    return size;
+}
+
+void CredentialsProviderCache::Clear()
+{
+    std::lock_guard<std::mutex> locker(m_cacheLock);
+    m_providers.clear();
+}
+
+void CredentialsProviderCache::PurgeExpired()
+{
+    for (auto entry = m_providers.begin(); entry != m_providers.end();)
+    {
+        if (entry->second.empty() || entry->second.front().expired())
+        {
+            entry = m_providers.erase(entry);
+        }
+        else
+        {
+            ++entry;
+        }
+    }
+}
+
+namespace Aws
+{
+    namespace Auth
+    {
+        static CredentialsProviderCache* s_credentialsProviderCache(nullptr);
+
+        CredentialsProviderCache* GetCredentialsProviderCache()
+        {
+            return s_credentialsProviderCache;
+        }
+
+        void InitCredentialsProviderCache()
+        {
+            if (!s_credentialsProviderCache)
+            {
+                s_credentialsProviderCache = Aws::New<CredentialsProviderCache>(CREDENTIALS_PROVIDER_CACHE_TAG);
+            }
+        }
+
+        void CleanupCredentialsProviderCache()
+        {
+            Aws::Delete(s_credentialsProviderCache);
+            s_credentialsProviderCache = nullptr;
+        }
+
+    } // namespace Auth
+} // namespace Aws
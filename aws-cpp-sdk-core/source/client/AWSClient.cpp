@@ -24,6 +24,7 @@
 #include <aws/core/client/RetryStrategy.h>
 #include <aws/core/http/HttpClient.h>
 #include <aws/core/http/HttpClientFactory.h>
+#include <aws/core/http/HttpClientRegistry.h>
 #include <aws/core/http/HttpResponse.h>
 #include <aws/core/http/standard/StandardHttpResponse.h>
 #include <aws/core/utils/stream/ResponseStream.h>
@@ -31,6 +32,7 @@
 #include <aws/core/utils/Outcome.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/memory/ArenaMemorySystem.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 #include <aws/core/utils/logging/LogMacros.h>
 #include <aws/core/Globals.h>
@@ -41,6 +43,7 @@
 #include <aws/core/utils/crypto/Factories.h>
 #include <aws/core/http/URI.h>
 #include <aws/core/monitoring/MonitoringManager.h>
+#include <aws/core/monitoring/RequestPhaseTimings.h>
 
 using namespace Aws;
 using namespace Aws::Client;
@@ -48,6 +51,7 @@ using namespace Aws::Http;
 using namespace Aws::Utils;
 using namespace Aws::Utils::Json;
 using namespace Aws::Utils::Xml;
+using Aws::Monitoring::RequestPhase;
 
 static const int SUCCESS_RESPONSE_MIN = 200;
 static const int SUCCESS_RESPONSE_MAX = 299;
@@ -72,10 +76,17 @@ static CoreErrors GuessBodylessErrorType(Aws::Http::HttpResponseCode responseCod
     }    
 }
 
+static std::shared_ptr<HttpClient> CreateClientHttpClient(const Aws::Client::ClientConfiguration& configuration)
+{
+    auto registry = configuration.shareHttpClient ? GetHttpClientRegistry() : nullptr;
+    return registry ? registry->GetOrCreate(configuration) : CreateHttpClient(configuration);
+}
+
 AWSClient::AWSClient(const Aws::Client::ClientConfiguration& configuration,
     const std::shared_ptr<Aws::Client::AWSAuthSigner>& signer,
     const std::shared_ptr<AWSErrorMarshaller>& errorMarshaller) :
-    m_httpClient(CreateHttpClient(configuration)),
+    m_httpClient(nullptr),
+    m_httpClientConfiguration(Aws::MakeShared<ClientConfiguration>(AWS_CLIENT_LOG_TAG, configuration)),
     m_signerProvider(Aws::MakeUnique<Aws::Auth::DefaultAuthSignerProvider>(AWS_CLIENT_LOG_TAG, signer)),
     m_errorMarshaller(errorMarshaller),
     m_retryStrategy(configuration.retryStrategy),
@@ -83,14 +94,17 @@ AWSClient::AWSClient(const Aws::Client::ClientConfiguration& configuration,
     m_readRateLimiter(configuration.readRateLimiter),
     m_userAgent(configuration.userAgent),
     m_hash(Aws::Utils::Crypto::CreateMD5Implementation()),
-    m_enableClockSkewAdjustment(configuration.enableClockSkewAdjustment)
+    m_enableClockSkewAdjustment(configuration.enableClockSkewAdjustment),
+    m_httpClientReady(false),
+    m_requestProcessingDisabled(false)
 {
 }
 
 AWSClient::AWSClient(const Aws::Client::ClientConfiguration& configuration,
     const std::shared_ptr<Aws::Auth::AWSAuthSignerProvider>& signerProvider,
     const std::shared_ptr<AWSErrorMarshaller>& errorMarshaller) :
-    m_httpClient(CreateHttpClient(configuration)),
+    m_httpClient(nullptr),
+    m_httpClientConfiguration(Aws::MakeShared<ClientConfiguration>(AWS_CLIENT_LOG_TAG, configuration)),
     m_signerProvider(signerProvider),
     m_errorMarshaller(errorMarshaller),
     m_retryStrategy(configuration.retryStrategy),
@@ -98,18 +112,45 @@ AWSClient::AWSClient(const Aws::Client::ClientConfiguration& configuration,
     m_readRateLimiter(configuration.readRateLimiter),
     m_userAgent(configuration.userAgent),
     m_hash(Aws::Utils::Crypto::CreateMD5Implementation()),
-    m_enableClockSkewAdjustment(configuration.enableClockSkewAdjustment)
+    m_enableClockSkewAdjustment(configuration.enableClockSkewAdjustment),
+    m_httpClientReady(false),
+    m_requestProcessingDisabled(false)
 {
 }
 
 void AWSClient::DisableRequestProcessing() 
 { 
-    m_httpClient->DisableRequestProcessing(); 
+    m_requestProcessingDisabled = true;
+    if (m_httpClientReady)
+    {
+        m_httpClient->DisableRequestProcessing();
+    }
 }
 
 void AWSClient::EnableRequestProcessing() 
 { 
-    m_httpClient->EnableRequestProcessing();
+    m_requestProcessingDisabled = false;
+    if (m_httpClientReady)
+    {
+        m_httpClient->EnableRequestProcessing();
+    }
+}
+
+const std::shared_ptr<HttpClient>& AWSClient::GetHttpClient() const
+{
+    std::call_once(m_httpClientCreated, [this]()
+    {
+        Utils::Memory::HeapScope heapScope;
+        m_httpClient = CreateClientHttpClient(*m_httpClientConfiguration);
+        m_httpClientConfiguration = nullptr;
+        //marked ready before the flag is read, so a concurrent DisableRequestProcessing either sees the client or is seen here.
+        m_httpClientReady = true;
+        if (m_requestProcessingDisabled)
+        {
+            m_httpClient->DisableRequestProcessing();
+        }
+    });
+    return m_httpClient;
 }
 
 Aws::Client::AWSAuthSigner* AWSClient::GetSignerByName(const char* name) const
@@ -165,12 +206,25 @@ bool AWSClient::AdjustClockSkew(HttpResponseOutcome& outcome, const char* signer
     return false;
 }
 
+static void ParseResponse(const ResponseParser& responseParser, const std::shared_ptr<HttpRequest>& httpRequest, const HttpResponseOutcome& outcome)
+{
+    if (responseParser && outcome.IsSuccess())
+    {
+        auto parseStart = std::chrono::steady_clock::now();
+        responseParser(outcome.GetResult());
+        httpRequest->AddPhaseDuration(RequestPhase::ResponseParsing, std::chrono::steady_clock::now() - parseStart);
+    }
+}
+
 HttpResponseOutcome AWSClient::AttemptExhaustively(const Aws::Http::URI& uri,
     const Aws::AmazonWebServiceRequest& request,
     HttpMethod method,
-    const char* signerName) const
+    const char* signerName,
+    const ResponseParser& responseParser) const
 {
+    auto createStart = std::chrono::steady_clock::now();
     std::shared_ptr<HttpRequest> httpRequest(CreateHttpRequest(uri, method, request.GetResponseStreamFactory()));
+    httpRequest->AddPhaseDuration(RequestPhase::EndpointResolution, std::chrono::steady_clock::now() - createStart);
     HttpResponseOutcome outcome;
     Aws::Monitoring::CoreMetricsCollection coreMetrics;
     auto contexts = Aws::Monitoring::OnRequestStarted(this->GetServiceClientName(), request.GetServiceRequestName(), httpRequest);
@@ -178,7 +232,9 @@ HttpResponseOutcome AWSClient::AttemptExhaustively(const Aws::Http::URI& uri,
     for (long retries = 0;; retries++)
     {
         outcome = AttemptOneRequest(httpRequest, request, signerName);
+        ParseResponse(responseParser, httpRequest, outcome);
         coreMetrics.httpClientMetrics = httpRequest->GetRequestMetrics();
+        coreMetrics.phaseTimings = httpRequest->GetPhaseTimings();
         if (outcome.IsSuccess())
         {
             Aws::Monitoring::OnRequestSucceeded(this->GetServiceClientName(), request.GetServiceRequestName(), httpRequest, outcome, coreMetrics, contexts);
@@ -188,7 +244,7 @@ HttpResponseOutcome AWSClient::AttemptExhaustively(const Aws::Http::URI& uri,
 
         Aws::Monitoring::OnRequestFailed(this->GetServiceClientName(), request.GetServiceRequestName(), httpRequest, outcome, coreMetrics, contexts);
 
-        if (!m_httpClient->IsRequestProcessingEnabled())
+        if (!GetHttpClient()->IsRequestProcessingEnabled())
         {
             AWS_LOGSTREAM_TRACE(AWS_CLIENT_LOG_TAG, "Request was cancelled externally.");
             break;
@@ -216,20 +272,27 @@ HttpResponseOutcome AWSClient::AttemptExhaustively(const Aws::Http::URI& uri,
             request.GetRequestRetryHandler()(request);
         }
 
+        auto backoffStart = std::chrono::steady_clock::now();
         if (shouldSleep)
         {
-            m_httpClient->RetryRequestSleep(std::chrono::milliseconds(sleepMillis));
+            GetHttpClient()->RetryRequestSleep(std::chrono::milliseconds(sleepMillis));
         }
+        createStart = std::chrono::steady_clock::now();
         httpRequest = CreateHttpRequest(uri, method, request.GetResponseStreamFactory());
+        httpRequest->AddPhaseDuration(RequestPhase::RetryBackoff, createStart - backoffStart);
+        httpRequest->AddPhaseDuration(RequestPhase::EndpointResolution, std::chrono::steady_clock::now() - createStart);
         Aws::Monitoring::OnRequestRetry(this->GetServiceClientName(), request.GetServiceRequestName(), httpRequest, contexts);
     }
     Aws::Monitoring::OnFinish(this->GetServiceClientName(), request.GetServiceRequestName(), httpRequest, contexts);
     return outcome;
 }
 
-HttpResponseOutcome AWSClient::AttemptExhaustively(const Aws::Http::URI& uri, HttpMethod method, const char* signerName, const char* requestName) const
+HttpResponseOutcome AWSClient::AttemptExhaustively(const Aws::Http::URI& uri, HttpMethod method, const char* signerName, const char* requestName,
+    const ResponseParser& responseParser) const
 {
+    auto createStart = std::chrono::steady_clock::now();
     std::shared_ptr<HttpRequest> httpRequest(CreateHttpRequest(uri, method, Aws::Utils::Stream::DefaultResponseStreamFactoryMethod));
+    httpRequest->AddPhaseDuration(RequestPhase::EndpointResolution, std::chrono::steady_clock::now() - createStart);
     HttpResponseOutcome outcome;
     Aws::Monitoring::CoreMetricsCollection coreMetrics;
     auto contexts = Aws::Monitoring::OnRequestStarted(this->GetServiceClientName(), requestName, httpRequest);
@@ -237,7 +300,9 @@ HttpResponseOutcome AWSClient::AttemptExhaustively(const Aws::Http::URI& uri, Ht
     for (long retries = 0;; retries++)
     {
         outcome = AttemptOneRequest(httpRequest, signerName);
+        ParseResponse(responseParser, httpRequest, outcome);
         coreMetrics.httpClientMetrics = httpRequest->GetRequestMetrics();
+        coreMetrics.phaseTimings = httpRequest->GetPhaseTimings();
         if (outcome.IsSuccess())
         {
             Aws::Monitoring::OnRequestSucceeded(this->GetServiceClientName(), requestName, httpRequest, outcome, coreMetrics, contexts);
@@ -247,7 +312,7 @@ HttpResponseOutcome AWSClient::AttemptExhaustively(const Aws::Http::URI& uri, Ht
 
         Aws::Monitoring::OnRequestFailed(this->GetServiceClientName(), requestName, httpRequest, outcome, coreMetrics, contexts);
 
-        if (!m_httpClient->IsRequestProcessingEnabled())
+        if (!GetHttpClient()->IsRequestProcessingEnabled())
         {
             AWS_LOGSTREAM_TRACE(AWS_CLIENT_LOG_TAG, "Request was cancelled externally.");
             break;
@@ -265,11 +330,15 @@ HttpResponseOutcome AWSClient::AttemptExhaustively(const Aws::Http::URI& uri, Ht
 
         AWS_LOGSTREAM_WARN(AWS_CLIENT_LOG_TAG, "Request failed, now waiting " << sleepMillis << " ms before attempting again.");
 
+        auto backoffStart = std::chrono::steady_clock::now();
         if (shouldSleep)
         {
-            m_httpClient->RetryRequestSleep(std::chrono::milliseconds(sleepMillis));
+            GetHttpClient()->RetryRequestSleep(std::chrono::milliseconds(sleepMillis));
         }
+        createStart = std::chrono::steady_clock::now();
         httpRequest = CreateHttpRequest(uri, method, Aws::Utils::Stream::DefaultResponseStreamFactoryMethod);
+        httpRequest->AddPhaseDuration(RequestPhase::RetryBackoff, createStart - backoffStart);
+        httpRequest->AddPhaseDuration(RequestPhase::EndpointResolution, std::chrono::steady_clock::now() - createStart);
         Aws::Monitoring::OnRequestRetry(this->GetServiceClientName(), requestName, httpRequest, contexts);
     }
     Aws::Monitoring::OnFinish(this->GetServiceClientName(), requestName, httpRequest, contexts);
@@ -288,9 +357,16 @@ static bool DoesResponseGenerateError(const std::shared_ptr<HttpResponse>& respo
 HttpResponseOutcome AWSClient::AttemptOneRequest(const std::shared_ptr<HttpRequest>& httpRequest,
     const Aws::AmazonWebServiceRequest& request, const char* signerName) const
 {
+    auto phaseStart = std::chrono::steady_clock::now();
     BuildHttpRequest(request, httpRequest);
+    auto phaseEnd = std::chrono::steady_clock::now();
+    httpRequest->AddPhaseDuration(RequestPhase::Serialization, phaseEnd - phaseStart);
+
+    phaseStart = phaseEnd;
     auto signer = GetSignerByName(signerName);
-    if (!signer->SignRequest(*httpRequest, request.SignBody()))
+    bool wasSigned = signer->SignRequest(*httpRequest, request.SignBody());
+    httpRequest->AddPhaseDuration(RequestPhase::Signing, std::chrono::steady_clock::now() - phaseStart);
+    if (!wasSigned)
     {
         AWS_LOGSTREAM_ERROR(AWS_CLIENT_LOG_TAG, "Request signing failed. Returning error.");
         return HttpResponseOutcome(AWSError<CoreErrors>(CoreErrors::CLIENT_SIGNING_FAILURE, "", "SDK failed to sign the request", false/*retryable*/));
@@ -298,12 +374,15 @@ HttpResponseOutcome AWSClient::AttemptOneRequest(const std::shared_ptr<HttpReque
 
     AWS_LOGSTREAM_DEBUG(AWS_CLIENT_LOG_TAG, "Request Successfully signed");
     std::shared_ptr<HttpResponse> httpResponse(
-        m_httpClient->MakeRequest(httpRequest, m_readRateLimiter.get(), m_writeRateLimiter.get()));
+        GetHttpClient()->MakeRequest(httpRequest, m_readRateLimiter.get(), m_writeRateLimiter.get()));
 
     if (DoesResponseGenerateError(httpResponse))
     {
         AWS_LOGSTREAM_DEBUG(AWS_CLIENT_LOG_TAG, "Request returned error. Attempting to generate appropriate error codes from response");
-        return HttpResponseOutcome(BuildAWSError(httpResponse));
+        auto parseStart = std::chrono::steady_clock::now();
+        HttpResponseOutcome errorOutcome(BuildAWSError(httpResponse));
+        httpRequest->AddPhaseDuration(RequestPhase::ResponseParsing, std::chrono::steady_clock::now() - parseStart);
+        return errorOutcome;
     }
 
     AWS_LOGSTREAM_DEBUG(AWS_CLIENT_LOG_TAG, "Request returned successful response.");
@@ -315,24 +394,33 @@ HttpResponseOutcome AWSClient::AttemptOneRequest(const std::shared_ptr<HttpReque
 {
     AWS_UNREFERENCED_PARAM(requestName);
 
+    auto phaseStart = std::chrono::steady_clock::now();
     auto signer = GetSignerByName(signerName);
-    if (!signer->SignRequest(*httpRequest))
+    bool wasSigned = signer->SignRequest(*httpRequest);
+    auto phaseEnd = std::chrono::steady_clock::now();
+    httpRequest->AddPhaseDuration(RequestPhase::Signing, phaseEnd - phaseStart);
+    if (!wasSigned)
     {
         AWS_LOGSTREAM_ERROR(AWS_CLIENT_LOG_TAG, "Request signing failed. Returning error.");
         return HttpResponseOutcome(AWSError<CoreErrors>(CoreErrors::CLIENT_SIGNING_FAILURE, "", "SDK failed to sign the request", false/*retryable*/));
     }
 
     //user agent and headers like that shouldn't be signed for the sake of compatibility with proxies which MAY mutate that header.
+    phaseStart = phaseEnd;
     AddCommonHeaders(*httpRequest);
+    httpRequest->AddPhaseDuration(RequestPhase::Serialization, std::chrono::steady_clock::now() - phaseStart);
 
     AWS_LOGSTREAM_DEBUG(AWS_CLIENT_LOG_TAG, "Request Successfully signed");
     std::shared_ptr<HttpResponse> httpResponse(
-        m_httpClient->MakeRequest(httpRequest, m_readRateLimiter.get(), m_writeRateLimiter.get()));
+        GetHttpClient()->MakeRequest(httpRequest, m_readRateLimiter.get(), m_writeRateLimiter.get()));
 
     if (DoesResponseGenerateError(httpResponse))
     {
         AWS_LOGSTREAM_DEBUG(AWS_CLIENT_LOG_TAG, "Request returned error. Attempting to generate appropriate error codes from response");
-        return HttpResponseOutcome(BuildAWSError(httpResponse));
+        auto parseStart = std::chrono::steady_clock::now();
+        HttpResponseOutcome errorOutcome(BuildAWSError(httpResponse));
+        httpRequest->AddPhaseDuration(RequestPhase::ResponseParsing, std::chrono::steady_clock::now() - parseStart);
+        return errorOutcome;
     }
 
     AWS_LOGSTREAM_DEBUG(AWS_CLIENT_LOG_TAG, "Request returned successful response.");
@@ -585,7 +673,16 @@ JsonOutcome AWSJsonClient::MakeRequest(const Aws::Http::URI& uri,
     Http::HttpMethod method,
     const char* signerName) const
 {
-    HttpResponseOutcome httpOutcome(BASECLASS::AttemptExhaustively(uri, request, method, signerName));
+    Aws::Utils::Memory::ArenaScope arenaScope;
+    JsonValue jsonValue;
+    HttpResponseOutcome httpOutcome(BASECLASS::AttemptExhaustively(uri, request, method, signerName,
+        [&jsonValue](const std::shared_ptr<HttpResponse>& response)
+        {
+            if (response->GetResponseBody().tellp() > 0)
+            {
+                jsonValue = JsonValue(response->GetResponseBody());
+            }
+        }));
     if (!httpOutcome.IsSuccess())
     {
         return JsonOutcome(httpOutcome.GetError());
@@ -593,7 +690,7 @@ JsonOutcome AWSJsonClient::MakeRequest(const Aws::Http::URI& uri,
 
     if (httpOutcome.GetResult()->GetResponseBody().tellp() > 0)
         //this is stupid, but gcc doesn't pick up the covariant on the dereference so we have to give it a little hint.
-        return JsonOutcome(AmazonWebServiceResult<JsonValue>(JsonValue(httpOutcome.GetResult()->GetResponseBody()),
+        return JsonOutcome(AmazonWebServiceResult<JsonValue>(std::move(jsonValue),
         httpOutcome.GetResult()->GetHeaders(),
         httpOutcome.GetResult()->GetResponseCode()));
 
@@ -606,7 +703,16 @@ JsonOutcome AWSJsonClient::MakeRequest(const Aws::Http::URI& uri,
     const char* signerName,
     const char* requestName) const
 {
-    HttpResponseOutcome httpOutcome(BASECLASS::AttemptExhaustively(uri, method, signerName, requestName));
+    Aws::Utils::Memory::ArenaScope arenaScope;
+    JsonValue jsonValue;
+    HttpResponseOutcome httpOutcome(BASECLASS::AttemptExhaustively(uri, method, signerName, requestName,
+        [&jsonValue](const std::shared_ptr<HttpResponse>& response)
+        {
+            if (response->GetResponseBody().tellp() > 0)
+            {
+                jsonValue = JsonValue(response->GetResponseBody());
+            }
+        }));
     if (!httpOutcome.IsSuccess())
     {
         return JsonOutcome(httpOutcome.GetError());
@@ -614,7 +720,6 @@ JsonOutcome AWSJsonClient::MakeRequest(const Aws::Http::URI& uri,
 
     if (httpOutcome.GetResult()->GetResponseBody().tellp() > 0)
     {
-        JsonValue jsonValue(httpOutcome.GetResult()->GetResponseBody());
         if (!jsonValue.WasParseSuccessful())
         {
             return JsonOutcome(AWSError<CoreErrors>(CoreErrors::UNKNOWN, "Json Parser Error", jsonValue.GetErrorMessage(), false));
@@ -681,7 +786,16 @@ XmlOutcome AWSXMLClient::MakeRequest(const Aws::Http::URI& uri,
     Http::HttpMethod method,
     const char* signerName) const
 {
-    HttpResponseOutcome httpOutcome(BASECLASS::AttemptExhaustively(uri, request, method, signerName));
+    Aws::Utils::Memory::ArenaScope arenaScope;
+    XmlDocument xmlDoc;
+    HttpResponseOutcome httpOutcome(BASECLASS::AttemptExhaustively(uri, request, method, signerName,
+        [&xmlDoc](const std::shared_ptr<HttpResponse>& response)
+        {
+            if (response->GetResponseBody().tellp() > 0)
+            {
+                xmlDoc = XmlDocument::CreateFromXmlStream(response->GetResponseBody());
+            }
+        }));
     if (!httpOutcome.IsSuccess())
     {
         return XmlOutcome(httpOutcome.GetError());
@@ -689,8 +803,6 @@ XmlOutcome AWSXMLClient::MakeRequest(const Aws::Http::URI& uri,
 
     if (httpOutcome.GetResult()->GetResponseBody().tellp() > 0)
     {
-        XmlDocument xmlDoc = XmlDocument::CreateFromXmlStream(httpOutcome.GetResult()->GetResponseBody());
-
         if (!xmlDoc.WasParseSuccessful())
         {
             AWS_LOGSTREAM_ERROR(AWS_CLIENT_LOG_TAG, "Xml parsing for error failed with message " << xmlDoc.GetErrorMessage().c_str());
@@ -709,7 +821,16 @@ XmlOutcome AWSXMLClient::MakeRequest(const Aws::Http::URI& uri,
     const char* signerName,
     const char* requestName) const
 {
-    HttpResponseOutcome httpOutcome(BASECLASS::AttemptExhaustively(uri, method, signerName, requestName));
+    Aws::Utils::Memory::ArenaScope arenaScope;
+    XmlDocument xmlDoc;
+    HttpResponseOutcome httpOutcome(BASECLASS::AttemptExhaustively(uri, method, signerName, requestName,
+        [&xmlDoc](const std::shared_ptr<HttpResponse>& response)
+        {
+            if (response->GetResponseBody().tellp() > 0)
+            {
+                xmlDoc = XmlDocument::CreateFromXmlStream(response->GetResponseBody());
+            }
+        }));
     if (!httpOutcome.IsSuccess())
     {
         return XmlOutcome(httpOutcome.GetError());
@@ -717,12 +838,11 @@ XmlOutcome AWSXMLClient::MakeRequest(const Aws::Http::URI& uri,
 
     if (httpOutcome.GetResult()->GetResponseBody().tellp() > 0)
     {
-        return XmlOutcome(AmazonWebServiceResult<XmlDocument>(
-            XmlDocument::CreateFromXmlStream(httpOutcome.GetResult()->GetResponseBody()),
+        return XmlOutcome(AmazonWebServiceResult<XmlDocument>(std::move(xmlDoc),
             httpOutcome.GetResult()->GetHeaders(), httpOutcome.GetResult()->GetResponseCode()));
     }
 
-    return XmlOutcome(AmazonWebServiceResult<XmlDocument>(XmlDocument(), httpOutcome.GetResult()->GetHeaders()));
+    return XmlOutcome(AmazonWebServiceResult<XmlDocument>(std::move(xmlDoc), httpOutcome.GetResult()->GetHeaders()));
 }
 
 AWSError<CoreErrors> AWSXMLClient::BuildAWSError(const std::shared_ptr<Http::HttpResponse>& httpResponse) const
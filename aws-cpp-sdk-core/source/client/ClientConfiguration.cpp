@@ -43,6 +43,7 @@ ClientConfiguration::ClientConfiguration() :
     region(Region::US_EAST_1),
     useDualStack(false),
     maxConnections(25), 
+    maxConnectionsPerHost(0),
     requestTimeoutMs(3000), 
     connectTimeoutMs(1000),
     enableTcpKeepAlive(true),
@@ -58,7 +59,8 @@ ClientConfiguration::ClientConfiguration() :
     httpLibOverride(Aws::Http::TransferLibType::DEFAULT_CLIENT),
     followRedirects(true),
     disableExpectHeader(false),
-    enableClockSkewAdjustment(true)
+    enableClockSkewAdjustment(true),
+    shareHttpClient(false)
 {
 }
 
@@ -18,6 +18,7 @@
 #if ENABLE_CURL_CLIENT
 #include <aws/core/http/curl/CurlHttpClient.h>
 #include <signal.h>
+#include <mutex>
 
 #elif ENABLE_WINDOWS_CLIENT
 #include <aws/core/client/ClientConfiguration.h>
@@ -66,6 +67,12 @@ namespace Aws
 
         class DefaultHttpClientFactory : public HttpClientFactory
         {
+#if ENABLE_CURL_CLIENT
+        public:
+            DefaultHttpClientFactory() : m_curlGlobalStateInitialized(false) {}
+
+        private:
+#endif
             std::shared_ptr<HttpClient> CreateHttpClient(const ClientConfiguration& clientConfiguration) const override
             {
                 // Figure out whether the selected option is available but fail gracefully and return a default of some type if not
@@ -100,6 +107,7 @@ namespace Aws
                 }
 #endif // ENABLE_WINDOWS_IXML_HTTP_REQUEST_2_CLIENT
 #elif ENABLE_CURL_CLIENT
+                InitCurlGlobalState();
                 return Aws::MakeShared<CurlHttpClient>(HTTP_CLIENT_FACTORY_ALLOCATION_TAG, clientConfiguration);
 #else
                 // When neither of these clients is enabled, gcc gives a warning (converted
@@ -127,10 +135,7 @@ namespace Aws
             void InitStaticState() override
             {
 #if ENABLE_CURL_CLIENT
-                if(s_InitCleanupCurlFlag)
-                {
-                    CurlHttpClient::InitGlobalState();
-                }
+                //libcurl's global state, which includes initializing the tls library, is set up with the first curl client.
 #if !defined (_WIN32)
                 if(s_InstallSigPipeHandler)
                 {
@@ -145,12 +150,30 @@ namespace Aws
             virtual void CleanupStaticState() override
             {
 #if ENABLE_CURL_CLIENT
-                if(s_InitCleanupCurlFlag)
+                std::lock_guard<std::mutex> locker(m_curlGlobalStateMutex);
+                if(m_curlGlobalStateInitialized)
                 {
                     CurlHttpClient::CleanupGlobalState();
+                    m_curlGlobalStateInitialized = false;
                 }
 #endif
             }
+
+#if ENABLE_CURL_CLIENT
+        private:
+            void InitCurlGlobalState() const
+            {
+                std::lock_guard<std::mutex> locker(m_curlGlobalStateMutex);
+                if(s_InitCleanupCurlFlag && !m_curlGlobalStateInitialized)
+                {
+                    CurlHttpClient::InitGlobalState();
+                    m_curlGlobalStateInitialized = true;
+                }
+            }
+
+            mutable std::mutex m_curlGlobalStateMutex;
+            mutable bool m_curlGlobalStateInitialized;
+#endif
         };
 
         void SetInitCleanupCurlFlag(bool initCleanupFlag)
@@ -0,0 +1,137 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/core/http/HttpClientRegistry.h>
+#include <aws/core/http/HttpClient.h>
+#include <aws/core/http/HttpClientFactory.h>
+#include <aws/core/client/ClientConfiguration.h>
+#include <aws/core/utils/HashingUtils.h>
+#include <aws/core/utils/memory/AWSMemory.h>
+#include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/logging/LogMacros.h>
+
+using namespace Aws::Http;
+using namespace Aws::Client;
+
+static const char HTTP_CLIENT_REGISTRY_TAG[] = "HttpClientRegistry";
+
+std::shared_ptr<HttpClient> HttpClientRegistry::GetOrCreate(const ClientConfiguration& clientConfiguration)
+{
+    Aws::String key = ComputeKey(clientConfiguration);
+
+    std::lock_guard<std::mutex> locker(m_registryLock);
+    auto registered = m_httpClients.find(key);
+    if (registered != m_httpClients.end())
+    {
+        auto httpClient = registered->second.lock();
+        if (httpClient)
+        {
+            return httpClient;
+        }
+    }
+
+    for (auto entry = m_httpClients.begin(); entry != m_httpClients.end();)
+    {
+        if (entry->second.expired())
+        {
+            entry = m_httpClients.erase(entry);
+        }
+        else
+        {
+            ++entry;
+        }
+    }
+
+    AWS_LOGSTREAM_DEBUG(HTTP_CLIENT_REGISTRY_TAG, "Creating shared http client, " << m_httpClients.size() << " already registered.");
+    auto httpClient = CreateHttpClient(clientConfiguration);
+    m_httpClients[key] = httpClient;
+    return httpClient;
+}
+
+size_t HttpClientRegistry::GetSize() const
+{
+    std::lock_guard<std::mutex> locker(m_registryLock);
+    size_t size = 0;
+    for (const auto& entry : m_httpClients)
+    {
+        if (!entry.second.expired())
+        {
+            ++size;
+        }
+    }
+    return size;
+}
+
+void HttpClientRegistry::Clear()
+{
+    std::lock_guard<std::mutex> locker(m_registryLock);
+    m_httpClients.clear();
+}
+
+Aws::String HttpClientRegistry::ComputeKey(const ClientConfiguration& clientConfiguration)
+{
+    //everything the http clients of any platform read from the configuration.
+    Aws::StringStream key;
+    key << static_cast<int>(clientConfiguration.httpLibOverride) << '\n'
+        << static_cast<int>(clientConfiguration.scheme) << '\n'
+        << clientConfiguration.maxConnections << '\n'
+        << clientConfiguration.maxConnectionsPerHost << '\n'
+        << clientConfiguration.requestTimeoutMs << '\n'
+        << clientConfiguration.connectTimeoutMs << '\n'
+        << clientConfiguration.enableTcpKeepAlive << '\n'
+        << clientConfiguration.tcpKeepAliveIntervalMs << '\n'
+        << clientConfiguration.lowSpeedLimit << '\n'
+        << static_cast<int>(clientConfiguration.proxyScheme) << '\n'
+        << clientConfiguration.proxyHost << '\n'
+        << clientConfiguration.proxyPort << '\n'
+        << clientConfiguration.proxyUserName << '\n'
+        << clientConfiguration.proxyPassword << '\n'
+        << clientConfiguration.verifySSL << '\n'
+        << clientConfiguration.caPath << '\n'
+        << clientConfiguration.caFile << '\n'
+        << clientConfiguration.followRedirects << '\n'
+        << clientConfiguration.disableExpectHeader << '\n'
+        << clientConfiguration.userAgent;
+    //the registry lives as long as the process, it keeps no proxy credentials in the clear.
+    return Aws::Utils::HashingUtils::HexEncode(Aws::Utils::HashingUtils::CalculateSHA256(key.str()));
+}
+
+namespace Aws
+{
+    namespace Http
+    {
+        static HttpClientRegistry* s_httpClientRegistry(nullptr);
+
+        HttpClientRegistry* GetHttpClientRegistry()
+        {
+            return s_httpClientRegistry;
+        }
+
+        void InitHttpClientRegistry()
+        {
+            if (!s_httpClientRegistry)
+            {
+                s_httpClientRegistry = Aws::New<HttpClientRegistry>(HTTP_CLIENT_REGISTRY_TAG);
+            }
+        }
+
+        void CleanupHttpClientRegistry()
+        {
+            Aws::Delete(s_httpClientRegistry);
+            s_httpClientRegistry = nullptr;
+        }
+
+    } // namespace Http
+} // namespace Aws
@@ -19,6 +19,7 @@
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 #include <aws/core/utils/memory/stl/AWSSet.h>
 
+#include <cstring>
 #include <cstdlib>
 #include <cctype>
 #include <cassert>
@@ -282,6 +283,16 @@ void URI::CanonicalizeQueryString()
 }
 
 void URI::AddQueryStringParameter(const char* key, const Aws::String& value)
+{
+    AddQueryStringParameter(key, Aws::Utils::StringView(value));
+}
+
+void URI::AddQueryStringParameter(const char* key, const char* value)
+{
+    AddQueryStringParameter(key, Aws::Utils::StringView(value));
+}
+
+void URI::AddQueryStringParameter(const char* key, Aws::Utils::StringView value)
 {
     if (m_queryString.size() <= 0)
     {
@@ -292,7 +303,9 @@ void URI::AddQueryStringParameter(const char* key, const Aws::String& value)
         m_queryString.append("&");
     }
 
-    m_queryString.append(StringUtils::URLEncode(key) + "=" + StringUtils::URLEncode(value.c_str()));
+    StringUtils::URLEncodeAppend(m_queryString, key, strlen(key));
+    m_queryString.append("=");
+    StringUtils::URLEncodeAppend(m_queryString, value.data(), value.size());
 }
 
 void URI::AddQueryStringParameter(const Aws::Map<Aws::String, Aws::String>& queryStringPairs)
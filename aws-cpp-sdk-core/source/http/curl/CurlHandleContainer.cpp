@@ -15,6 +15,7 @@
 
 #include <aws/core/http/curl/CurlHandleContainer.h>
 #include <aws/core/utils/logging/LogMacros.h>
+#include <aws/core/utils/memory/ArenaMemorySystem.h>
 
 #include <algorithm>
 
@@ -74,6 +75,7 @@ bool CurlHandleContainer::CheckAndGrowPool()
     std::lock_guard<std::mutex> locker(m_containerLock);
     if (m_poolSize < m_maxPoolSize)
     {
+        Aws::Utils::Memory::HeapScope heapScope;
         unsigned multiplier = m_poolSize > 0 ? m_poolSize : 1;
         unsigned amountToAdd = (std::min)(multiplier * 2, m_maxPoolSize - m_poolSize);
         AWS_LOGSTREAM_DEBUG(CURL_HANDLE_CONTAINER_TAG, "attempting to grow pool size by " << amountToAdd);
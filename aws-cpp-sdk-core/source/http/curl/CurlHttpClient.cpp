@@ -23,6 +23,7 @@
 #include <aws/core/monitoring/HttpClientMetrics.h>
 #include <cassert>
 #include <algorithm>
+#include <chrono>
 
 
 using namespace Aws::Client;
@@ -155,15 +156,49 @@ struct CurlReadCallbackContext
     CurlReadCallbackContext(const CurlHttpClient* client, HttpRequest* request, Aws::Utils::RateLimits::RateLimiterInterface* limiter) :
         m_client(client),
         m_rateLimiter(limiter),
-        m_request(request)
+        m_request(request),
+        m_lastReadTime()
     {}
 
     const CurlHttpClient* m_client;
     Aws::Utils::RateLimits::RateLimiterInterface* m_rateLimiter;
     HttpRequest* m_request;
+    std::chrono::steady_clock::time_point m_lastReadTime;
 };
 
 static const char* CURL_HTTP_CLIENT_TAG = "CurlHttpClient";
+//how often a request waiting for a connection to its host checks whether request processing got disabled.
+static const std::chrono::milliseconds HOST_CONNECTION_WAIT_INTERVAL(100);
+
+static std::chrono::steady_clock::time_point GetCurlTimePoint(CURL* handle, CURLINFO info, std::chrono::steady_clock::time_point performStart)
+{
+    double seconds = 0.0; //from the start of curl_easy_perform
+    if (curl_easy_getinfo(handle, info, &seconds) != CURLE_OK || seconds < 0.0)
+    {
+        seconds = 0.0;
+    }
+    return performStart + std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double>(seconds));
+}
+
+//splits the time curl_easy_perform took into the network phases of the request; waiting for a pooled handle counts as connecting.
+static void AddCurlPhaseDurations(CURL* handle, HttpRequest& request, std::chrono::steady_clock::duration acquireDuration,
+    std::chrono::steady_clock::time_point performStart, std::chrono::steady_clock::time_point performEnd,
+    std::chrono::steady_clock::time_point lastBodyRead)
+{
+    using Aws::Monitoring::RequestPhase;
+
+    //curl reports 0 for the steps it skipped, e.g. connecting on a reused connection, so every point is clamped to stay in order.
+    auto connected = (std::max)(GetCurlTimePoint(handle, CURLINFO_CONNECT_TIME, performStart), GetCurlTimePoint(handle, CURLINFO_APPCONNECT_TIME, performStart));
+    connected = (std::min)(connected, performEnd);
+    auto sent = (std::max)(connected, (std::max)(GetCurlTimePoint(handle, CURLINFO_PRETRANSFER_TIME, performStart), lastBodyRead));
+    sent = (std::min)(sent, performEnd);
+    auto firstByte = (std::min)((std::max)(sent, GetCurlTimePoint(handle, CURLINFO_STARTTRANSFER_TIME, performStart)), performEnd);
+
+    request.AddPhaseDuration(RequestPhase::AcquireConnection, acquireDuration + (connected - performStart));
+    request.AddPhaseDuration(RequestPhase::Send, sent - connected);
+    request.AddPhaseDuration(RequestPhase::TimeToFirstByte, firstByte - sent);
+    request.AddPhaseDuration(RequestPhase::ReceiveBody, performEnd - firstByte);
+}
 
 void SetOptCodeForHttpMethod(CURL* requestHandle, const HttpRequest& request)
 {
@@ -300,10 +335,48 @@ CurlHttpClient::CurlHttpClient(const ClientConfiguration& clientConfig) :
     m_proxyPort(clientConfig.proxyPort), m_verifySSL(clientConfig.verifySSL), m_caPath(clientConfig.caPath),
     m_caFile(clientConfig.caFile), 
     m_disableExpectHeader(clientConfig.disableExpectHeader),
-    m_allowRedirects(clientConfig.followRedirects)
+    m_allowRedirects(clientConfig.followRedirects),
+    m_maxConnectionsPerHost(clientConfig.maxConnectionsPerHost)
 {
 }
 
+bool CurlHttpClient::AcquireHostConnection(const Aws::String& host) const
+{
+    std::unique_lock<std::mutex> locker(m_hostConnectionsLock);
+    auto hasFreeConnection = [this, &host]()
+    {
+        auto connections = m_hostConnections.find(host);
+        return connections == m_hostConnections.end() || connections->second < m_maxConnectionsPerHost;
+    };
+    //DisableRequestProcessing doesn't signal this client, so waiters look at it themselves now and then.
+    while (!m_hostConnectionReleased.wait_for(locker, HOST_CONNECTION_WAIT_INTERVAL, hasFreeConnection))
+    {
+        if (!IsRequestProcessingEnabled())
+        {
+            return false;
+        }
+    }
+    if (!IsRequestProcessingEnabled())
+    {
+        return false;
+    }
+    ++m_hostConnections[host];
+    return true;
+}
+
+void CurlHttpClient::ReleaseHostConnection(const Aws::String& host) const
+{
+    {
+        std::lock_guard<std::mutex> locker(m_hostConnectionsLock);
+        auto connections = m_hostConnections.find(host);
+        if (connections != m_hostConnections.end() && --connections->second == 0)
+        {
+            m_hostConnections.erase(connections);
+        }
+    }
+    m_hostConnectionReleased.notify_all();
+}
+
 
 void CurlHttpClient::MakeRequestInternal(HttpRequest& request, 
         std::shared_ptr<StandardHttpResponse>& response,
@@ -351,7 +424,15 @@ void CurlHttpClient::MakeRequestInternal(HttpRequest& request,
         headers = curl_slist_append(headers, "Expect:");
     }
 
-    CURL* connectionHandle = m_curlHandleContainer.AcquireCurlHandle();
+    auto acquireStart = std::chrono::steady_clock::now();
+    const Aws::String& host = uri.GetAuthority();
+    bool hostConnectionAcquired = m_maxConnectionsPerHost == 0 || AcquireHostConnection(host);
+    if (!hostConnectionAcquired)
+    {
+        AWS_LOGSTREAM_DEBUG(CURL_HTTP_CLIENT_TAG, "Request processing was disabled while waiting for a connection to " << host);
+    }
+    CURL* connectionHandle = hostConnectionAcquired ? m_curlHandleContainer.AcquireCurlHandle() : nullptr;
+    auto acquireDuration = std::chrono::steady_clock::now() - acquireStart;
 
     if (connectionHandle)
     {
@@ -438,7 +519,9 @@ void CurlHttpClient::MakeRequestInternal(HttpRequest& request,
             curl_easy_setopt(connectionHandle, CURLOPT_SEEKDATA, &readContext);
         }
         Aws::Utils::DateTime startTransmissionTime = Aws::Utils::DateTime::Now();
+        auto performStart = std::chrono::steady_clock::now();
         CURLcode curlResponseCode = curl_easy_perform(connectionHandle);
+        auto performEnd = std::chrono::steady_clock::now();
         bool shouldContinueRequest = ContinueRequest(request);
         if (curlResponseCode != CURLE_OK && shouldContinueRequest)
         {
@@ -502,7 +585,13 @@ void CurlHttpClient::MakeRequestInternal(HttpRequest& request,
             request.AddRequestMetric(GetHttpClientMetricNameByType(HttpClientMetricsType::SslLatency), static_cast<int64_t>(timep * 1000));
         }
 
+        AddCurlPhaseDurations(connectionHandle, request, acquireDuration, performStart, performEnd, readContext.m_lastReadTime);
+
         m_curlHandleContainer.ReleaseCurlHandle(connectionHandle);
+        if (m_maxConnectionsPerHost > 0)
+        {
+            ReleaseHostConnection(host);
+        }
         //go ahead and flush the response body stream
         if(response)
         {
@@ -510,6 +599,10 @@ void CurlHttpClient::MakeRequestInternal(HttpRequest& request,
         }
         request.AddRequestMetric(GetHttpClientMetricNameByType(HttpClientMetricsType::RequestLatency), (DateTime::Now() - startTransmissionTime).count());
     }
+    else if (m_maxConnectionsPerHost > 0 && hostConnectionAcquired)
+    {
+        ReleaseHostConnection(host);
+    }
 
     if (headers)
     {
@@ -603,6 +696,7 @@ size_t CurlHttpClient::ReadBody(char* ptr, size_t size, size_t nmemb, void* user
 
     HttpRequest* request = context->m_request;
     const std::shared_ptr<Aws::IOStream>& ioStream = request->GetContentBody();
+    context->m_lastReadTime = std::chrono::steady_clock::now();
 
     const size_t amountToRead = size * nmemb;
     if (ioStream != nullptr && amountToRead > 0)
@@ -76,12 +76,12 @@ const Aws::String& StandardHttpRequest::GetHeaderValue(const char* headerName) c
 
 void StandardHttpRequest::SetHeaderValue(const char* headerName, const Aws::String& headerValue)
 {
-    headerMap[StringUtils::ToLower(headerName)] = StringUtils::Trim(headerValue.c_str());
+    headerMap[StringUtils::ToLower(headerName)] = StringUtils::Trim(headerValue);
 }
 
 void StandardHttpRequest::SetHeaderValue(const Aws::String& headerName, const Aws::String& headerValue)
 {
-    headerMap[StringUtils::ToLower(headerName.c_str())] = StringUtils::Trim(headerValue.c_str());
+    headerMap[StringUtils::ToLower(headerName)] = StringUtils::Trim(headerValue);
 }
 
 void StandardHttpRequest::DeleteHeader(const char* headerName)
@@ -16,6 +16,7 @@
 #include <aws/core/http/windows/WinConnectionPoolMgr.h>
 #include <aws/core/utils/logging/LogMacros.h>
 #include <aws/core/utils/memory/AWSMemory.h>
+#include <aws/core/utils/memory/ArenaMemorySystem.h>
 #include <Windows.h>
 #include <algorithm>
 
@@ -93,6 +94,7 @@ void* WinConnectionPoolMgr::AquireConnectionForHost(const Aws::String& host, uin
     //let's go ahead and prevent that nasty little race condition.
     {
         std::lock_guard<std::mutex> hostsLocker(m_hostConnectionsMutex);  
+        Aws::Utils::Memory::HeapScope heapScope;
         Aws::Map<Aws::String, HostConnectionContainer*>::iterator foundPool = m_hostConnections.find(ss.str());  
 
         if (foundPool != m_hostConnections.end())
@@ -116,6 +118,7 @@ void* WinConnectionPoolMgr::AquireConnectionForHost(const Aws::String& host, uin
     if(!hostConnectionContainer->hostConnections.HasResourcesAvailable())
     {
         AWS_LOGSTREAM_DEBUG(GetLogTag(), "Pool has no available existing connections for endpoint, attempting to grow pool.");
+        Aws::Utils::Memory::HeapScope heapScope;
         CheckAndGrowPool(host, *hostConnectionContainer);
     }
 
@@ -20,6 +20,7 @@
 #include <aws/core/http/HttpResponse.h>
 #include <aws/core/utils/logging/LogMacros.h>
 #include <aws/core/utils/StringUtils.h>
+#include <aws/core/utils/memory/ArenaMemorySystem.h>
 #include <aws/core/platform/Environment.h>
 #include <aws/core/client/AWSError.h>
 #include <aws/core/client/CoreErrors.h>
@@ -73,15 +74,14 @@ static ClientConfiguration MakeDefaultHttpResourceClientConfiguration(const char
 }
 
 AWSHttpResourceClient::AWSHttpResourceClient(const Aws::Client::ClientConfiguration& clientConfiguration, const char* logtag)
-: m_logtag(logtag), m_retryStrategy(clientConfiguration.retryStrategy), m_httpClient(nullptr)
+: m_logtag(logtag), m_retryStrategy(clientConfiguration.retryStrategy), m_httpClient(nullptr),
+  m_httpClientConfiguration(Aws::MakeShared<ClientConfiguration>(RESOURCE_CLIENT_CONFIGURATION_ALLOCATION_TAG, clientConfiguration))
 {
     AWS_LOGSTREAM_INFO(m_logtag.c_str(),
                        "Creating AWSHttpResourceClient with max connections"
                         << clientConfiguration.maxConnections
                         << " and scheme "
                         << SchemeMapper::ToString(clientConfiguration.scheme));
-
-    m_httpClient = CreateHttpClient(clientConfiguration);
 }
 
 AWSHttpResourceClient::AWSHttpResourceClient(const char* logtag)
@@ -93,6 +93,17 @@ AWSHttpResourceClient::~AWSHttpResourceClient()
 {
 }
 
+const std::shared_ptr<HttpClient>& AWSHttpResourceClient::GetHttpClient() const
+{
+    std::call_once(m_httpClientCreated, [this]()
+    {
+        Utils::Memory::HeapScope heapScope;
+        m_httpClient = CreateHttpClient(*m_httpClientConfiguration);
+        m_httpClientConfiguration = nullptr;
+    });
+    return m_httpClient;
+}
+
 Aws::String AWSHttpResourceClient::GetResource(const char* endpoint, const char* resource, const char* authToken) const
 {
     Aws::StringStream ss;
@@ -109,7 +120,7 @@ Aws::String AWSHttpResourceClient::GetResource(const char* endpoint, const char*
             request->SetHeaderValue(Aws::Http::AWS_AUTHORIZATION_HEADER, authToken);
         }
 
-        std::shared_ptr<HttpResponse> response(m_httpClient->MakeRequest(request));
+        std::shared_ptr<HttpResponse> response(GetHttpClient()->MakeRequest(request));
 
         if (response && response->GetResponseCode() == HttpResponseCode::OK)
         {
@@ -141,7 +152,7 @@ Aws::String AWSHttpResourceClient::GetResource(const char* endpoint, const char*
 
         auto sleepMillis = m_retryStrategy->CalculateDelayBeforeNextRetry(error, retries);
         AWS_LOGSTREAM_WARN(m_logtag.c_str(), "Request failed, now waiting " << sleepMillis << " ms before attempting again.");
-        m_httpClient->RetryRequestSleep(std::chrono::milliseconds(sleepMillis));
+        GetHttpClient()->RetryRequestSleep(std::chrono::milliseconds(sleepMillis));
     }
 }
 
@@ -16,13 +16,23 @@
 #include <aws/core/utils/memory/AWSMemory.h>
 #include <aws/core/monitoring/DefaultMonitoring.h>
 #include <aws/core/utils/DateTime.h>
-#include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/StringUtils.h>
+#include <aws/core/utils/memory/stl/AWSDeque.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/core/utils/Outcome.h>
 #include <aws/core/client/AWSClient.h>
 #include <aws/core/auth/AWSCredentialsProvider.h>
 #include <aws/core/platform/Environment.h>
 #include <aws/core/config/AWSProfileConfigLoader.h>
 #include <aws/core/utils/logging/LogMacros.h>
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstring>
+#include <mutex>
+#include <thread>
+
 using namespace Aws::Utils;
 
 namespace Aws
@@ -33,6 +43,8 @@ namespace Aws
         static const int CLIENT_ID_LENGTH_LIMIT = 256;
         static const int USER_AGENT_LENGHT_LIMIT = 256;
         static const int ERROR_MESSAGE_LENGTH_LIMIT = 512;
+        //room for a typical event without growing the buffer.
+        static const size_t EVENT_BUFFER_SIZE = 1024;
 
         const char DEFAULT_MONITORING_CLIENT_ID[] = ""; // default to empty;
         unsigned short DEFAULT_MONITORING_PORT = 31000; //default to 31000;
@@ -45,6 +57,9 @@ namespace Aws
         const char DefaultMonitoring::DEFAULT_CSM_ENVIRONMENT_VAR_ENABLED[] = "AWS_CSM_ENABLED";
         const char DefaultMonitoring::DEFAULT_CSM_ENVIRONMENT_VAR_CLIENT_ID[] = "AWS_CSM_CLIENT_ID";
         const char DefaultMonitoring::DEFAULT_CSM_ENVIRONMENT_VAR_PORT[] = "AWS_CSM_PORT";
+        const char DefaultMonitoring::DEFAULT_CSM_CONFIG_BATCH_EVENTS[] = "csm_batch_events";
+        const char DefaultMonitoring::DEFAULT_CSM_ENVIRONMENT_VAR_BATCH_EVENTS[] = "AWS_CSM_BATCH_EVENTS";
+        const int DefaultMonitoring::DEFAULT_BATCH_FLUSH_INTERVAL_MS = 100;
 
 
         struct DefaultContext
@@ -56,8 +71,292 @@ namespace Aws
             bool lastErrorRetriable = false; //dosen't apply if last attempt succeeded.
         };
 
-        static inline void FillRequiredFieldsToJson(Json::JsonValue& json, 
-            const Aws::String& type, 
+        /**
+         * Writes one event as a compact json object straight into a string, with the same output JsonValue would give,
+         * without building a document first.
+         */
+        class EventWriter
+        {
+        public:
+            EventWriter(Aws::String& buffer) : m_buffer(buffer), m_empty(true)
+            {
+                m_buffer.push_back('{');
+            }
+
+            EventWriter& WithString(const char* key, const Aws::String& value, size_t lengthLimit = Aws::String::npos)
+            {
+                WriteKey(key);
+                WriteString(value.c_str(), (std::min)(value.size(), lengthLimit));
+                return *this;
+            }
+
+            EventWriter& WithString(const char* key, const char* value)
+            {
+                WriteKey(key);
+                WriteString(value, strlen(value));
+                return *this;
+            }
+
+            EventWriter& WithInt64(const char* key, int64_t value)
+            {
+                WriteKey(key);
+                char digits[24];
+                size_t length = 0;
+                uint64_t magnitude = value < 0 ? 0 - static_cast<uint64_t>(value) : static_cast<uint64_t>(value);
+                do
+                {
+                    digits[length++] = static_cast<char>('0' + magnitude % 10);
+                    magnitude /= 10;
+                } while (magnitude);
+                if (value < 0)
+                {
+                    m_buffer.push_back('-');
+                }
+                while (length)
+                {
+                    m_buffer.push_back(digits[--length]);
+                }
+                return *this;
+            }
+
+            EventWriter& WithInteger(const char* key, int value)
+            {
+                return WithInt64(key, value);
+            }
+
+            void End()
+            {
+                m_buffer.push_back('}');
+            }
+
+        private:
+            void WriteKey(const char* key)
+            {
+                if (!m_empty)
+                {
+                    m_buffer.push_back(',');
+                }
+                m_empty = false;
+                WriteString(key, strlen(key));
+                m_buffer.push_back(':');
+            }
+
+            void WriteString(const char* str, size_t length)
+            {
+                static const char HEX_DIGITS[] = "0123456789abcdef";
+                m_buffer.push_back('"');
+                for (size_t i = 0; i < length; ++i)
+                {
+                    unsigned char c = static_cast<unsigned char>(str[i]);
+                    switch (c)
+                    {
+                        case '"': m_buffer.append("\\\"", 2); break;
+                        case '\\': m_buffer.append("\\\\", 2); break;
+                        case '\b': m_buffer.append("\\b", 2); break;
+                        case '\f': m_buffer.append("\\f", 2); break;
+                        case '\n': m_buffer.append("\\n", 2); break;
+                        case '\r': m_buffer.append("\\r", 2); break;
+                        case '\t': m_buffer.append("\\t", 2); break;
+                        default:
+                            if (c < 32)
+                            {
+                                char escaped[] = { '\\', 'u', '0', '0', HEX_DIGITS[c >> 4], HEX_DIGITS[c & 0xF] };
+                                m_buffer.append(escaped, sizeof(escaped));
+                            }
+                            else
+                            {
+                                m_buffer.push_back(static_cast<char>(c));
+                            }
+                            break;
+                    }
+                }
+                m_buffer.push_back('"');
+            }
+
+            Aws::String& m_buffer;
+            bool m_empty;
+        };
+
+        /**
+         * Packs events into datagrams and sends them from a background thread, once a datagram is full or has waited for
+         * the flush interval.
+         */
+        class DatagramBatcher
+        {
+        public:
+            DatagramBatcher(const Aws::Net::SimpleUDP& udp, unsigned short port, size_t maxDatagramSize, std::chrono::milliseconds flushInterval) :
+                m_udp(udp),
+                m_port(port),
+                m_maxDatagramSize(maxDatagramSize),
+                m_flushInterval(flushInterval),
+                m_droppedEvents(0),
+                m_stop(false)
+            {
+                m_current.data.reserve(m_maxDatagramSize);
+                m_sendingThread = std::thread(&DatagramBatcher::SendingThread, this);
+            }
+
+            ~DatagramBatcher()
+            {
+                {
+                    std::lock_guard<std::mutex> locker(m_lock);
+                    m_stop = true;
+                }
+                m_signal.notify_one();
+                m_sendingThread.join();
+            }
+
+            void Add(const Aws::String& event)
+            {
+                bool datagramReady = false;
+                {
+                    std::lock_guard<std::mutex> locker(m_lock);
+                    if (!m_current.data.empty() && m_current.data.size() + 1 + event.size() > m_maxDatagramSize)
+                    {
+                        QueueCurrent();
+                        datagramReady = true;
+                    }
+                    if (!m_current.data.empty())
+                    {
+                        m_current.data.push_back('\n');
+                    }
+                    m_current.data.append(event);
+                    m_current.eventCount++;
+                    //an event too large to share a datagram goes out on its own.
+                    if (m_current.data.size() >= m_maxDatagramSize)
+                    {
+                        QueueCurrent();
+                        datagramReady = true;
+                    }
+                }
+
+                if (datagramReady)
+                {
+                    m_signal.notify_one();
+                }
+            }
+
+            void Flush()
+            {
+                {
+                    std::lock_guard<std::mutex> locker(m_lock);
+                    QueueCurrent();
+                }
+                SendQueued();
+            }
+
+            inline uint64_t GetDroppedEventCount() const { return m_droppedEvents.load(std::memory_order_relaxed); }
+
+        private:
+            struct Datagram
+            {
+                Datagram() : eventCount(0) {}
+
+                Aws::String data;
+                size_t eventCount;
+            };
+
+            //must be called with m_lock held.
+            void QueueCurrent()
+            {
+                if (m_current.eventCount == 0)
+                {
+                    return;
+                }
+
+                if (m_queued.size() >= MAX_QUEUED_DATAGRAMS)
+                {
+                    m_droppedEvents.fetch_add(m_current.eventCount, std::memory_order_relaxed);
+                    m_current.data.clear();
+                    m_current.eventCount = 0;
+                    return;
+                }
+
+                m_queued.push_back(std::move(m_current));
+                m_current = Datagram();
+                if (!m_spareBuffers.empty())
+                {
+                    m_current.data.swap(m_spareBuffers.back());
+                    m_spareBuffers.pop_back();
+                }
+                else
+                {
+                    m_current.data.reserve(m_maxDatagramSize);
+                }
+            }
+
+            void SendQueued()
+            {
+                //one sender at a time, so datagrams go out in the order they were filled.
+                std::lock_guard<std::mutex> sendLocker(m_sendLock);
+                Aws::Deque<Datagram> toSend;
+                {
+                    std::lock_guard<std::mutex> locker(m_lock);
+                    toSend.swap(m_queued);
+                }
+
+                for (auto& datagram : toSend)
+                {
+                    if (m_udp.SendDataToLocalHost(reinterpret_cast<const uint8_t*>(datagram.data.c_str()), datagram.data.size(), m_port) < 0)
+                    {
+                        m_droppedEvents.fetch_add(datagram.eventCount, std::memory_order_relaxed);
+                    }
+                }
+
+                std::lock_guard<std::mutex> locker(m_lock);
+                for (auto& datagram : toSend)
+                {
+                    if (m_spareBuffers.size() >= MAX_QUEUED_DATAGRAMS)
+                    {
+                        break;
+                    }
+                    datagram.data.clear();
+                    m_spareBuffers.push_back(std::move(datagram.data));
+                }
+            }
+
+            void SendingThread()
+            {
+                auto nextFlush = std::chrono::steady_clock::now() + m_flushInterval;
+                bool stop = false;
+                while (!stop)
+                {
+                    {
+                        std::unique_lock<std::mutex> locker(m_lock);
+                        m_signal.wait_until(locker, nextFlush, [this] { return m_stop || !m_queued.empty(); });
+                        stop = m_stop;
+                        auto now = std::chrono::steady_clock::now();
+                        if (stop || now >= nextFlush)
+                        {
+                            QueueCurrent();
+                            nextFlush = now + m_flushInterval;
+                        }
+                    }
+                    SendQueued();
+                }
+            }
+
+            static const size_t MAX_QUEUED_DATAGRAMS = 64;
+
+            const Aws::Net::SimpleUDP& m_udp;
+            unsigned short m_port;
+            size_t m_maxDatagramSize;
+            std::chrono::milliseconds m_flushInterval;
+
+            std::mutex m_lock;
+            std::condition_variable m_signal;
+            Datagram m_current;
+            Aws::Deque<Datagram> m_queued;
+            Aws::Vector<Aws::String> m_spareBuffers;
+
+            std::mutex m_sendLock;
+            std::atomic<uint64_t> m_droppedEvents;
+            bool m_stop;
+            std::thread m_sendingThread;
+        };
+
+        static inline void FillRequiredFieldsToJson(EventWriter& json,
+            const char* type, 
             const Aws::String& service,
             const Aws::String& api,
             const Aws::String& clientId,
@@ -67,12 +366,12 @@ namespace Aws
             json.WithString("Type", type)
                 .WithString("Service", service)
                 .WithString("Api", api)
-                .WithString("ClientId", clientId.substr(0, CLIENT_ID_LENGTH_LIMIT))
+                .WithString("ClientId", clientId, CLIENT_ID_LENGTH_LIMIT)
                 .WithInt64("Timestamp", timestamp.Millis())
                 .WithInteger("Version", version);
         }
 
-        static inline void FillRequiredApiCallFieldsToJson(Json::JsonValue& json,
+        static inline void FillRequiredApiCallFieldsToJson(EventWriter& json,
             int attemptCount,
             int64_t apiCallLatency,
             bool maxRetriesExceeded)
@@ -82,18 +381,18 @@ namespace Aws
                 .WithInteger("MaxRetriesExceeded", maxRetriesExceeded ? 1 : 0);
         }
 
-        static inline void FillRequiredApiAttemptFieldsToJson(Json::JsonValue& json,
+        static inline void FillRequiredApiAttemptFieldsToJson(EventWriter& json,
             const Aws::String& domainName,
             const Aws::String& userAgent,
             int64_t attemptLatency)
         {
             json.WithString("Fqdn", domainName)
-                .WithString("UserAgent", userAgent.substr(0, USER_AGENT_LENGHT_LIMIT))
+                .WithString("UserAgent", userAgent, USER_AGENT_LENGHT_LIMIT)
                 .WithInt64("AttemptLatency", attemptLatency);
         }
 
-        static inline void ExportResponseHeaderToJson(Json::JsonValue& json, const Aws::Http::HeaderValueCollection& headers, 
-            const Aws::String& headerName, const Aws::String& targetName)
+        static inline void ExportResponseHeaderToJson(EventWriter& json, const Aws::Http::HeaderValueCollection& headers, 
+            const char* headerName, const char* targetName)
         {
             auto iter = headers.find(headerName);
             if (iter != headers.end())
@@ -102,16 +401,17 @@ namespace Aws
             }
         }
 
-        static inline void ExportHttpMetricsToJson(Json::JsonValue& json, const Aws::Monitoring::HttpClientMetricsCollection& httpMetrics, Aws::Monitoring::HttpClientMetricsType type)
+        static inline void ExportHttpMetricsToJson(EventWriter& json, const Aws::Monitoring::HttpClientMetricsCollection& httpMetrics, Aws::Monitoring::HttpClientMetricsType type)
         {
-            auto iter = httpMetrics.find(GetHttpClientMetricNameByType(type));
+            Aws::String metricName = GetHttpClientMetricNameByType(type);
+            auto iter = httpMetrics.find(metricName);
             if (iter != httpMetrics.end())
             {
-                json.WithInt64(GetHttpClientMetricNameByType(type), iter->second);
+                json.WithInt64(metricName.c_str(), iter->second);
             }
         }
 
-        static inline void FillOptionalApiCallFieldsToJson(Json::JsonValue& json,
+        static inline void FillOptionalApiCallFieldsToJson(EventWriter& json,
             const Aws::Http::HttpRequest* request)
         {
             if (!request->GetSigningRegion().empty())
@@ -120,7 +420,7 @@ namespace Aws
             }
         }
 
-        static inline void FillOptionalApiAttemptFieldsToJson(Json::JsonValue& json,
+        static inline void FillOptionalApiAttemptFieldsToJson(EventWriter& json,
             const Aws::Http::HttpRequest* request,
             const Aws::Client::HttpResponseOutcome& outcome,
             const CoreMetricsCollection& metricsFromCore)
@@ -146,20 +446,21 @@ namespace Aws
             
             const auto& headers = outcome.IsSuccess() ? outcome.GetResult()->GetHeaders() : outcome.GetError().GetResponseHeaders();
 
-            ExportResponseHeaderToJson(json, headers, StringUtils::ToLower("x-amzn-RequestId"), "XAmznRequestId");
-            ExportResponseHeaderToJson(json, headers, StringUtils::ToLower("x-amz-request-id"), "XAmzRequestId");
-            ExportResponseHeaderToJson(json, headers, StringUtils::ToLower("x-amz-id-2"), "XAmzId2");
+            //header names are stored lower cased.
+            ExportResponseHeaderToJson(json, headers, "x-amzn-requestid", "XAmznRequestId");
+            ExportResponseHeaderToJson(json, headers, "x-amz-request-id", "XAmzRequestId");
+            ExportResponseHeaderToJson(json, headers, "x-amz-id-2", "XAmzId2");
             
             if (!outcome.IsSuccess())
             {
                 if (outcome.GetError().GetExceptionName().empty()) // Not Aws Excecption
                 {
-                    json.WithString("ConnectionErrorMessage", outcome.GetError().GetMessage().substr(0, ERROR_MESSAGE_LENGTH_LIMIT));
+                    json.WithString("ConnectionErrorMessage", outcome.GetError().GetMessage(), ERROR_MESSAGE_LENGTH_LIMIT);
                 }
                 else // Aws Exception
                 {
                     Aws::String msg = outcome.GetError().GetExceptionName() + ":" + outcome.GetError().GetMessage();
-                    json.WithString("AwsExceptionMessage", msg.substr(0, ERROR_MESSAGE_LENGTH_LIMIT));
+                    json.WithString("AwsExceptionMessage", msg, ERROR_MESSAGE_LENGTH_LIMIT);
                 }
             }
 
@@ -175,9 +476,46 @@ namespace Aws
         }
 
         DefaultMonitoring::DefaultMonitoring(const Aws::String& clientId, unsigned short port):
-            m_clientId(clientId), m_port(port)
+            m_clientId(clientId), m_port(port), m_batcher(nullptr)
+        {
+            m_udp.ConnectToLocalHost(port);
+        }
+
+        DefaultMonitoring::DefaultMonitoring(const Aws::String& clientId, unsigned short port, size_t maxDatagramSize, std::chrono::milliseconds flushInterval):
+            m_clientId(clientId), m_port(port), m_batcher(nullptr)
         {
             m_udp.ConnectToLocalHost(port);
+            m_batcher = Aws::New<DatagramBatcher>(DEFAULT_MONITORING_ALLOC_TAG, m_udp, port, maxDatagramSize, flushInterval);
+        }
+
+        DefaultMonitoring::~DefaultMonitoring()
+        {
+            Aws::Delete(m_batcher);
+        }
+
+        void DefaultMonitoring::Flush() const
+        {
+            if (m_batcher)
+            {
+                m_batcher->Flush();
+            }
+        }
+
+        uint64_t DefaultMonitoring::GetDroppedEventCount() const
+        {
+            return m_batcher ? m_batcher->GetDroppedEventCount() : 0;
+        }
+
+        void DefaultMonitoring::SendEvent(const Aws::String& event) const
+        {
+            if (m_batcher)
+            {
+                m_batcher->Add(event);
+            }
+            else
+            {
+                m_udp.SendDataToLocalHost(reinterpret_cast<const uint8_t*>(event.c_str()), event.size(), m_port);
+            }
         }
 
         void* DefaultMonitoring::OnRequestStarted(const Aws::String& serviceName, const Aws::String& requestName, const std::shared_ptr<const Aws::Http::HttpRequest>& request) const
@@ -225,13 +563,15 @@ namespace Aws
             AWS_LOGSTREAM_DEBUG(DEFAULT_MONITORING_ALLOC_TAG, "OnRequestFinish Service: " << serviceName << "Request: " << requestName);
 
             DefaultContext* defaultContext = reinterpret_cast<DefaultContext*>(context);
-            Aws::Utils::Json::JsonValue json;
+            Aws::String compactData;
+            compactData.reserve(EVENT_BUFFER_SIZE);
+            EventWriter json(compactData);
             FillRequiredFieldsToJson(json, "ApiCall", serviceName, requestName, m_clientId, defaultContext->apiCallStartTime, DEFAULT_MONITORING_VERSION);
             FillRequiredApiCallFieldsToJson(json, defaultContext->retryCount + 1, DateTime::Now().Millis() - defaultContext->apiCallStartTime.Millis(), (!defaultContext->lastAttemptSucceeded && defaultContext->lastErrorRetriable));
             FillOptionalApiCallFieldsToJson(json, request.get());
-            Aws::String compactData = json.View().WriteCompact();
-            m_udp.SendDataToLocalHost(reinterpret_cast<const uint8_t*>(compactData.c_str()), static_cast<int>(compactData.size()), m_port);
-            AWS_LOGSTREAM_DEBUG(DEFAULT_MONITORING_ALLOC_TAG, "Send API Metrics: \n" << json.View().WriteReadable());
+            json.End();
+            SendEvent(compactData);
+            AWS_LOGSTREAM_DEBUG(DEFAULT_MONITORING_ALLOC_TAG, "Send API Metrics: \n" << compactData);
             Aws::Delete(defaultContext);
         }
 
@@ -242,14 +582,16 @@ namespace Aws
             DefaultContext* defaultContext = reinterpret_cast<DefaultContext*>(context);
             defaultContext->lastAttemptSucceeded = outcome.IsSuccess() ? true : false;
             defaultContext->lastErrorRetriable = (!outcome.IsSuccess() && outcome.GetError().ShouldRetry()) ? true : false;
-            Aws::Utils::Json::JsonValue json;
+            Aws::String compactData;
+            compactData.reserve(EVENT_BUFFER_SIZE);
+            EventWriter json(compactData);
             FillRequiredFieldsToJson(json, "ApiCallAttempt", serviceName, requestName, m_clientId, defaultContext->attemptStartTime, DEFAULT_MONITORING_VERSION);
             FillRequiredApiAttemptFieldsToJson(json, request->GetUri().GetAuthority(), request->GetUserAgent(),
                 DateTime::Now().Millis() - defaultContext->attemptStartTime.Millis());
             FillOptionalApiAttemptFieldsToJson(json, request.get(), outcome, metricsFromCore);
-            Aws::String compactData = json.View().WriteCompact();
-            AWS_LOGSTREAM_DEBUG(DEFAULT_MONITORING_ALLOC_TAG, "Send Attempt Metrics: \n" << json.View().WriteReadable());
-            m_udp.SendDataToLocalHost(reinterpret_cast<const uint8_t*>(compactData.c_str()), static_cast<int>(compactData.size()), m_port);
+            json.End();
+            AWS_LOGSTREAM_DEBUG(DEFAULT_MONITORING_ALLOC_TAG, "Send Attempt Metrics: \n" << compactData);
+            SendEvent(compactData);
         }
 
         Aws::UniquePtr<MonitoringInterface> DefaultMonitoringFactory::CreateMonitoringInstance() const
@@ -257,6 +599,7 @@ namespace Aws
             Aws::String clientId(DEFAULT_MONITORING_CLIENT_ID); // default to empty
             unsigned short port = DEFAULT_MONITORING_PORT; // default to 31000
             bool enable = DEFAULT_MONITORING_ENABLE; //default to false;
+            bool batchEvents = false;
 
             //check profile_config
             Aws::String defaultConfigFile = Aws::Auth::ProfileConfigFileAWSCredentialsProvider::GetConfigProfileFilename();
@@ -271,6 +614,7 @@ namespace Aws
                     Aws::String tmpEnable = iter.second.GetValue(DefaultMonitoring::DEFAULT_CSM_CONFIG_ENABLED);
                     Aws::String tmpClientId = iter.second.GetValue(DefaultMonitoring::DEFAULT_CSM_CONFIG_CLIENT_ID);
                     Aws::String tmpPort = iter.second.GetValue(DefaultMonitoring::DEFAULT_CSM_CONFIG_PORT);
+                    Aws::String tmpBatchEvents = iter.second.GetValue(DefaultMonitoring::DEFAULT_CSM_CONFIG_BATCH_EVENTS);
 
                     if (!tmpEnable.empty())
                     {
@@ -286,6 +630,11 @@ namespace Aws
                     {
                         port = static_cast<short>(StringUtils::ConvertToInt32(tmpPort.c_str()));
                         AWS_LOGSTREAM_DEBUG(DEFAULT_MONITORING_ALLOC_TAG, "Resolved csm_port from profile_config to be " << port);
+                    }
+                    if (!tmpBatchEvents.empty())
+                    {
+                        batchEvents = StringUtils::CaselessCompare(tmpBatchEvents.c_str(), "true") ? true : false;
+                        AWS_LOGSTREAM_DEBUG(DEFAULT_MONITORING_ALLOC_TAG, "Resolved csm_batch_events from profile_config to be " << batchEvents);
                     }             
                 }
             }
@@ -294,6 +643,7 @@ namespace Aws
             Aws::String tmpEnable = Aws::Environment::GetEnv(DefaultMonitoring::DEFAULT_CSM_ENVIRONMENT_VAR_ENABLED);
             Aws::String tmpClientId = Aws::Environment::GetEnv(DefaultMonitoring::DEFAULT_CSM_ENVIRONMENT_VAR_CLIENT_ID);
             Aws::String tmpPort = Aws::Environment::GetEnv(DefaultMonitoring::DEFAULT_CSM_ENVIRONMENT_VAR_PORT);
+            Aws::String tmpBatchEvents = Aws::Environment::GetEnv(DefaultMonitoring::DEFAULT_CSM_ENVIRONMENT_VAR_BATCH_EVENTS);
             if (!tmpEnable.empty())
             {
                 enable = StringUtils::CaselessCompare(tmpEnable.c_str(), "true") ? true : false;
@@ -310,11 +660,20 @@ namespace Aws
                 port = static_cast<unsigned short>(StringUtils::ConvertToInt32(tmpPort.c_str()));
                 AWS_LOGSTREAM_DEBUG(DEFAULT_MONITORING_ALLOC_TAG, "Resolved AWS_CSM_PORT from Environment variable to be " << port);
             }
+            if (!tmpBatchEvents.empty())
+            {
+                batchEvents = StringUtils::CaselessCompare(tmpBatchEvents.c_str(), "true") ? true : false;
+                AWS_LOGSTREAM_DEBUG(DEFAULT_MONITORING_ALLOC_TAG, "Resolved AWS_CSM_BATCH_EVENTS from Environment variable to be " << batchEvents);
+            }
 
             if (!enable)
             {
                 return nullptr;
             }
+            if (batchEvents)
+            {
+                return Aws::MakeUnique<DefaultMonitoring>(DEFAULT_MONITORING_ALLOC_TAG, clientId, port, Aws::Net::UDP_BUFFER_SIZE);
+            }
             return Aws::MakeUnique<DefaultMonitoring>(DEFAULT_MONITORING_ALLOC_TAG, clientId, port);
         }
 
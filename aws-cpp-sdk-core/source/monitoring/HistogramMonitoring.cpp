@@ -0,0 +1,337 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/core/monitoring/HistogramMonitoring.h>
+#include <aws/core/monitoring/HttpClientMetrics.h>
+#include <aws/core/monitoring/RequestPhaseTimings.h>
+#include <aws/core/client/AWSClient.h>
+#include <aws/core/client/AWSError.h>
+#include <aws/core/client/CoreErrors.h>
+#include <aws/core/http/HttpResponse.h>
+#include <aws/core/utils/Outcome.h>
+#include <aws/core/utils/memory/AWSMemory.h>
+#include <aws/core/utils/memory/stl/AWSMap.h>
+#include <aws/core/utils/UnreferencedParam.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <mutex>
+#include <thread>
+
+namespace Aws
+{
+    namespace Monitoring
+    {
+        static const char HISTOGRAM_MONITORING_ALLOC_TAG[] = "HistogramMonitoring";
+        //an hour, in microseconds.
+        static const int64_t HIGHEST_TRACKABLE_VALUE = 3600LL * 1000 * 1000;
+
+        const char LatencyHistograms::CALL_LATENCY[] = "CallLatency";
+        const char LatencyHistograms::ATTEMPT_LATENCY[] = "AttemptLatency";
+        const char LatencyHistograms::RETRIES[] = "Retries";
+
+        static const char* const METRIC_NAMES[] =
+        {
+            LatencyHistograms::CALL_LATENCY,
+            LatencyHistograms::ATTEMPT_LATENCY,
+            LatencyHistograms::RETRIES,
+            "AcquireConnectionLatency",
+            "ConnectLatency",
+            "RequestLatency",
+            "DnsLatency",
+            "TcpLatency",
+            "SslLatency"
+        };
+        static const size_t CLIENT_METRIC_COUNT = sizeof(METRIC_NAMES) / sizeof(METRIC_NAMES[0]);
+        //the request phases follow, named by GetRequestPhaseName.
+        static const size_t METRIC_COUNT = CLIENT_METRIC_COUNT + REQUEST_PHASE_COUNT;
+
+        static inline const char* GetMetricName(size_t metricIndex)
+        {
+            return metricIndex < CLIENT_METRIC_COUNT ? METRIC_NAMES[metricIndex] :
+                GetRequestPhaseName(static_cast<RequestPhase>(metricIndex - CLIENT_METRIC_COUNT));
+        }
+
+        static inline size_t GetMetricIndex(const char* metricName)
+        {
+            for (size_t i = 0; i < METRIC_COUNT; ++i)
+            {
+                if (strcmp(GetMetricName(i), metricName) == 0)
+                {
+                    return i;
+                }
+            }
+            return METRIC_COUNT;
+        }
+
+        struct StatusHistograms
+        {
+            StatusHistograms() { std::fill(metrics, metrics + METRIC_COUNT, nullptr); }
+            ~StatusHistograms()
+            {
+                for (size_t i = 0; i < METRIC_COUNT; ++i)
+                {
+                    Aws::Delete(metrics[i]);
+                }
+            }
+
+            StatusHistograms(const StatusHistograms&) = delete;
+            StatusHistograms& operator=(const StatusHistograms&) = delete;
+
+            Aws::Utils::HdrHistogram* metrics[METRIC_COUNT];
+        };
+
+        //service name -> operation name -> status code.
+        typedef Aws::Map<Aws::String, Aws::Map<Aws::String, Aws::Map<int, StatusHistograms>>> HistogramsByOperation;
+
+        struct HistogramShard
+        {
+            std::mutex lock;
+            HistogramsByOperation histograms;
+        };
+
+        struct HistogramContext
+        {
+            std::chrono::steady_clock::time_point callStartTime;
+            std::chrono::steady_clock::time_point attemptStartTime;
+            int retryCount = 0;
+            int lastStatusCode = static_cast<int>(Aws::Http::HttpResponseCode::REQUEST_NOT_MADE);
+        };
+
+        static inline int64_t MicrosecondsSince(const std::chrono::steady_clock::time_point& start)
+        {
+            return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+        }
+
+        LatencyHistograms::LatencyHistograms(size_t shardCount, int significantFigures) :
+            m_shardCount((std::max)(shardCount, static_cast<size_t>(1))),
+            m_significantFigures(significantFigures),
+            m_shards(Aws::NewArray<HistogramShard>(m_shardCount, HISTOGRAM_MONITORING_ALLOC_TAG))
+        {
+        }
+
+        LatencyHistograms::~LatencyHistograms()
+        {
+            Aws::DeleteArray(m_shards);
+        }
+
+        HistogramShard& LatencyHistograms::GetShard() const
+        {
+            //thread ids tend to be aligned addresses, so mix the bits before picking a shard.
+            uint64_t hash = static_cast<uint64_t>(std::hash<std::thread::id>()(std::this_thread::get_id()));
+            hash ^= hash >> 33;
+            hash *= 0xff51afd7ed558ccdULL;
+            hash ^= hash >> 33;
+            return m_shards[hash % m_shardCount];
+        }
+
+        void LatencyHistograms::Record(const Aws::String& serviceName, const Aws::String& requestName, int statusCode, const char* metricName, int64_t value)
+        {
+            size_t metricIndex = GetMetricIndex(metricName);
+            if (metricIndex == METRIC_COUNT)
+            {
+                return;
+            }
+
+            HistogramShard& shard = GetShard();
+            std::lock_guard<std::mutex> locker(shard.lock);
+            Aws::Utils::HdrHistogram*& histogram = shard.histograms[serviceName][requestName][statusCode].metrics[metricIndex];
+            if (!histogram)
+            {
+                histogram = Aws::New<Aws::Utils::HdrHistogram>(HISTOGRAM_MONITORING_ALLOC_TAG, HIGHEST_TRACKABLE_VALUE, m_significantFigures);
+            }
+            histogram->Record(value);
+        }
+
+        Aws::Vector<MetricHistogram> LatencyHistograms::GetSnapshot() const
+        {
+            HistogramsByOperation merged;
+            for (size_t i = 0; i < m_shardCount; ++i)
+            {
+                std::lock_guard<std::mutex> locker(m_shards[i].lock);
+                for (const auto& service : m_shards[i].histograms)
+                {
+                    for (const auto& operation : service.second)
+                    {
+                        for (const auto& status : operation.second)
+                        {
+                            StatusHistograms& target = merged[service.first][operation.first][status.first];
+                            for (size_t metricIndex = 0; metricIndex < METRIC_COUNT; ++metricIndex)
+                            {
+                                const Aws::Utils::HdrHistogram* histogram = status.second.metrics[metricIndex];
+                                if (!histogram)
+                                {
+                                    continue;
+                                }
+                                if (target.metrics[metricIndex])
+                                {
+                                    target.metrics[metricIndex]->Add(*histogram);
+                                }
+                                else
+                                {
+                                    target.metrics[metricIndex] = Aws::New<Aws::Utils::HdrHistogram>(HISTOGRAM_MONITORING_ALLOC_TAG, *histogram);
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+
+            Aws::Vector<MetricHistogram> snapshot;
+            for (const auto& service : merged)
+            {
+                for (const auto& operation : service.second)
+                {
+                    for (const auto& status : operation.second)
+                    {
+                        for (size_t metricIndex = 0; metricIndex < METRIC_COUNT; ++metricIndex)
+                        {
+                            if (status.second.metrics[metricIndex])
+                            {
+                                snapshot.emplace_back(service.first, operation.first, status.first, GetMetricName(metricIndex), *status.second.metrics[metricIndex]);
+                            }
+                        }
+                    }
+                }
+            }
+            return snapshot;
+        }
+
+        void LatencyHistograms::Reset()
+        {
+            for (size_t i = 0; i < m_shardCount; ++i)
+            {
+                std::lock_guard<std::mutex> locker(m_shards[i].lock);
+                m_shards[i].histograms.clear();
+            }
+        }
+
+        void LatencyHistograms::Export(Aws::OStream& output) const
+        {
+            for (const auto& metric : GetSnapshot())
+            {
+                const Aws::Utils::HdrHistogram& histogram = metric.histogram;
+                output << metric.serviceName << " " << metric.requestName << " " << metric.statusCode << " " << metric.metricName
+                    << " count=" << histogram.GetTotalCount()
+                    << " min=" << histogram.GetMin()
+                    << " p50=" << histogram.GetValueAtPercentile(50.0)
+                    << " p99=" << histogram.GetValueAtPercentile(99.0)
+                    << " p999=" << histogram.GetValueAtPercentile(99.9)
+                    << " max=" << histogram.GetMax() << "\n";
+            }
+        }
+
+        HistogramMonitoring::HistogramMonitoring(const std::shared_ptr<LatencyHistograms>& histograms) :
+            m_histograms(histograms)
+        {
+        }
+
+        void* HistogramMonitoring::OnRequestStarted(const Aws::String& serviceName, const Aws::String& requestName,
+            const std::shared_ptr<const Aws::Http::HttpRequest>& request) const
+        {
+            AWS_UNREFERENCED_PARAM(serviceName);
+            AWS_UNREFERENCED_PARAM(requestName);
+            AWS_UNREFERENCED_PARAM(request);
+
+            HistogramContext* context = Aws::New<HistogramContext>(HISTOGRAM_MONITORING_ALLOC_TAG);
+            context->callStartTime = std::chrono::steady_clock::now();
+            context->attemptStartTime = context->callStartTime;
+            return context;
+        }
+
+        void HistogramMonitoring::OnRequestSucceeded(const Aws::String& serviceName, const Aws::String& requestName,
+            const std::shared_ptr<const Aws::Http::HttpRequest>& request, const Aws::Client::HttpResponseOutcome& outcome,
+            const CoreMetricsCollection& metricsFromCore, void* context) const
+        {
+            AWS_UNREFERENCED_PARAM(request);
+            RecordAttempt(serviceName, requestName, outcome, metricsFromCore, context);
+        }
+
+        void HistogramMonitoring::OnRequestFailed(const Aws::String& serviceName, const Aws::String& requestName,
+            const std::shared_ptr<const Aws::Http::HttpRequest>& request, const Aws::Client::HttpResponseOutcome& outcome,
+            const CoreMetricsCollection& metricsFromCore, void* context) const
+        {
+            AWS_UNREFERENCED_PARAM(request);
+            RecordAttempt(serviceName, requestName, outcome, metricsFromCore, context);
+        }
+
+        void HistogramMonitoring::OnRequestRetry(const Aws::String& serviceName, const Aws::String& requestName,
+            const std::shared_ptr<const Aws::Http::HttpRequest>& request, void* context) const
+        {
+            AWS_UNREFERENCED_PARAM(serviceName);
+            AWS_UNREFERENCED_PARAM(requestName);
+            AWS_UNREFERENCED_PARAM(request);
+
+            HistogramContext* histogramContext = static_cast<HistogramContext*>(context);
+            histogramContext->retryCount++;
+            histogramContext->attemptStartTime = std::chrono::steady_clock::now();
+        }
+
+        void HistogramMonitoring::OnFinish(const Aws::String& serviceName, const Aws::String& requestName,
+            const std::shared_ptr<const Aws::Http::HttpRequest>& request, void* context) const
+        {
+            AWS_UNREFERENCED_PARAM(request);
+
+            HistogramContext* histogramContext = static_cast<HistogramContext*>(context);
+            int statusCode = histogramContext->lastStatusCode;
+            m_histograms->Record(serviceName, requestName, statusCode, LatencyHistograms::CALL_LATENCY, MicrosecondsSince(histogramContext->callStartTime));
+            m_histograms->Record(serviceName, requestName, statusCode, LatencyHistograms::RETRIES, histogramContext->retryCount);
+            Aws::Delete(histogramContext);
+        }
+
+        void HistogramMonitoring::RecordAttempt(const Aws::String& serviceName, const Aws::String& requestName,
+            const Aws::Client::HttpResponseOutcome& outcome, const CoreMetricsCollection& metricsFromCore, void* context) const
+        {
+            HistogramContext* histogramContext = static_cast<HistogramContext*>(context);
+            int statusCode = static_cast<int>(outcome.IsSuccess() ? outcome.GetResult()->GetResponseCode() : outcome.GetError().GetResponseCode());
+            histogramContext->lastStatusCode = statusCode;
+            m_histograms->Record(serviceName, requestName, statusCode, LatencyHistograms::ATTEMPT_LATENCY, MicrosecondsSince(histogramContext->attemptStartTime));
+
+            for (const auto& metric : metricsFromCore.httpClientMetrics)
+            {
+                switch (GetHttpClientMetricTypeByName(metric.first))
+                {
+                    case HttpClientMetricsType::AcquireConnectionLatency:
+                    case HttpClientMetricsType::ConnectLatency:
+                    case HttpClientMetricsType::RequestLatency:
+                    case HttpClientMetricsType::DnsLatency:
+                    case HttpClientMetricsType::TcpLatency:
+                    case HttpClientMetricsType::SslLatency:
+                        //http clients report milliseconds.
+                        m_histograms->Record(serviceName, requestName, statusCode, metric.first.c_str(), metric.second * 1000);
+                        break;
+                    default:
+                        break;
+                }
+            }
+
+            for (size_t i = 0; i < REQUEST_PHASE_COUNT; ++i)
+            {
+                RequestPhase phase = static_cast<RequestPhase>(i);
+                if (metricsFromCore.phaseTimings.WasRecorded(phase))
+                {
+                    m_histograms->Record(serviceName, requestName, statusCode, GetRequestPhaseName(phase),
+                        std::chrono::duration_cast<std::chrono::microseconds>(metricsFromCore.phaseTimings.Get(phase)).count());
+                }
+            }
+        }
+
+        Aws::UniquePtr<MonitoringInterface> HistogramMonitoringFactory::CreateMonitoringInstance() const
+        {
+            return Aws::MakeUnique<HistogramMonitoring>(HISTOGRAM_MONITORING_ALLOC_TAG, m_histograms);
+        }
+    } // namespace Monitoring
+} // namespace Aws
@@ -0,0 +1,43 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/core/monitoring/RequestPhaseTimings.h>
+
+namespace Aws
+{
+    namespace Monitoring
+    {
+        static const char* const REQUEST_PHASE_NAMES[] =
+        {
+            "Serialization",
+            "EndpointResolution",
+            "Signing",
+            "AcquireConnection",
+            "Send",
+            "TimeToFirstByte",
+            "ReceiveBody",
+            "ResponseParsing",
+            "RetryBackoff"
+        };
+
+        static_assert(sizeof(REQUEST_PHASE_NAMES) / sizeof(REQUEST_PHASE_NAMES[0]) == REQUEST_PHASE_COUNT, "every request phase needs a name");
+
+        const char* GetRequestPhaseName(RequestPhase phase)
+        {
+            size_t index = static_cast<size_t>(phase);
+            return index < REQUEST_PHASE_COUNT ? REQUEST_PHASE_NAMES[index] : "Unknown";
+        }
+    } // namespace Monitoring
+} // namespace Aws
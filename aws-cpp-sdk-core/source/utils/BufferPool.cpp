@@ -0,0 +1,231 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/core/utils/BufferPool.h>
+#include <aws/core/utils/memory/AWSMemory.h>
+
+#include <algorithm>
+
+using namespace Aws::Utils;
+
+static const char* BUFFER_POOL_TAG = "BufferPool";
+static BufferPool* s_bufferPool(nullptr);
+
+BufferPool::BufferPool(size_t maxRetainedBytes, size_t maxPooledSize, size_t trimInterval) :
+    m_maxRetainedBytes(maxRetainedBytes),
+    m_maxPooledSize(MIN_POOLED_SIZE),
+    m_trimInterval((std::max)(trimInterval, static_cast<size_t>(1))),
+    m_bucketCount(1),
+    m_buckets(nullptr),
+    m_retainedBytes(0)
+{
+    while (m_maxPooledSize < maxPooledSize)
+    {
+        m_maxPooledSize <<= 1;
+        ++m_bucketCount;
+    }
+    m_buckets = Aws::NewArray<Bucket>(m_bucketCount, BUFFER_POOL_TAG);
+}
+
+BufferPool::~BufferPool()
+{
+    Clear();
+    Aws::DeleteArray(m_buckets);
+}
+
+char* BufferPool::Acquire(size_t size, size_t& capacity)
+{
+    if (size > m_maxPooledSize)
+    {
+        capacity = size;
+        return static_cast<char*>(Aws::Malloc(BUFFER_POOL_TAG, size));
+    }
+
+    size_t bucketIndex = GetBucketIndex(size);
+    capacity = MIN_POOLED_SIZE << bucketIndex;
+
+    Bucket& bucket = m_buckets[bucketIndex];
+    {
+        std::lock_guard<std::mutex> locker(bucket.lock);
+        if (!bucket.cached.empty())
+        {
+            char* buffer = bucket.cached.back();
+            bucket.cached.pop_back();
+            m_retainedBytes.fetch_sub(capacity, std::memory_order_relaxed);
+            MarkInUse(bucket, buffer);
+            return buffer;
+        }
+    }
+
+    char* buffer = static_cast<char*>(Aws::Malloc(BUFFER_POOL_TAG, capacity));
+    std::lock_guard<std::mutex> locker(bucket.lock);
+    MarkInUse(bucket, buffer);
+    return buffer;
+}
+
+void BufferPool::Release(char* buffer, size_t capacity)
+{
+    if (!buffer)
+    {
+        return;
+    }
+
+    //only buffers of exactly a bucket's size can be handed out again.
+    if (capacity < MIN_POOLED_SIZE || capacity > m_maxPooledSize || (capacity & (capacity - 1)) != 0)
+    {
+        Aws::Free(buffer);
+        return;
+    }
+
+    Bucket& bucket = m_buckets[GetBucketIndex(capacity)];
+    bool keep = false;
+    {
+        std::lock_guard<std::mutex> locker(bucket.lock);
+        //a buffer the pool did not hand out is freed without touching the counts, it was never part of them.
+        //The most recently acquired buffers are the likeliest to come back first.
+        auto found = std::find(bucket.inUse.rbegin(), bucket.inUse.rend(), buffer);
+        if (found == bucket.inUse.rend())
+        {
+            Aws::Free(buffer);
+            return;
+        }
+        *found = bucket.inUse.back();
+        bucket.inUse.pop_back();
+
+        size_t allowed = (std::max)(bucket.highWater, bucket.windowPeak);
+        if (bucket.cached.size() + bucket.inUse.size() < allowed && m_retainedBytes.load(std::memory_order_relaxed) + capacity <= m_maxRetainedBytes)
+        {
+            bucket.cached.push_back(buffer);
+            m_retainedBytes.fetch_add(capacity, std::memory_order_relaxed);
+            keep = true;
+        }
+
+        if (++bucket.releasesSinceTrim >= m_trimInterval)
+        {
+            TrimBucket(bucket, capacity);
+        }
+    }
+
+    if (!keep)
+    {
+        Aws::Free(buffer);
+    }
+}
+
+void BufferPool::Trim()
+{
+    for (size_t i = 0; i < m_bucketCount; ++i)
+    {
+        std::lock_guard<std::mutex> locker(m_buckets[i].lock);
+        TrimBucket(m_buckets[i], MIN_POOLED_SIZE << i);
+    }
+}
+
+void BufferPool::Clear()
+{
+    for (size_t i = 0; i < m_bucketCount; ++i)
+    {
+        Bucket& bucket = m_buckets[i];
+        std::lock_guard<std::mutex> locker(bucket.lock);
+        for (char* buffer : bucket.cached)
+        {
+            Aws::Free(buffer);
+        }
+        m_retainedBytes.fetch_sub(bucket.cached.size() * (MIN_POOLED_SIZE << i), std::memory_order_relaxed);
+        bucket.cached.clear();
+        bucket.cached.shrink_to_fit();
+    }
+}
+
+size_t BufferPool::GetBucketIndex(size_t size) const
+{
+    size_t bucketIndex = 0;
+    while ((MIN_POOLED_SIZE << bucketIndex) < size)
+    {
+        ++bucketIndex;
+    }
+    return bucketIndex;
+}
+
+void BufferPool::MarkInUse(Bucket& bucket, char* buffer)
+{
+    bucket.inUse.push_back(buffer);
+    bucket.windowPeak = (std::max)(bucket.windowPeak, bucket.inUse.size());
+}
+
+void BufferPool::TrimBucket(Bucket& bucket, size_t bucketSize)
+{
+    //the peak of the window that just ended is what this size gets to keep for the next one.
+    bucket.highWater = bucket.windowPeak;
+    bucket.windowPeak = bucket.inUse.size();
+    bucket.releasesSinceTrim = 0;
+
+    size_t allowed = bucket.highWater > bucket.inUse.size() ? bucket.highWater - bucket.inUse.size() : 0;
+    while (bucket.cached.size() > allowed)
+    {
+        Aws::Free(bucket.cached.back());
+        bucket.cached.pop_back();
+        m_retainedBytes.fetch_sub(bucketSize, std::memory_order_relaxed);
+    }
+}
+
+namespace Aws
+{
+    namespace Utils
+    {
+        char* AcquireBuffer(size_t size, size_t& capacity)
+        {
+            if (s_bufferPool)
+            {
+                return s_bufferPool->Acquire(size, capacity);
+            }
+
+            capacity = size;
+            return static_cast<char*>(Aws::Malloc(BUFFER_POOL_TAG, size));
+        }
+
+        void ReleaseBuffer(char* buffer, size_t capacity)
+        {
+            if (s_bufferPool)
+            {
+                s_bufferPool->Release(buffer, capacity);
+            }
+            else if (buffer)
+            {
+                Aws::Free(buffer);
+            }
+        }
+
+        BufferPool* GetBufferPool()
+        {
+            return s_bufferPool;
+        }
+
+        void InitializeBufferPool(size_t maxRetainedBytes)
+        {
+            if (maxRetainedBytes > 0)
+            {
+                s_bufferPool = Aws::New<BufferPool>(BUFFER_POOL_TAG, maxRetainedBytes);
+            }
+        }
+
+        void CleanupBufferPool()
+        {
+            Aws::Delete(s_bufferPool);
+            s_bufferPool = nullptr;
+        }
+
+    } // namespace Utils
+} // namespace Aws
@@ -863,6 +863,309 @@ private:
     int m_state;
 };
 
+//The parsers above handle every variation the services send, but nearly every timestamp on the wire is in one of the exact
+//layouts AWS formats them in: "2002-10-02T08:05:09Z", "2002-10-02T08:05:09.000Z" and "Wed, 02 Oct 2002 08:05:09 GMT".
+//Those are parsed and formatted here by position, with calendar arithmetic instead of timegm/gmtime and strftime.
+//Anything that does not match exactly falls through to the state machines and strftime, which keeps the results identical.
+static const char* RFC822_WEEK_DAY_NAMES[] = { "Sun", "Mon", "Tue", "Wed", "Thu", "Fri", "Sat" };
+static const char* RFC822_MONTH_NAMES[] = { "Jan", "Feb", "Mar", "Apr", "May", "Jun", "Jul", "Aug", "Sep", "Oct", "Nov", "Dec" };
+static const size_t ISO_8601_LAYOUT_LENGTH = sizeof("2002-10-02T08:05:09Z") - 1;
+static const size_t RFC822_LAYOUT_LENGTH = sizeof("Wed, 02 Oct 2002 08:05:09 GMT") - 1;
+static const int64_t SECONDS_PER_DAY = 86400;
+
+//Days since 1970-01-01 of a date in the proleptic gregorian calendar, month is 1-12.
+//Days past the end of the month carry over into the next one, the same way timegm normalizes them.
+static int64_t DaysFromCivil(int64_t year, int month, int day)
+{
+    year -= month <= 2 ? 1 : 0;
+    const int64_t era = (year >= 0 ? year : year - 399) / 400;
+    const int64_t yearOfEra = year - era * 400;
+    const int64_t dayOfYear = (153 * (month > 2 ? month - 3 : month + 9) + 2) / 5 + day - 1;
+    const int64_t dayOfEra = yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100 + dayOfYear;
+    return era * 146097 + dayOfEra - 719468;
+}
+
+//Inverse of DaysFromCivil.
+static void CivilFromDays(int64_t days, int64_t& year, int& month, int& day)
+{
+    days += 719468;
+    const int64_t era = (days >= 0 ? days : days - 146096) / 146097;
+    const int64_t dayOfEra = days - era * 146097;
+    const int64_t yearOfEra = (dayOfEra - dayOfEra / 1460 + dayOfEra / 36524 - dayOfEra / 146096) / 365;
+    const int64_t dayOfYear = dayOfEra - (365 * yearOfEra + yearOfEra / 4 - yearOfEra / 100);
+    const int64_t shiftedMonth = (5 * dayOfYear + 2) / 153;
+    day = static_cast<int>(dayOfYear - (153 * shiftedMonth + 2) / 5 + 1);
+    month = static_cast<int>(shiftedMonth < 10 ? shiftedMonth + 3 : shiftedMonth - 9);
+    year = yearOfEra + era * 400 + (month <= 2 ? 1 : 0);
+}
+
+static inline bool ParseFixedDigits(const char* str, size_t count, int& value)
+{
+    value = 0;
+    for (size_t i = 0; i < count; ++i)
+    {
+        char c = str[i];
+        if (c < '0' || c > '9')
+        {
+            return false;
+        }
+        value = value * 10 + (c - '0');
+    }
+    return true;
+}
+
+static inline char* WriteFixedDigits(char* out, int value, size_t count)
+{
+    for (size_t i = count; i > 0; --i)
+    {
+        out[i - 1] = static_cast<char>('0' + value % 10);
+        value /= 10;
+    }
+    return out + count;
+}
+
+static inline bool ComposeSecondsSinceEpoch(int year, int month, int day, int hour, int minute, int second, int64_t& secondsSinceEpoch)
+{
+    //leave fields out of their calendar range, which timegm would normalize into another instant, to the slow path.
+    if (month < 1 || month > 12 || day < 1 || day > 31 || hour > 23 || minute > 59 || second > 60)
+    {
+        return false;
+    }
+
+    secondsSinceEpoch = DaysFromCivil(year, month, day) * SECONDS_PER_DAY + hour * 3600 + minute * 60 + second;
+    return true;
+}
+
+//"%Y-%m-%dT%H:%M:%SZ" optionally with a fraction before the Z, which is dropped like the state machine does.
+static bool TryParseIso8601Layout(const char* timestamp, size_t len, int64_t& secondsSinceEpoch)
+{
+    if (len < ISO_8601_LAYOUT_LENGTH || len > MAX_LEN || timestamp[len - 1] != 'Z'
+        || timestamp[4] != '-' || timestamp[7] != '-' || timestamp[10] != 'T' || timestamp[13] != ':' || timestamp[16] != ':')
+    {
+        return false;
+    }
+
+    if (len > ISO_8601_LAYOUT_LENGTH)
+    {
+        if (timestamp[19] != '.')
+        {
+            return false;
+        }
+        for (size_t i = 20; i < len - 1; ++i)
+        {
+            if (timestamp[i] < '0' || timestamp[i] > '9')
+            {
+                return false;
+            }
+        }
+    }
+
+    int year, month, day, hour, minute, second;
+    return ParseFixedDigits(timestamp, 4, year) && ParseFixedDigits(timestamp + 5, 2, month) && ParseFixedDigits(timestamp + 8, 2, day)
+        && ParseFixedDigits(timestamp + 11, 2, hour) && ParseFixedDigits(timestamp + 14, 2, minute) && ParseFixedDigits(timestamp + 17, 2, second)
+        && ComposeSecondsSinceEpoch(year, month, day, hour, minute, second, secondsSinceEpoch);
+}
+
+//"%a, %d %b %Y %H:%M:%S" followed by a UTC zone name.
+static bool TryParseRfc822Layout(const char* timestamp, size_t len, int64_t& secondsSinceEpoch)
+{
+    if (len != RFC822_LAYOUT_LENGTH || timestamp[3] != ',' || timestamp[4] != ' ' || timestamp[7] != ' ' || timestamp[11] != ' '
+        || timestamp[16] != ' ' || timestamp[19] != ':' || timestamp[22] != ':' || timestamp[25] != ' ')
+    {
+        return false;
+    }
+
+    const char* zone = timestamp + 26;
+    if (!isalpha(zone[0]) || !isalpha(zone[1]) || !isalpha(zone[2]) || !IsUtcTimeZone(zone)
+        || GetWeekDayNumberFromStr(timestamp, 0, 4) < 0)
+    {
+        return false;
+    }
+
+    int month = GetMonthNumberFromStr(timestamp, 8, 12);
+    int year, day, hour, minute, second;
+    return month >= 0 && ParseFixedDigits(timestamp + 5, 2, day) && ParseFixedDigits(timestamp + 12, 4, year)
+        && ParseFixedDigits(timestamp + 17, 2, hour) && ParseFixedDigits(timestamp + 20, 2, minute) && ParseFixedDigits(timestamp + 23, 2, second)
+        && ComposeSecondsSinceEpoch(year, month + 1, day, hour, minute, second, secondsSinceEpoch);
+}
+
+static bool TryParseFixedLayout(const char* timestamp, DateFormat format, int64_t& secondsSinceEpoch)
+{
+    size_t len = strlen(timestamp);
+    switch (format)
+    {
+    case DateFormat::RFC822:
+        return TryParseRfc822Layout(timestamp, len, secondsSinceEpoch);
+    case DateFormat::ISO_8601:
+        return TryParseIso8601Layout(timestamp, len, secondsSinceEpoch);
+    case DateFormat::AutoDetect:
+        return TryParseRfc822Layout(timestamp, len, secondsSinceEpoch) || TryParseIso8601Layout(timestamp, len, secondsSinceEpoch);
+    default:
+        return false;
+    }
+}
+
+//The broken down GMT time the fast formatters work from.
+struct GmtFields
+{
+    int64_t year;
+    int month;
+    int day;
+    int weekDay;
+    int hour;
+    int minute;
+    int second;
+};
+
+static GmtFields ComputeGmtFields(const std::chrono::system_clock::time_point& timePoint)
+{
+    //truncates like system_clock::to_time_t.
+    int64_t secondsSinceEpoch = std::chrono::duration_cast<std::chrono::seconds>(timePoint.time_since_epoch()).count();
+    int64_t days = secondsSinceEpoch / SECONDS_PER_DAY;
+    int64_t secondsOfDay = secondsSinceEpoch % SECONDS_PER_DAY;
+    if (secondsOfDay < 0)
+    {
+        secondsOfDay += SECONDS_PER_DAY;
+        --days;
+    }
+
+    GmtFields fields;
+    CivilFromDays(days, fields.year, fields.month, fields.day);
+    fields.weekDay = static_cast<int>((days % 7 + 11) % 7);
+    fields.hour = static_cast<int>(secondsOfDay / 3600);
+    fields.minute = static_cast<int>(secondsOfDay / 60 % 60);
+    fields.second = static_cast<int>(secondsOfDay % 60);
+    return fields;
+}
+
+//strftime prints %Y without padding or with more digits outside of these years.
+static inline bool HasFourDigitYear(const GmtFields& fields)
+{
+    return fields.year >= 1000 && fields.year <= 9999;
+}
+
+static size_t FormatFixedLayout(const GmtFields& fields, DateFormat format, char* buffer, size_t bufferSize)
+{
+    if (!HasFourDigitYear(fields))
+    {
+        return 0;
+    }
+
+    char* out = buffer;
+    switch (format)
+    {
+    case DateFormat::ISO_8601:
+        if (bufferSize <= ISO_8601_LAYOUT_LENGTH)
+        {
+            return 0;
+        }
+        out = WriteFixedDigits(out, static_cast<int>(fields.year), 4);
+        *out++ = '-';
+        out = WriteFixedDigits(out, fields.month, 2);
+        *out++ = '-';
+        out = WriteFixedDigits(out, fields.day, 2);
+        *out++ = 'T';
+        out = WriteFixedDigits(out, fields.hour, 2);
+        *out++ = ':';
+        out = WriteFixedDigits(out, fields.minute, 2);
+        *out++ = ':';
+        out = WriteFixedDigits(out, fields.second, 2);
+        *out++ = 'Z';
+        break;
+    case DateFormat::RFC822:
+        if (bufferSize <= RFC822_LAYOUT_LENGTH)
+        {
+            return 0;
+        }
+        memcpy(out, RFC822_WEEK_DAY_NAMES[fields.weekDay], 3);
+        out += 3;
+        *out++ = ',';
+        *out++ = ' ';
+        out = WriteFixedDigits(out, fields.day, 2);
+        *out++ = ' ';
+        memcpy(out, RFC822_MONTH_NAMES[fields.month - 1], 3);
+        out += 3;
+        *out++ = ' ';
+        out = WriteFixedDigits(out, static_cast<int>(fields.year), 4);
+        *out++ = ' ';
+        out = WriteFixedDigits(out, fields.hour, 2);
+        *out++ = ':';
+        out = WriteFixedDigits(out, fields.minute, 2);
+        *out++ = ':';
+        out = WriteFixedDigits(out, fields.second, 2);
+        memcpy(out, " GMT", 4);
+        out += 4;
+        break;
+    default:
+        return 0;
+    }
+
+    *out = '\0';
+    return static_cast<size_t>(out - buffer);
+}
+
+//Formats the purely numeric strftime conversions (%Y %m %d %H %M %S %%) the signer and friends use.
+//Returns 0 for anything else so the caller can hand it to strftime.
+static size_t FormatNumericPattern(const GmtFields& fields, const char* formatStr, char* buffer, size_t bufferSize)
+{
+    if (!HasFourDigitYear(fields))
+    {
+        return 0;
+    }
+
+    size_t length = 0;
+    for (const char* c = formatStr; *c; ++c)
+    {
+        //room for the widest conversion and the terminating null.
+        if (length + 5 > bufferSize)
+        {
+            return 0;
+        }
+
+        if (*c != '%')
+        {
+            buffer[length++] = *c;
+            continue;
+        }
+
+        switch (*++c)
+        {
+        case 'Y':
+            WriteFixedDigits(buffer + length, static_cast<int>(fields.year), 4);
+            length += 4;
+            break;
+        case 'm':
+            WriteFixedDigits(buffer + length, fields.month, 2);
+            length += 2;
+            break;
+        case 'd':
+            WriteFixedDigits(buffer + length, fields.day, 2);
+            length += 2;
+            break;
+        case 'H':
+            WriteFixedDigits(buffer + length, fields.hour, 2);
+            length += 2;
+            break;
+        case 'M':
+            WriteFixedDigits(buffer + length, fields.minute, 2);
+            length += 2;
+            break;
+        case 'S':
+            WriteFixedDigits(buffer + length, fields.second, 2);
+            length += 2;
+            break;
+        case '%':
+            buffer[length++] = '%';
+            break;
+        default:
+            return 0;
+        }
+    }
+
+    buffer[length] = '\0';
+    return length;
+}
+
 DateTime::DateTime(const std::chrono::system_clock::time_point& timepointToAssign) : m_time(timepointToAssign), m_valid(true)
 {   
 }
@@ -987,28 +1290,54 @@ Aws::String DateTime::ToLocalTimeString(const char* formatStr) const
 
 Aws::String DateTime::ToGmtString(DateFormat format) const
 {
+    char formattedString[MAX_GMT_STRING_LENGTH];
+    size_t length = ToGmtString(format, formattedString, sizeof(formattedString));
+    return Aws::String(formattedString, length);
+}
+
+size_t DateTime::ToGmtString(DateFormat format, char* buffer, size_t bufferSize) const
+{
+    size_t length = FormatFixedLayout(ComputeGmtFields(m_time), format, buffer, bufferSize);
+    if (length > 0)
+    {
+        return length;
+    }
+
+    Aws::String formattedString;
     switch (format)
     {
     case DateFormat::ISO_8601:
-        return ToGmtString(ISO_8601_LONG_DATE_FORMAT_STR);
+        formattedString = ToGmtString(ISO_8601_LONG_DATE_FORMAT_STR);
+        break;
     case DateFormat::RFC822:
-    {
         //Windows erronously drops the local timezone in for %Z
-        Aws::String rfc822GmtString = ToGmtString(RFC822_DATE_FORMAT_STR_MINUS_Z);
-        rfc822GmtString += " GMT";
-        return rfc822GmtString;
-    }
+        formattedString = ToGmtString(RFC822_DATE_FORMAT_STR_MINUS_Z);
+        formattedString += " GMT";
+        break;
     default:
         assert(0);
-        return "";
+        break;
     }
+
+    if (formattedString.empty() || formattedString.size() >= bufferSize)
+    {
+        return 0;
+    }
+
+    memcpy(buffer, formattedString.c_str(), formattedString.size() + 1);
+    return formattedString.size();
 }
 
 Aws::String DateTime::ToGmtString(const char* formatStr) const
-{    
-    struct tm gmtTimeStamp = ConvertTimestampToGmtStruct();
-
+{
     char formattedString[100];
+    size_t length = FormatNumericPattern(ComputeGmtFields(m_time), formatStr, formattedString, sizeof(formattedString));
+    if (length > 0)
+    {
+        return Aws::String(formattedString, length);
+    }
+
+    struct tm gmtTimeStamp = ConvertTimestampToGmtStruct();
     std::strftime(formattedString, sizeof(formattedString), formatStr, &gmtTimeStamp);
     return formattedString;
 }
@@ -1118,6 +1447,14 @@ std::chrono::milliseconds DateTime::operator-(const DateTime& other) const
 
 void DateTime::ConvertTimestampStringToTimePoint(const char* timestamp, DateFormat format)
 {  
+    int64_t secondsSinceEpoch = 0;
+    if (TryParseFixedLayout(timestamp, format, secondsSinceEpoch))
+    {
+        m_valid = true;
+        m_time = std::chrono::system_clock::time_point(std::chrono::seconds(secondsSinceEpoch));
+        return;
+    }
+
     std::tm timeStruct;
     bool isUtc = true;
 
@@ -15,20 +15,64 @@
 
 #include <aws/core/utils/EnumParseOverflowContainer.h>
 #include <aws/core/utils/logging/LogMacros.h>
+#include <aws/core/utils/memory/AWSMemory.h>
+#include <aws/core/utils/memory/ArenaMemorySystem.h>
 
 using namespace Aws::Utils;
-using namespace Aws::Utils::Threading;
 
 static const char LOG_TAG[] = "EnumParseOverflowContainer";
 
+EnumParseOverflowContainer::EnumParseOverflowContainer()
+{
+    for (auto& bucket : m_buckets)
+    {
+        bucket.store(nullptr, std::memory_order_relaxed);
+    }
+}
+
+EnumParseOverflowContainer::~EnumParseOverflowContainer()
+{
+    for (auto& bucket : m_buckets)
+    {
+        Entry* entry = bucket.load(std::memory_order_relaxed);
+        while (entry)
+        {
+            Value* value = entry->values;
+            while (value)
+            {
+                Value* nextValue = value->next;
+                Aws::Delete(value);
+                value = nextValue;
+            }
+
+            Entry* next = entry->next;
+            Aws::Delete(entry);
+            entry = next;
+        }
+    }
+}
+
+EnumParseOverflowContainer::Entry* EnumParseOverflowContainer::FindEntry(int hashCode) const
+{
+    for (Entry* entry = GetBucket(hashCode).load(std::memory_order_acquire); entry; entry = entry->next)
+    {
+        if (entry->hashCode == hashCode)
+        {
+            return entry;
+        }
+    }
+
+    return nullptr;
+}
+
 const Aws::String& EnumParseOverflowContainer::RetrieveOverflow(int hashCode) const
 {
-    ReaderLockGuard guard(m_overflowLock);
-    auto foundIter = m_overflowMap.find(hashCode);
-    if (foundIter != m_overflowMap.end())
+    const Entry* entry = FindEntry(hashCode);
+    if (entry)
     {
-        AWS_LOGSTREAM_DEBUG(LOG_TAG, "Found value " << foundIter->second << " for hash " << hashCode << " from enum overflow container.");
-        return foundIter->second;
+        const Aws::String& value = entry->current.load(std::memory_order_acquire)->value;
+        AWS_LOGSTREAM_DEBUG(LOG_TAG, "Found value " << value << " for hash " << hashCode << " from enum overflow container.");
+        return value;
     }
 
     AWS_LOGSTREAM_ERROR(LOG_TAG, "Could not find a previously stored overflow value for hash " << hashCode << ". This will likely break some requests.");
@@ -37,7 +81,39 @@ const Aws::String& EnumParseOverflowContainer::RetrieveOverflow(int hashCode) co
 
 void EnumParseOverflowContainer::StoreOverflow(int hashCode, const Aws::String& value)
 {
-    WriterLockGuard guard(m_overflowLock);
+    //the same unmodeled value is usually seen in every response, only the first one needs to be stored.
+    Entry* entry = FindEntry(hashCode);
+    if (entry && entry->current.load(std::memory_order_acquire)->value == value)
+    {
+        return;
+    }
+
+    std::lock_guard<std::mutex> locker(m_storeLock);
+    Aws::Utils::Memory::HeapScope heapScope;
+    entry = FindEntry(hashCode);
+    if (entry)
+    {
+        //colliding values that alternate are each stored once, the last one stored is what lookups return.
+        for (const Value* stored = entry->values; stored; stored = stored->next)
+        {
+            if (stored->value == value)
+            {
+                entry->current.store(stored, std::memory_order_release);
+                return;
+            }
+        }
+    }
+
     AWS_LOGSTREAM_WARN(LOG_TAG, "Encountered enum member " << value << " which is not modeled in your clients. You should update your clients when you get a chance.");
-    m_overflowMap[hashCode] = value;
+    //nothing is ever unlinked, references handed out by RetrieveOverflow stay valid for the lifetime of the container.
+    if (entry)
+    {
+        entry->values = Aws::New<Value>(LOG_TAG, value, entry->values);
+        entry->current.store(entry->values, std::memory_order_release);
+        return;
+    }
+
+    std::atomic<Entry*>& bucket = GetBucket(hashCode);
+    Value* firstValue = Aws::New<Value>(LOG_TAG, value, nullptr);
+    bucket.store(Aws::New<Entry>(LOG_TAG, hashCode, firstValue, bucket.load(std::memory_order_relaxed)), std::memory_order_release);
 }
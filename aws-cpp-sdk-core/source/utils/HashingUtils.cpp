@@ -20,6 +20,7 @@
 #include <aws/core/utils/crypto/Sha256HMAC.h>
 #include <aws/core/utils/crypto/MD5.h>
 #include <aws/core/utils/Outcome.h>
+#include <aws/core/utils/BufferPool.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 #include <aws/core/utils/memory/stl/AWSList.h>
 
@@ -126,14 +127,14 @@ ByteBuffer HashingUtils::CalculateSHA256TreeHash(Aws::IOStream& stream)
         stream.clear();
     }
     stream.seekg(0, stream.beg);
-    Array<char> streamBuffer(TREE_HASH_ONE_MB);
+    PooledBuffer streamBuffer(TREE_HASH_ONE_MB);
     while (stream.good())
     {
-        stream.read(streamBuffer.GetUnderlyingData(), TREE_HASH_ONE_MB);
+        stream.read(streamBuffer.GetData(), TREE_HASH_ONE_MB);
         auto bytesRead = stream.gcount();
         if (bytesRead > 0)
         {
-            input.push_back(hash.Calculate(Aws::String(reinterpret_cast<char*>(streamBuffer.GetUnderlyingData()), static_cast<size_t>(bytesRead))).GetResult());
+            input.push_back(hash.Calculate(Aws::String(streamBuffer.GetData(), static_cast<size_t>(bytesRead))).GetResult());
         }
     }
     stream.clear();
@@ -0,0 +1,177 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/core/utils/HdrHistogram.h>
+
+#include <algorithm>
+
+using namespace Aws::Utils;
+
+static inline int BitLength(uint64_t value)
+{
+    int length = 0;
+    while (value >= 0x100)
+    {
+        value >>= 8;
+        length += 8;
+    }
+    while (value)
+    {
+        value >>= 1;
+        ++length;
+    }
+    return length;
+}
+
+HdrHistogram::HdrHistogram(int64_t highestTrackableValue, int significantFigures) :
+    m_highestTrackableValue((std::max)(highestTrackableValue, static_cast<int64_t>(1))),
+    m_significantFigures((std::min)((std::max)(significantFigures, 1), 5)),
+    m_subBucketHalfCountMagnitude(0),
+    m_subBucketHalfCount(0),
+    m_subBucketMask(0),
+    m_totalCount(0),
+    m_min(0),
+    m_max(0)
+{
+    //enough sub-buckets that neighbouring values in the top half of any bucket differ in less than the last kept digit.
+    int64_t largestValueWithSingleUnitResolution = 2;
+    for (int i = 0; i < m_significantFigures; ++i)
+    {
+        largestValueWithSingleUnitResolution *= 10;
+    }
+    int subBucketCountMagnitude = BitLength(static_cast<uint64_t>(largestValueWithSingleUnitResolution - 1));
+    m_subBucketHalfCountMagnitude = subBucketCountMagnitude - 1;
+    m_subBucketHalfCount = static_cast<int64_t>(1) << m_subBucketHalfCountMagnitude;
+    m_subBucketMask = (static_cast<int64_t>(1) << subBucketCountMagnitude) - 1;
+}
+
+void HdrHistogram::Record(int64_t value, int64_t count)
+{
+    if (count <= 0)
+    {
+        return;
+    }
+
+    value = (std::min)((std::max)(value, static_cast<int64_t>(0)), m_highestTrackableValue);
+    size_t index = GetCountsIndex(value);
+    if (index >= m_counts.size())
+    {
+        m_counts.resize(index + 1, 0);
+    }
+    m_counts[index] += count;
+
+    m_min = m_totalCount ? (std::min)(m_min, value) : value;
+    m_max = (std::max)(m_max, value);
+    m_totalCount += count;
+}
+
+void HdrHistogram::Add(const HdrHistogram& other)
+{
+    if (other.m_totalCount == 0)
+    {
+        return;
+    }
+
+    if (other.m_counts.size() > m_counts.size())
+    {
+        m_counts.resize(other.m_counts.size(), 0);
+    }
+    for (size_t i = 0; i < other.m_counts.size(); ++i)
+    {
+        m_counts[i] += other.m_counts[i];
+    }
+
+    m_min = m_totalCount ? (std::min)(m_min, other.m_min) : other.m_min;
+    m_max = (std::max)(m_max, other.m_max);
+    m_totalCount += other.m_totalCount;
+}
+
+void HdrHistogram::Reset()
+{
+    m_counts.clear();
+    m_totalCount = 0;
+    m_min = 0;
+    m_max = 0;
+}
+
+int64_t HdrHistogram::GetValueAtPercentile(double percentile) const
+{
+    if (m_totalCount == 0)
+    {
+        return 0;
+    }
+
+    percentile = (std::min)((std::max)(percentile, 0.0), 100.0);
+    int64_t countAtPercentile = static_cast<int64_t>(percentile / 100.0 * static_cast<double>(m_totalCount) + 0.5);
+    countAtPercentile = (std::max)(countAtPercentile, static_cast<int64_t>(1));
+
+    int64_t runningCount = 0;
+    for (size_t i = 0; i < m_counts.size(); ++i)
+    {
+        runningCount += m_counts[i];
+        if (runningCount >= countAtPercentile)
+        {
+            return (std::min)(GetHighestEquivalentValue(GetValueFromIndex(i)), m_max);
+        }
+    }
+    return m_max;
+}
+
+double HdrHistogram::GetMean() const
+{
+    if (m_totalCount == 0)
+    {
+        return 0.0;
+    }
+
+    //every value counts as the middle of its sub-bucket.
+    double total = 0.0;
+    for (size_t i = 0; i < m_counts.size(); ++i)
+    {
+        if (m_counts[i])
+        {
+            int64_t lowest = GetValueFromIndex(i);
+            double median = (static_cast<double>(lowest) + static_cast<double>(GetHighestEquivalentValue(lowest))) / 2.0;
+            total += median * static_cast<double>(m_counts[i]);
+        }
+    }
+    return total / static_cast<double>(m_totalCount);
+}
+
+size_t HdrHistogram::GetCountsIndex(int64_t value) const
+{
+    int bucketIndex = BitLength(static_cast<uint64_t>(value | m_subBucketMask)) - (m_subBucketHalfCountMagnitude + 1);
+    int64_t subBucketIndex = value >> bucketIndex;
+    return static_cast<size_t>((static_cast<int64_t>(bucketIndex + 1) << m_subBucketHalfCountMagnitude) + (subBucketIndex - m_subBucketHalfCount));
+}
+
+int64_t HdrHistogram::GetValueFromIndex(size_t index) const
+{
+    int bucketIndex = static_cast<int>(index >> m_subBucketHalfCountMagnitude) - 1;
+    int64_t subBucketIndex = static_cast<int64_t>(index & static_cast<size_t>(m_subBucketHalfCount - 1)) + m_subBucketHalfCount;
+    if (bucketIndex < 0)
+    {
+        subBucketIndex -= m_subBucketHalfCount;
+        bucketIndex = 0;
+    }
+    return subBucketIndex << bucketIndex;
+}
+
+int64_t HdrHistogram::GetHighestEquivalentValue(int64_t value) const
+{
+    int bucketIndex = BitLength(static_cast<uint64_t>(value | m_subBucketMask)) - (m_subBucketHalfCountMagnitude + 1);
+    int64_t lowestEquivalentValue = (value >> bucketIndex) << bucketIndex;
+    return lowestEquivalentValue + (static_cast<int64_t>(1) << bucketIndex) - 1;
+}
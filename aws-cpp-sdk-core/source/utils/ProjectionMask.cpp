@@ -0,0 +1,134 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/core/utils/ProjectionMask.h>
+#include <aws/core/utils/StringUtils.h>
+#include <aws/core/utils/memory/AWSMemory.h>
+
+#include <cstring>
+
+using namespace Aws::Utils;
+
+static const char* PROJECTION_MASK_ALLOCATION_TAG = "ProjectionMask";
+
+ProjectionMask::ProjectionMask(std::initializer_list<const char*> paths)
+{
+    for (const char* path : paths)
+    {
+        AddPath(path);
+    }
+}
+
+ProjectionMask& ProjectionMask::AddPath(const Aws::String& path)
+{
+    Aws::Vector<Aws::String> memberNames = StringUtils::Split(path, '.');
+    if (memberNames.empty())
+    {
+        return *this;
+    }
+
+    if (!m_root)
+    {
+        m_root = Aws::MakeShared<Node>(PROJECTION_MASK_ALLOCATION_TAG);
+    }
+    else
+    {
+        //copies and sub masks handed out earlier share nodes with this mask, they keep the selection they were created with.
+        m_root = CloneNode(*m_root);
+    }
+
+    Node* node = m_root.get();
+    for (const auto& memberName : memberNames)
+    {
+        if (node->selectsAll)
+        {
+            return *this;
+        }
+
+        std::shared_ptr<Node> child;
+        for (const auto& entry : node->children)
+        {
+            if (entry.first == memberName)
+            {
+                child = entry.second;
+                break;
+            }
+        }
+
+        if (!child)
+        {
+            child = Aws::MakeShared<Node>(PROJECTION_MASK_ALLOCATION_TAG);
+            node->children.emplace_back(memberName, child);
+        }
+        node = child.get();
+    }
+
+    node->selectsAll = true;
+    node->children.clear();
+    return *this;
+}
+
+bool ProjectionMask::SelectsAll() const
+{
+    return !m_root || m_root->selectsAll;
+}
+
+bool ProjectionMask::Includes(const char* memberName) const
+{
+    return SelectsAll() || FindChild(memberName) != nullptr;
+}
+
+ProjectionMask ProjectionMask::GetSubMask(const char* memberName) const
+{
+    if (SelectsAll())
+    {
+        return ProjectionMask();
+    }
+
+    const std::shared_ptr<Node>* child = FindChild(memberName);
+    if (child)
+    {
+        return (*child)->selectsAll ? ProjectionMask() : ProjectionMask(*child);
+    }
+
+    //nothing below an unselected member is selected either. All of those share one node that owns nothing and is
+    //never freed; AddPath clones a root before changing it, so the node stays empty.
+    static Node selectsNothing;
+    return ProjectionMask(std::shared_ptr<Node>(std::shared_ptr<Node>(), &selectsNothing));
+}
+
+const std::shared_ptr<ProjectionMask::Node>* ProjectionMask::FindChild(const char* memberName) const
+{
+    for (const auto& entry : m_root->children)
+    {
+        if (std::strcmp(entry.first.c_str(), memberName) == 0)
+        {
+            return &entry.second;
+        }
+    }
+
+    return nullptr;
+}
+
+std::shared_ptr<ProjectionMask::Node> ProjectionMask::CloneNode(const Node& node)
+{
+    auto clone = Aws::MakeShared<Node>(PROJECTION_MASK_ALLOCATION_TAG);
+    clone->selectsAll = node.selectsAll;
+    for (const auto& entry : node.children)
+    {
+        clone->children.emplace_back(entry.first, CloneNode(*entry.second));
+    }
+    return clone;
+}
@@ -0,0 +1,138 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/core/utils/QueryStringBuilder.h>
+#include <aws/core/utils/StringUtils.h>
+
+#include <cstdio>
+#include <cstring>
+
+using namespace Aws::Utils;
+
+namespace
+{
+    void AppendUnsigned(Aws::String& output, unsigned long long value)
+    {
+        char digits[20];
+        size_t digitCount = 0;
+        do
+        {
+            digits[digitCount++] = static_cast<char>('0' + value % 10);
+            value /= 10;
+        } while (value);
+
+        while (digitCount)
+        {
+            output.push_back(digits[--digitCount]);
+        }
+    }
+
+    void AppendSigned(Aws::String& output, long long value)
+    {
+        if (value < 0)
+        {
+            output.push_back('-');
+            //negate in unsigned arithmetic, -value overflows for the smallest long long.
+            AppendUnsigned(output, 0ull - static_cast<unsigned long long>(value));
+        }
+        else
+        {
+            AppendUnsigned(output, static_cast<unsigned long long>(value));
+        }
+    }
+}
+
+QueryStringBuilder::QueryStringBuilder(size_t initialCapacity)
+{
+    m_queryString.reserve(initialCapacity);
+}
+
+size_t QueryStringBuilder::PushLocation(const char* location)
+{
+    size_t mark = m_location.size();
+    m_location.append(location);
+    return mark;
+}
+
+size_t QueryStringBuilder::PushLocation(const char* location, unsigned index, const char* locationValue)
+{
+    size_t mark = m_location.size();
+    m_location.append(location);
+    AppendUnsigned(m_location, index);
+    m_location.append(locationValue);
+    return mark;
+}
+
+void QueryStringBuilder::PopLocation(size_t mark)
+{
+    m_location.resize(mark);
+}
+
+void QueryStringBuilder::AppendName(const char* name)
+{
+    if (!m_queryString.empty())
+    {
+        m_queryString.push_back('&');
+    }
+    m_queryString.append(m_location);
+    m_queryString.append(name);
+    m_queryString.push_back('=');
+}
+
+void QueryStringBuilder::AddParameter(const char* name, const char* value)
+{
+    AddParameter(name, value, strlen(value));
+}
+
+void QueryStringBuilder::AddParameter(const char* name, const char* value, size_t valueLength)
+{
+    AppendName(name);
+    StringUtils::URLEncodeAppend(m_queryString, value, valueLength);
+}
+
+void QueryStringBuilder::AddParameter(const char* name, const Aws::String& value)
+{
+    AddParameter(name, value.c_str(), value.size());
+}
+
+void QueryStringBuilder::AddParameter(const char* name, bool value)
+{
+    AppendName(name);
+    m_queryString.append(value ? "true" : "false");
+}
+
+void QueryStringBuilder::AddParameter(const char* name, int value)
+{
+    AppendName(name);
+    AppendSigned(m_queryString, value);
+}
+
+void QueryStringBuilder::AddParameter(const char* name, long long value)
+{
+    AppendName(name);
+    AppendSigned(m_queryString, value);
+}
+
+void QueryStringBuilder::AddParameter(const char* name, double value)
+{
+    //same formatting as StringUtils::URLEncode(double).
+    char buffer[32];
+#if defined(_MSC_VER) && _MSC_VER < 1900
+    _snprintf_s(buffer, sizeof(buffer), _TRUNCATE, "%g", value);
+#else
+    snprintf(buffer, sizeof(buffer), "%g", value);
+#endif
+    AddParameter(name, buffer);
+}
@@ -52,24 +52,32 @@ void StringUtils::Replace(Aws::String& s, const char* search, const char* replac
 
 
 Aws::String StringUtils::ToLower(const char* source)
+{
+    return ToLower(StringView(source));
+}
+
+Aws::String StringUtils::ToLower(StringView source)
 {
     Aws::String copy;
-    size_t sourceLength = strlen(source);
-    copy.resize(sourceLength);
+    copy.resize(source.size());
     //appease the latest whims of the VC++ 2017 gods
-    std::transform(source, source + sourceLength, copy.begin(), [](unsigned char c) { return (char)::tolower(c); });
+    std::transform(source.begin(), source.end(), copy.begin(), [](unsigned char c) { return (char)::tolower(c); });
 
     return copy;
 }
 
 
 Aws::String StringUtils::ToUpper(const char* source)
+{
+    return ToUpper(StringView(source));
+}
+
+Aws::String StringUtils::ToUpper(StringView source)
 {
     Aws::String copy;
-    size_t sourceLength = strlen(source);
-    copy.resize(sourceLength);
+    copy.resize(source.size());
     //appease the latest whims of the VC++ 2017 gods
-    std::transform(source, source + sourceLength, copy.begin(), [](unsigned char c) { return (char)::toupper(c); });
+    std::transform(source.begin(), source.end(), copy.begin(), [](unsigned char c) { return (char)::toupper(c); });
 
     return copy;
 }
@@ -77,10 +85,13 @@ Aws::String StringUtils::ToUpper(const char* source)
 
 bool StringUtils::CaselessCompare(const char* value1, const char* value2)
 {
-    Aws::String value1Lower = ToLower(value1);
-    Aws::String value2Lower = ToLower(value2);
+    return CaselessCompare(StringView(value1), StringView(value2));
+}
 
-    return value1Lower == value2Lower;
+bool StringUtils::CaselessCompare(StringView value1, StringView value2)
+{
+    return value1.size() == value2.size() && std::equal(value1.begin(), value1.end(), value2.begin(),
+        [](unsigned char c1, unsigned char c2) { return ::tolower(c1) == ::tolower(c2); });
 }
 
 Aws::Vector<Aws::String> StringUtils::Split(const Aws::String& toSplit, char splitOn)
@@ -127,30 +138,69 @@ Aws::Vector<Aws::String> StringUtils::SplitOnLine(const Aws::String& toSplit)
 }
 
 
+namespace
+{
+    //1 for the characters URLEncode leaves alone: alphanumerics and -_.~ (RFC 3986 unreserved).
+    const unsigned char UNRESERVED_CHARACTERS[256] =
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, //0x00
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, //0x10
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, //0x20
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, //0x30
+        0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, //0x40
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 1, //0x50
+        0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, //0x60
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 1, 0, //0x70
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, //0x80
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, //0x90
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, //0xA0
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, //0xB0
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, //0xC0
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, //0xD0
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, //0xE0
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 //0xF0
+    };
+
+    const char UPPER_HEX_DIGITS[] = "0123456789ABCDEF";
+}
+
 Aws::String StringUtils::URLEncode(const char* unsafe)
 {
-    Aws::StringStream escaped;
-    escaped.fill('0');
-    escaped << std::hex << std::uppercase;
+    Aws::String escaped;
+    URLEncodeAppend(escaped, unsafe, strlen(unsafe));
+    return escaped;
+}
+
+Aws::String StringUtils::URLEncode(StringView unsafe)
+{
+    Aws::String escaped;
+    URLEncodeAppend(escaped, unsafe.data(), unsafe.size());
+    return escaped;
+}
 
-    size_t unsafeLength = strlen(unsafe);
-    for (auto i = unsafe, n = unsafe + unsafeLength; i != n; ++i)
+void StringUtils::URLEncodeAppend(Aws::String& output, const char* unsafe, size_t length)
+{
+    output.reserve(output.size() + length);
+    const unsigned char* current = reinterpret_cast<const unsigned char*>(unsafe);
+    const unsigned char* end = current + length;
+    while (current != end)
     {
-        int c = *i;
-		//MSVC 2015 has an assertion that c is positive in isalnum(). This breaks unicode support.
-		//bypass that with the first check.
-        if (c >= 0 && (isalnum(c) || c == '-' || c == '_' || c == '.' || c == '~'))
+        //copy runs of characters that need no escaping in one go, most values are nothing but.
+        const unsigned char* runStart = current;
+        while (current != end && UNRESERVED_CHARACTERS[*current])
         {
-            escaped << (char)c;
+            ++current;
         }
-        else
+        output.append(reinterpret_cast<const char*>(runStart), current - runStart);
+
+        if (current != end)
         {
-            //this unsigned char cast allows us to handle unicode characters.
-            escaped << '%' << std::setw(2) << int((unsigned char)c) << std::setw(0);
+            //the unsigned char handles utf-8 multibyte characters as well.
+            char percentEncoded[3] = { '%', UPPER_HEX_DIGITS[*current >> 4], UPPER_HEX_DIGITS[*current & 0x0F] };
+            output.append(percentEncoded, sizeof(percentEncoded));
+            ++current;
         }
     }
-
-    return escaped.str();
 }
 
 Aws::String StringUtils::UTF8Escape(const char* unicodeString, const char* delimiter)
@@ -221,25 +271,58 @@ Aws::String StringUtils::URLDecode(const char* safe)
     return unescaped.str();
 }
 
+static inline bool IsNotSpace(unsigned char ch)
+{
+    return !::isspace(ch);
+}
+
 Aws::String StringUtils::LTrim(const char* source)
 {
-    Aws::String copy(source);
-    copy.erase(copy.begin(), std::find_if(copy.begin(), copy.end(), [](int ch) { return !::isspace(ch); }));
-    return copy;
+    return LTrim(StringView(source));
+}
+
+Aws::String StringUtils::LTrim(StringView source)
+{
+    return Aws::String(std::find_if(source.begin(), source.end(), IsNotSpace), source.end());
 }
 
 // trim from end
 Aws::String StringUtils::RTrim(const char* source)
 {
-    Aws::String copy(source);
-    copy.erase(std::find_if(copy.rbegin(), copy.rend(), [](int ch) { return !::isspace(ch); }).base(), copy.end());
-    return copy;
+    return RTrim(StringView(source));
+}
+
+Aws::String StringUtils::RTrim(StringView source)
+{
+    const char* end = source.end();
+    while (end != source.begin() && !IsNotSpace(*(end - 1)))
+    {
+        --end;
+    }
+    return Aws::String(source.begin(), end);
 }
 
 // trim from both ends
 Aws::String StringUtils::Trim(const char* source)
 {
-    return LTrim(RTrim(source).c_str());
+    return Trim(StringView(source));
+}
+
+Aws::String StringUtils::Trim(StringView source)
+{
+    StringView trimmed = TrimView(source);
+    return Aws::String(trimmed.data(), trimmed.size());
+}
+
+StringView StringUtils::TrimView(StringView source)
+{
+    const char* begin = std::find_if(source.begin(), source.end(), IsNotSpace);
+    const char* end = source.end();
+    while (end != begin && !IsNotSpace(*(end - 1)))
+    {
+        --end;
+    }
+    return StringView(begin, static_cast<size_t>(end - begin));
 }
 
 long long StringUtils::ConvertToInt64(const char* source)
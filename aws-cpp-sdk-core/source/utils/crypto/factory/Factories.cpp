@@ -17,6 +17,10 @@
 #include <aws/core/utils/crypto/Factories.h>
 #include <aws/core/utils/crypto/Hash.h>
 #include <aws/core/utils/crypto/HMAC.h>
+#include <aws/core/utils/memory/ArenaMemorySystem.h>
+
+#include <atomic>
+#include <mutex>
 
 #if ENABLE_BCRYPT_ENCRYPTION
     #include <aws/core/utils/crypto/bcrypt/CryptoImpl.h>
@@ -53,6 +57,9 @@ static std::shared_ptr<SecureRandomBytes> s_SecureRandom(nullptr);
 
 static bool s_InitCleanupOpenSSLFlag(false);
 
+static std::atomic<bool> s_StaticStateInitialized(false);
+static std::mutex s_StaticStateMutex;
+
 class DefaultMD5Factory : public HashFactory
 {
 public:
@@ -569,135 +576,187 @@ void Aws::Utils::Crypto::SetInitCleanupOpenSSLFlag(bool initCleanupFlag)
 
 void Aws::Utils::Crypto::InitCrypto()
 {
-    if(s_MD5Factory)
+    if(!s_MD5Factory)
     {
-        s_MD5Factory->InitStaticState();
+        s_MD5Factory = Aws::MakeShared<DefaultMD5Factory>(s_allocationTag);
     }
-    else
+
+    if(!s_Sha256Factory)
     {
-        s_MD5Factory = Aws::MakeShared<DefaultMD5Factory>(s_allocationTag);
-        s_MD5Factory->InitStaticState();
+        s_Sha256Factory = Aws::MakeShared<DefaultSHA256Factory>(s_allocationTag);
     }
 
-    if(s_Sha256Factory)
+    if(!s_Sha256HMACFactory)
     {
-        s_Sha256Factory->InitStaticState();
+        s_Sha256HMACFactory = Aws::MakeShared<DefaultSHA256HmacFactory>(s_allocationTag);
     }
-    else
+
+    if(!s_AES_CBCFactory)
     {
-        s_Sha256Factory = Aws::MakeShared<DefaultSHA256Factory>(s_allocationTag);
-        s_Sha256Factory->InitStaticState();
+        s_AES_CBCFactory = Aws::MakeShared<DefaultAES_CBCFactory>(s_allocationTag);
     }
 
-    if(s_Sha256HMACFactory)
+    if(!s_AES_CTRFactory)
     {
-        s_Sha256HMACFactory->InitStaticState();
+        s_AES_CTRFactory = Aws::MakeShared<DefaultAES_CTRFactory>(s_allocationTag);
     }
-    else
+
+    if(!s_AES_GCMFactory)
     {
-        s_Sha256HMACFactory = Aws::MakeShared<DefaultSHA256HmacFactory>(s_allocationTag);
-        s_Sha256HMACFactory->InitStaticState();
+        s_AES_GCMFactory = Aws::MakeShared<DefaultAES_GCMFactory>(s_allocationTag);
     }
 
-    if(s_AES_CBCFactory)
+    if(!s_AES_KeyWrapFactory)
     {
-        s_AES_CBCFactory->InitStaticState();
+        s_AES_KeyWrapFactory = Aws::MakeShared<DefaultAES_KeyWrapFactory>(s_allocationTag);
     }
-    else
+
+    if(!s_SecureRandomFactory)
     {
-        s_AES_CBCFactory = Aws::MakeShared<DefaultAES_CBCFactory>(s_allocationTag);
-        s_AES_CBCFactory->InitStaticState();
+        s_SecureRandomFactory = Aws::MakeShared<DefaultSecureRandFactory>(s_allocationTag);
     }
+}
 
-    if(s_AES_CTRFactory)
+/**
+ * Sets up the static state of every installed factory (initializing OpenSSL for the default ones) the first time any of
+ * them is asked for an implementation, rather than in InitCrypto, so processes that never hash, sign or encrypt don't pay for it.
+ */
+static void EnsureStaticStateInitialized()
+{
+    if(s_StaticStateInitialized.load(std::memory_order_acquire))
     {
-        s_AES_CTRFactory->InitStaticState();
+        return;
     }
-    else
+
+    std::lock_guard<std::mutex> locker(s_StaticStateMutex);
+    if(s_StaticStateInitialized.load(std::memory_order_relaxed))
     {
-        s_AES_CTRFactory = Aws::MakeShared<DefaultAES_CTRFactory>(s_allocationTag);
-        s_AES_CTRFactory->InitStaticState();
+        return;
     }
 
-    if(s_AES_GCMFactory)
+    Aws::Utils::Memory::HeapScope heapScope;
+
+    if(s_MD5Factory)
     {
-        s_AES_GCMFactory->InitStaticState();
+        s_MD5Factory->InitStaticState();
     }
-    else
+
+    if(s_Sha256Factory)
     {
-        s_AES_GCMFactory = Aws::MakeShared<DefaultAES_GCMFactory>(s_allocationTag);
-        s_AES_GCMFactory->InitStaticState();
+        s_Sha256Factory->InitStaticState();
     }
 
-    if (!s_AES_KeyWrapFactory)
+    if(s_Sha256HMACFactory)
     {
-        s_AES_KeyWrapFactory = Aws::MakeShared<DefaultAES_KeyWrapFactory>(s_allocationTag);
+        s_Sha256HMACFactory->InitStaticState();
     }
-    s_AES_KeyWrapFactory->InitStaticState();
 
-    if(s_SecureRandomFactory)
+    if(s_AES_CBCFactory)
     {
-        s_SecureRandomFactory->InitStaticState();       
+        s_AES_CBCFactory->InitStaticState();
     }
-    else
+
+    if(s_AES_CTRFactory)
+    {
+        s_AES_CTRFactory->InitStaticState();
+    }
+
+    if(s_AES_GCMFactory)
+    {
+        s_AES_GCMFactory->InitStaticState();
+    }
+
+    if(s_AES_KeyWrapFactory)
+    {
+        s_AES_KeyWrapFactory->InitStaticState();
+    }
+
+    if(s_SecureRandomFactory)
     {
-        s_SecureRandomFactory = Aws::MakeShared<DefaultSecureRandFactory>(s_allocationTag);
         s_SecureRandomFactory->InitStaticState();
-    }  
-    
-    s_SecureRandom = s_SecureRandomFactory->CreateImplementation();
+        s_SecureRandom = s_SecureRandomFactory->CreateImplementation();
+    }
+
+    s_StaticStateInitialized.store(true, std::memory_order_release);
 }
 
 void Aws::Utils::Crypto::CleanupCrypto()
 {
+    std::lock_guard<std::mutex> locker(s_StaticStateMutex);
+    bool staticStateInitialized = s_StaticStateInitialized.exchange(false);
+
     if(s_MD5Factory)
     {
-        s_MD5Factory->CleanupStaticState();
+        if(staticStateInitialized)
+        {
+            s_MD5Factory->CleanupStaticState();
+        }
         s_MD5Factory = nullptr;
     }
 
     if(s_Sha256Factory)
     {
-        s_Sha256Factory->CleanupStaticState();
+        if(staticStateInitialized)
+        {
+            s_Sha256Factory->CleanupStaticState();
+        }
         s_Sha256Factory = nullptr;
     }
 
     if(s_Sha256HMACFactory)
     {
-        s_Sha256HMACFactory->CleanupStaticState();
-        s_Sha256HMACFactory =  nullptr;
+        if(staticStateInitialized)
+        {
+            s_Sha256HMACFactory->CleanupStaticState();
+        }
+        s_Sha256HMACFactory = nullptr;
     }
 
     if(s_AES_CBCFactory)
     {
-        s_AES_CBCFactory->CleanupStaticState();
+        if(staticStateInitialized)
+        {
+            s_AES_CBCFactory->CleanupStaticState();
+        }
         s_AES_CBCFactory = nullptr;
     }
 
     if(s_AES_CTRFactory)
     {
-        s_AES_CTRFactory->CleanupStaticState();
+        if(staticStateInitialized)
+        {
+            s_AES_CTRFactory->CleanupStaticState();
+        }
         s_AES_CTRFactory = nullptr;
     }
 
     if(s_AES_GCMFactory)
     {
-        s_AES_GCMFactory->CleanupStaticState();
+        if(staticStateInitialized)
+        {
+            s_AES_GCMFactory->CleanupStaticState();
+        }
         s_AES_GCMFactory = nullptr;
     }
 
     if(s_AES_KeyWrapFactory)
     {
-        s_AES_KeyWrapFactory->CleanupStaticState();
+        if(staticStateInitialized)
+        {
+            s_AES_KeyWrapFactory->CleanupStaticState();
+        }
         s_AES_KeyWrapFactory = nullptr;
     }
 
     if(s_SecureRandomFactory)
     {
         s_SecureRandom = nullptr;
-        s_SecureRandomFactory->CleanupStaticState();
+        if(staticStateInitialized)
+        {
+            s_SecureRandomFactory->CleanupStaticState();
+        }
         s_SecureRandomFactory = nullptr;
-    }   
+    }
 }
 
 void Aws::Utils::Crypto::SetMD5Factory(const std::shared_ptr<HashFactory>& factory)
@@ -742,16 +801,19 @@ void Aws::Utils::Crypto::SetSecureRandomFactory(const std::shared_ptr<SecureRand
 
 std::shared_ptr<Hash> Aws::Utils::Crypto::CreateMD5Implementation()
 {
+    EnsureStaticStateInitialized();
     return s_MD5Factory->CreateImplementation();
 }
 
 std::shared_ptr<Hash> Aws::Utils::Crypto::CreateSha256Implementation()
 {
+    EnsureStaticStateInitialized();
     return s_Sha256Factory->CreateImplementation();
 }
 
 std::shared_ptr<Aws::Utils::Crypto::HMAC> Aws::Utils::Crypto::CreateSha256HMACImplementation()
 {
+    EnsureStaticStateInitialized();
     return s_Sha256HMACFactory->CreateImplementation();
 }
 
@@ -765,6 +827,7 @@ std::shared_ptr<SymmetricCipher> Aws::Utils::Crypto::CreateAES_CBCImplementation
 #ifdef NO_SYMMETRIC_ENCRYPTION
     return nullptr;
 #endif
+    EnsureStaticStateInitialized();
     return s_AES_CBCFactory->CreateImplementation(key);
 }
 
@@ -773,6 +836,7 @@ std::shared_ptr<SymmetricCipher> Aws::Utils::Crypto::CreateAES_CBCImplementation
 #ifdef NO_SYMMETRIC_ENCRYPTION
     return nullptr;
 #endif
+    EnsureStaticStateInitialized();
     return s_AES_CBCFactory->CreateImplementation(key, iv);
 }
 
@@ -781,6 +845,7 @@ std::shared_ptr<SymmetricCipher> Aws::Utils::Crypto::CreateAES_CBCImplementation
 #ifdef NO_SYMMETRIC_ENCRYPTION
     return nullptr;
 #endif
+    EnsureStaticStateInitialized();
     return s_AES_CBCFactory->CreateImplementation(std::move(key), std::move(iv));
 }
 
@@ -789,6 +854,7 @@ std::shared_ptr<SymmetricCipher> Aws::Utils::Crypto::CreateAES_CTRImplementation
 #ifdef NO_SYMMETRIC_ENCRYPTION
     return nullptr;
 #endif
+    EnsureStaticStateInitialized();
     return s_AES_CTRFactory->CreateImplementation(key);
 }
 
@@ -797,6 +863,7 @@ std::shared_ptr<SymmetricCipher> Aws::Utils::Crypto::CreateAES_CTRImplementation
 #ifdef NO_SYMMETRIC_ENCRYPTION
     return nullptr;
 #endif
+    EnsureStaticStateInitialized();
     return s_AES_CTRFactory->CreateImplementation(key, iv);
 }
 
@@ -805,6 +872,7 @@ std::shared_ptr<SymmetricCipher> Aws::Utils::Crypto::CreateAES_CTRImplementation
 #ifdef NO_SYMMETRIC_ENCRYPTION
     return nullptr;
 #endif
+    EnsureStaticStateInitialized();
     return s_AES_CTRFactory->CreateImplementation(std::move(key), std::move(iv));
 }
 
@@ -813,6 +881,7 @@ std::shared_ptr<SymmetricCipher> Aws::Utils::Crypto::CreateAES_GCMImplementation
 #ifdef NO_SYMMETRIC_ENCRYPTION
     return nullptr;
 #endif
+    EnsureStaticStateInitialized();
     return s_AES_GCMFactory->CreateImplementation(key);
 }
 
@@ -821,6 +890,7 @@ std::shared_ptr<SymmetricCipher> Aws::Utils::Crypto::CreateAES_GCMImplementation
 #ifdef NO_SYMMETRIC_ENCRYPTION
     return nullptr;
 #endif
+    EnsureStaticStateInitialized();
     return s_AES_GCMFactory->CreateImplementation(key, iv, tag);
 }
 
@@ -829,6 +899,7 @@ std::shared_ptr<SymmetricCipher> Aws::Utils::Crypto::CreateAES_GCMImplementation
 #ifdef NO_SYMMETRIC_ENCRYPTION
     return nullptr;
 #endif
+    EnsureStaticStateInitialized();
     return s_AES_GCMFactory->CreateImplementation(std::move(key), std::move(iv), std::move(tag));
 }
 
@@ -837,6 +908,7 @@ std::shared_ptr<SymmetricCipher> Aws::Utils::Crypto::CreateAES_KeyWrapImplementa
 #ifdef NO_SYMMETRIC_ENCRYPTION
     return nullptr;
 #endif
+    EnsureStaticStateInitialized();
     return s_AES_KeyWrapFactory->CreateImplementation(key);
 }
 
@@ -846,5 +918,6 @@ std::shared_ptr<SymmetricCipher> Aws::Utils::Crypto::CreateAES_KeyWrapImplementa
 
 std::shared_ptr<SecureRandomBytes> Aws::Utils::Crypto::CreateSecureRandomBytesImplementation()
 {
+    EnsureStaticStateInitialized();
     return s_SecureRandom;
 }
@@ -128,30 +128,51 @@ static void AddOrReplace(cJSON* root, const char* key, cJSON* value)
     }
 }
 
-JsonValue& JsonValue::WithString(const char* key, const Aws::String& value)
+JsonValue& JsonValue::WithString(const char* key, const char* value)
 {
     if (!m_value)
     {
         m_value = cJSON_CreateObject();
     }
 
-    const auto val = cJSON_CreateString(value.c_str());
+    const auto val = cJSON_CreateString(value);
     AddOrReplace(m_value, key, val);
     return *this;
 }
 
+JsonValue& JsonValue::WithString(const char* key, const Aws::String& value)
+{
+    return WithString(key, value.c_str());
+}
+
 JsonValue& JsonValue::WithString(const Aws::String& key, const Aws::String& value)
 {
-    return WithString(key.c_str(), value);
+    return WithString(key.c_str(), value.c_str());
 }
 
-JsonValue& JsonValue::AsString(const Aws::String& value)
+JsonValue& JsonValue::WithString(const char* key, Aws::Utils::StringView value)
+{
+    //cJSON only takes null terminated strings.
+    return WithString(key, value.ToString().c_str());
+}
+
+JsonValue& JsonValue::AsString(const char* value)
 {
     Destroy();
-    m_value = cJSON_CreateString(value.c_str());
+    m_value = cJSON_CreateString(value);
     return *this;
 }
 
+JsonValue& JsonValue::AsString(const Aws::String& value)
+{
+    return AsString(value.c_str());
+}
+
+JsonValue& JsonValue::AsString(Aws::Utils::StringView value)
+{
+    return AsString(value.ToString().c_str());
+}
+
 JsonValue& JsonValue::WithBool(const char* key, bool value)
 {
     if (!m_value)
@@ -16,9 +16,15 @@
 
 #include <aws/core/utils/logging/AWSLogging.h>
 #include <aws/core/utils/logging/LogSystemInterface.h>
+#include <aws/core/utils/logging/LogLevel.h>
+#include <aws/core/utils/memory/AWSMemory.h>
 #include <aws/core/utils/memory/stl/AWSStack.h>
+#include <aws/core/utils/memory/stl/AWSMap.h>
 
 #include <memory>
+#include <atomic>
+#include <mutex>
+#include <cstring>
 
 using namespace Aws::Utils;
 using namespace Aws::Utils::Logging;
@@ -26,6 +32,108 @@ using namespace Aws::Utils::Logging;
 static std::shared_ptr<LogSystemInterface> AWSLogSystem(nullptr);
 static std::shared_ptr<LogSystemInterface> OldLogger(nullptr);
 
+static const char* TAG_LEVELS_ALLOCATION_TAG = "TagLogLevels";
+
+namespace
+{
+    const size_t TAG_SLOT_COUNT = 1024;
+    const size_t MAX_TAG_PROBES = 16;
+
+    /*
+     * Cache of the level of every tag seen by address. state is the generation of the tag levels it was resolved in,
+     * shifted left by 8, plus the tag's level + 1, or 0 if the tag has none. Slots are claimed under s_tagLevelLock and
+     * keep their tag until CleanupTagLogLevels.
+     */
+    struct TagLevelSlot
+    {
+        std::atomic<const char*> key;
+        std::atomic<const char*> text;
+        std::atomic<uint64_t> state;
+    };
+
+    TagLevelSlot s_tagLevelSlots[TAG_SLOT_COUNT];
+    std::atomic<bool> s_hasTagLevels(false);
+    std::atomic<uint64_t> s_tagLevelGeneration(1);
+    std::mutex s_tagLevelLock;
+    Aws::Map<Aws::String, LogLevel>* s_tagLevels(nullptr);
+
+    inline size_t HashTag(const char* tag)
+    {
+        uint64_t value = static_cast<uint64_t>(reinterpret_cast<uintptr_t>(tag));
+        return static_cast<size_t>((value * 0x9E3779B97F4A7C15ULL) >> 32) & (TAG_SLOT_COUNT - 1);
+    }
+
+    //requires s_tagLevelLock.
+    uint64_t ResolveTagLevel(const char* tag)
+    {
+        if (!s_tagLevels)
+        {
+            return 0;
+        }
+        auto iter = s_tagLevels->find(tag);
+        return iter == s_tagLevels->end() ? 0 : static_cast<uint64_t>(iter->second) + 1;
+    }
+
+    //requires s_tagLevelLock.
+    uint64_t CacheTagLevel(TagLevelSlot& slot, const char* tag)
+    {
+        uint64_t level = ResolveTagLevel(tag);
+        slot.state.store((s_tagLevelGeneration.load(std::memory_order_relaxed) << 8) | level, std::memory_order_release);
+        return level;
+    }
+
+    //the tag's level + 1, or 0 if it has none.
+    uint64_t GetTagLevel(const char* tag)
+    {
+        uint64_t generation = s_tagLevelGeneration.load(std::memory_order_acquire);
+        size_t index = HashTag(tag);
+        for (size_t probes = 0; probes < MAX_TAG_PROBES; ++probes, index = (index + 1) & (TAG_SLOT_COUNT - 1))
+        {
+            TagLevelSlot& slot = s_tagLevelSlots[index];
+            const char* key = slot.key.load(std::memory_order_acquire);
+            if (!key)
+            {
+                std::lock_guard<std::mutex> locker(s_tagLevelLock);
+                key = slot.key.load(std::memory_order_relaxed);
+                if (!key)
+                {
+                    size_t length = strlen(tag);
+                    char* text = static_cast<char*>(Aws::Malloc(TAG_LEVELS_ALLOCATION_TAG, length + 1));
+                    memcpy(text, tag, length + 1);
+                    slot.text.store(text, std::memory_order_relaxed);
+                    uint64_t level = CacheTagLevel(slot, tag);
+                    slot.key.store(tag, std::memory_order_release);
+                    return level;
+                }
+                if (key == tag && strcmp(slot.text.load(std::memory_order_relaxed), tag) == 0)
+                {
+                    return CacheTagLevel(slot, tag);
+                }
+                continue;
+            }
+
+            if (key == tag)
+            {
+                //the address may belong to a different tag by now, those are looked up every time.
+                if (strcmp(slot.text.load(std::memory_order_relaxed), tag) != 0)
+                {
+                    break;
+                }
+                uint64_t state = slot.state.load(std::memory_order_acquire);
+                if ((state >> 8) == generation)
+                {
+                    return state & 0xFF;
+                }
+                std::lock_guard<std::mutex> locker(s_tagLevelLock);
+                return CacheTagLevel(slot, tag);
+            }
+        }
+
+        std::lock_guard<std::mutex> locker(s_tagLevelLock);
+        return ResolveTagLevel(tag);
+    }
+}
+
 namespace Aws
 {
 namespace Utils
@@ -56,6 +164,74 @@ void PopLogger()
     OldLogger = nullptr;
 }
 
+void SetLogLevelForTag(const char* tag, LogLevel logLevel)
+{
+    std::lock_guard<std::mutex> locker(s_tagLevelLock);
+    if (!s_tagLevels)
+    {
+        s_tagLevels = Aws::New<Aws::Map<Aws::String, LogLevel>>(TAG_LEVELS_ALLOCATION_TAG);
+    }
+    (*s_tagLevels)[tag] = logLevel;
+    s_tagLevelGeneration.fetch_add(1, std::memory_order_release);
+    s_hasTagLevels.store(true, std::memory_order_release);
+}
+
+void ResetLogLevelForTag(const char* tag)
+{
+    std::lock_guard<std::mutex> locker(s_tagLevelLock);
+    if (s_tagLevels)
+    {
+        s_tagLevels->erase(tag);
+        s_tagLevelGeneration.fetch_add(1, std::memory_order_release);
+        s_hasTagLevels.store(!s_tagLevels->empty(), std::memory_order_release);
+    }
+}
+
+void ResetTagLogLevels()
+{
+    std::lock_guard<std::mutex> locker(s_tagLevelLock);
+    if (s_tagLevels)
+    {
+        s_tagLevels->clear();
+        s_tagLevelGeneration.fetch_add(1, std::memory_order_release);
+        s_hasTagLevels.store(false, std::memory_order_release);
+    }
+}
+
+bool IsLogLevelEnabled(LogSystemInterface* logSystem, LogLevel logLevel, const char* tag)
+{
+    if (tag && s_hasTagLevels.load(std::memory_order_acquire))
+    {
+        uint64_t tagLevel = GetTagLevel(tag);
+        if (tagLevel)
+        {
+            return static_cast<LogLevel>(tagLevel - 1) >= logLevel;
+        }
+    }
+
+    return logSystem->GetLogLevel() >= logLevel;
+}
+
+void CleanupTagLogLevels()
+{
+    std::lock_guard<std::mutex> locker(s_tagLevelLock);
+    for (size_t i = 0; i < TAG_SLOT_COUNT; ++i)
+    {
+        TagLevelSlot& slot = s_tagLevelSlots[i];
+        if (slot.key.load(std::memory_order_relaxed))
+        {
+            slot.key.store(nullptr, std::memory_order_relaxed);
+            Aws::Free(const_cast<char*>(slot.text.load(std::memory_order_relaxed)));
+            slot.text.store(nullptr, std::memory_order_relaxed);
+        }
+    }
+
+    Aws::Delete(s_tagLevels);
+    s_tagLevels = nullptr;
+    s_tagLevelGeneration.fetch_add(1, std::memory_order_release);
+    s_hasTagLevels.store(false, std::memory_order_release);
+}
+
 } // namespace Logging
 } // namespace Utils
 } // namespace Aws
\ No newline at end of file
@@ -0,0 +1,1282 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/core/utils/logging/BinaryLogSystem.h>
+
+#include <aws/core/utils/DateTime.h>
+#include <aws/core/utils/Array.h>
+#include <aws/core/utils/StringUtils.h>
+#include <aws/core/utils/memory/AWSMemory.h>
+#include <aws/core/utils/memory/ArenaMemorySystem.h>
+#include <aws/core/utils/memory/stl/AWSMap.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+
+#include <fstream>
+#include <cstdarg>
+#include <cstring>
+#include <chrono>
+#include <algorithm>
+#include <stdio.h>
+
+//without thread_local there is no hook for thread exit, buffers of exited threads are then kept until the log system is destroyed.
+#if defined(_MSC_VER) && _MSC_VER < 1900
+#define AWS_BINARY_LOG_THREAD_LOCAL __declspec(thread)
+#else
+#define AWS_BINARY_LOG_THREAD_LOCAL thread_local
+#define AWS_BINARY_LOG_THREAD_EXIT_HOOK 1
+#endif
+
+using namespace Aws::Utils;
+using namespace Aws::Utils::Logging;
+
+static const char* AllocationTag = "BinaryLogSystem";
+
+namespace
+{
+    /*
+     * The log is a file header followed by entries, each an EntryHeader and length bytes of payload, in the byte order of
+     * the machine that wrote it:
+     *
+     *   ENTRY_STRING   uint32 id, then the text of the tag or format string with that id
+     *   ENTRY_THREAD   uint32 thread index, then the text of the thread's id
+     *   ENTRY_RECORDS  uint32 thread index, uint32 unused, then records as the thread wrote them into its buffer
+     *   ENTRY_DROPPED  uint64 number of messages dropped since the last such entry, int64 timestamp
+     *
+     * A record is a RecordHeader followed by either the arguments of the format string (RECORD_EVENT) or the tag, when
+     * it could not be given an id, and the text (RECORD_TEXT). Integers, floating point numbers and pointers take eight
+     * bytes each, strings a uint32 length, NULL_STRING for a null pointer, and the characters.
+     */
+    const char FILE_MAGIC[8] = { 'A', 'W', 'S', 'B', 'L', 'O', 'G', 1 };
+    const uint32_t BYTE_ORDER_MARK = 0x01020304;
+
+    struct FileHeader
+    {
+        char magic[8];
+        uint32_t byteOrderMark;
+        uint32_t reserved;
+    };
+
+    enum EntryType : uint32_t
+    {
+        ENTRY_STRING = 1,
+        ENTRY_THREAD = 2,
+        ENTRY_RECORDS = 3,
+        ENTRY_DROPPED = 4
+    };
+
+    struct EntryHeader
+    {
+        uint32_t type;
+        uint32_t length;
+    };
+
+    enum RecordKind : uint8_t
+    {
+        RECORD_PADDING = 0,
+        RECORD_EVENT = 1,
+        RECORD_TEXT = 2
+    };
+
+    //padding records at the end of a thread's buffer only have the first PADDING_SIZE bytes.
+    struct RecordHeader
+    {
+        uint32_t size;
+        uint8_t kind;
+        uint8_t level;
+        uint16_t inlineTagLength;
+        uint32_t tagId;
+        uint32_t formatId;
+        int64_t timestamp;
+    };
+
+    const size_t RECORD_ALIGNMENT = 8;
+    const size_t PADDING_SIZE = 8;
+    const uint32_t NULL_STRING = 0xFFFFFFFF;
+
+    //bytes available to the arguments of one Log call; longer strings are cut short.
+    const size_t MAX_EVENT_SIZE = 2048;
+    const size_t MAX_ARGUMENTS = 32;
+
+    const size_t MAX_STRINGS = 8192;
+    const size_t STRING_TABLE_SIZE = MAX_STRINGS * 2;
+
+    const std::chrono::milliseconds FLUSH_INTERVAL(100);
+
+    enum ArgumentType : unsigned char
+    {
+        ARG_END = 0,
+        ARG_INT,
+        ARG_UINT,
+        ARG_LONG,
+        ARG_ULONG,
+        ARG_LONG_LONG,
+        ARG_ULONG_LONG,
+        ARG_SIZE,
+        ARG_PTRDIFF,
+        ARG_INTMAX,
+        ARG_UINTMAX,
+        ARG_DOUBLE,
+        ARG_LONG_DOUBLE,
+        ARG_STRING,
+        ARG_POINTER,
+        ARG_UNSUPPORTED
+    };
+
+    struct Conversion
+    {
+        size_t begin;
+        size_t end;
+        bool widthArgument;
+        bool precisionArgument;
+        ArgumentType type;
+    };
+
+    inline bool IsDigit(char c)
+    {
+        return c >= '0' && c <= '9';
+    }
+
+    ArgumentType GetArgumentType(const char* length, size_t lengthSize, char conversion)
+    {
+        bool none = lengthSize == 0 || length[0] == 'h';
+        bool isLong = lengthSize == 1 && length[0] == 'l';
+        bool isLongLong = lengthSize == 2 && length[0] == 'l';
+
+        switch (conversion)
+        {
+            case 'd':
+            case 'i':
+            case 'o':
+            case 'u':
+            case 'x':
+            case 'X':
+            {
+                bool isSigned = conversion == 'd' || conversion == 'i';
+                if (none) return isSigned ? ARG_INT : ARG_UINT;
+                if (isLong) return isSigned ? ARG_LONG : ARG_ULONG;
+                if (isLongLong) return isSigned ? ARG_LONG_LONG : ARG_ULONG_LONG;
+                if (length[0] == 'j') return isSigned ? ARG_INTMAX : ARG_UINTMAX;
+                if (length[0] == 'z') return ARG_SIZE;
+                if (length[0] == 't') return ARG_PTRDIFF;
+                return ARG_UNSUPPORTED;
+            }
+            case 'c':
+                return lengthSize == 0 ? ARG_INT : ARG_UNSUPPORTED;
+            case 'f':
+            case 'F':
+            case 'e':
+            case 'E':
+            case 'g':
+            case 'G':
+            case 'a':
+            case 'A':
+                if (lengthSize == 0 || isLong) return ARG_DOUBLE;
+                if (length[0] == 'L') return ARG_LONG_DOUBLE;
+                return ARG_UNSUPPORTED;
+            case 's':
+                return lengthSize == 0 ? ARG_STRING : ARG_UNSUPPORTED;
+            case 'p':
+                return lengthSize == 0 ? ARG_POINTER : ARG_UNSUPPORTED;
+            default:
+                //%n, wide characters and anything this does not know about.
+                return ARG_UNSUPPORTED;
+        }
+    }
+
+    //finds the next conversion of format at or after cursor and moves cursor past it, returns false when there is none.
+    bool NextConversion(const char* format, size_t& cursor, Conversion& conversion)
+    {
+        for (; format[cursor]; ++cursor)
+        {
+            if (format[cursor] != '%')
+            {
+                continue;
+            }
+            if (format[cursor + 1] == '%')
+            {
+                ++cursor;
+                continue;
+            }
+
+            size_t position = cursor + 1;
+            conversion.begin = cursor;
+            conversion.widthArgument = false;
+            conversion.precisionArgument = false;
+
+            while (format[position] && strchr("-+ #0", format[position]))
+            {
+                ++position;
+            }
+            if (format[position] == '*')
+            {
+                conversion.widthArgument = true;
+                ++position;
+            }
+            while (IsDigit(format[position]))
+            {
+                ++position;
+            }
+            if (format[position] == '$')
+            {
+                //positional arguments can't be read in order.
+                conversion.type = ARG_UNSUPPORTED;
+                conversion.end = cursor = position + 1;
+                return true;
+            }
+            if (format[position] == '.')
+            {
+                ++position;
+                if (format[position] == '*')
+                {
+                    conversion.precisionArgument = true;
+                    ++position;
+                }
+                while (IsDigit(format[position]))
+                {
+                    ++position;
+                }
+            }
+
+            size_t lengthStart = position;
+            while (format[position] && strchr("hljztL", format[position]))
+            {
+                ++position;
+            }
+
+            if (!format[position])
+            {
+                conversion.type = ARG_UNSUPPORTED;
+                conversion.end = cursor = position;
+                return true;
+            }
+
+            conversion.type = position - lengthStart > 2 ? ARG_UNSUPPORTED :
+                GetArgumentType(format + lengthStart, position - lengthStart, format[position]);
+            conversion.end = cursor = position + 1;
+            return true;
+        }
+
+        return false;
+    }
+
+    //the arguments a format string reads, in order and ending with ARG_END, or just ARG_UNSUPPORTED.
+    unsigned char* CreateSignature(const char* format)
+    {
+        unsigned char signature[MAX_ARGUMENTS + 1];
+        size_t count = 0;
+        bool supported = true;
+
+        size_t cursor = 0;
+        Conversion conversion;
+        while (supported && NextConversion(format, cursor, conversion))
+        {
+            if (conversion.widthArgument && count < MAX_ARGUMENTS)
+            {
+                signature[count++] = ARG_INT;
+            }
+            if (conversion.precisionArgument && count < MAX_ARGUMENTS)
+            {
+                signature[count++] = ARG_INT;
+            }
+            supported = conversion.type != ARG_UNSUPPORTED && count < MAX_ARGUMENTS;
+            if (supported)
+            {
+                signature[count++] = static_cast<unsigned char>(conversion.type);
+            }
+        }
+
+        if (!supported)
+        {
+            count = 0;
+            signature[count++] = ARG_UNSUPPORTED;
+        }
+        signature[count++] = ARG_END;
+
+        unsigned char* result = static_cast<unsigned char*>(Aws::Malloc(AllocationTag, count));
+        memcpy(result, signature, count);
+        return result;
+    }
+
+    inline size_t HashPointer(const void* pointer)
+    {
+        uint64_t value = static_cast<uint64_t>(reinterpret_cast<uintptr_t>(pointer));
+        return static_cast<size_t>((value * 0x9E3779B97F4A7C15ULL) >> 32) & (STRING_TABLE_SIZE - 1);
+    }
+
+    inline size_t AlignRecordSize(size_t size)
+    {
+        return (size + RECORD_ALIGNMENT - 1) & ~(RECORD_ALIGNMENT - 1);
+    }
+
+    inline int64_t GetTimestamp()
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+    }
+
+    template<typename T>
+    inline char* Put(char* cursor, T value)
+    {
+        memcpy(cursor, &value, sizeof(T));
+        return cursor + sizeof(T);
+    }
+
+    std::atomic<uint64_t> s_nextSystemId(1);
+    std::mutex s_liveSystemsLock;
+    BinaryLogSystem* s_liveSystems = nullptr;
+}
+
+namespace Aws
+{
+    namespace Utils
+    {
+        namespace Logging
+        {
+            /**
+             * Single producer, single consumer ring of records owned by one logging thread.
+             */
+            struct ThreadLogBuffer
+            {
+                ThreadLogBuffer() : data(nullptr), capacity(0), pendingHead(0), cachedTail(0), threadIndex(0),
+                    announced(false), next(nullptr), head(0), tail(0), retired(false)
+                {
+                }
+
+                char* data;
+                size_t capacity;
+                //only touched by the owning thread.
+                size_t pendingHead;
+                size_t cachedTail;
+                //only touched by the writer.
+                uint32_t threadIndex;
+                Aws::String threadName;
+                bool announced;
+                ThreadLogBuffer* next;
+
+                //keeps the positions off the cache lines the owner writes for every record.
+                char padding[64];
+                std::atomic<size_t> head;
+                std::atomic<size_t> tail;
+                std::atomic<bool> retired;
+            };
+
+            struct BinaryLogSystem::StringEntry
+            {
+                StringEntry() : key(nullptr), id(0) {}
+
+                std::atomic<const char*> key;
+                std::atomic<uint32_t> id;
+            };
+
+            class ThreadLogBufferHolder
+            {
+            public:
+#ifdef AWS_BINARY_LOG_THREAD_EXIT_HOOK
+                ~ThreadLogBufferHolder()
+                {
+                    Release();
+                }
+#endif
+
+                //hands the buffer to its log system to be written out and freed, if that still exists.
+                void Release()
+                {
+                    if (!buffer)
+                    {
+                        return;
+                    }
+
+                    std::lock_guard<std::mutex> locker(s_liveSystemsLock);
+                    for (BinaryLogSystem* system = s_liveSystems; system; system = system->m_nextLive)
+                    {
+                        if (system->m_id == systemId)
+                        {
+                            system->RetireThreadBuffer(buffer);
+                            break;
+                        }
+                    }
+                    buffer = nullptr;
+                    systemId = 0;
+                }
+
+                uint64_t systemId;
+                ThreadLogBuffer* buffer;
+            };
+
+        } // namespace Logging
+    } // namespace Utils
+} // namespace Aws
+
+static AWS_BINARY_LOG_THREAD_LOCAL ThreadLogBufferHolder s_threadBuffer;
+
+static std::shared_ptr<Aws::OStream> MakeBinaryLogFile(const Aws::String& filenamePrefix)
+{
+    Aws::String newFileName = filenamePrefix + DateTime::CalculateGmtTimestampAsString("%Y-%m-%d-%H") + ".blog";
+    return Aws::MakeShared<Aws::OFStream>(AllocationTag, newFileName.c_str(), Aws::OFStream::out | Aws::OFStream::app | Aws::OFStream::binary);
+}
+
+static void WriteEntry(Aws::OStream& output, uint32_t type, const void* payload, size_t length, const char* text = nullptr, size_t textLength = 0)
+{
+    EntryHeader header;
+    header.type = type;
+    header.length = static_cast<uint32_t>(length + textLength);
+    output.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    output.write(static_cast<const char*>(payload), length);
+    if (textLength > 0)
+    {
+        output.write(text, textLength);
+    }
+}
+
+static void WriteFileHeader(Aws::OStream& output)
+{
+    FileHeader header;
+    memcpy(header.magic, FILE_MAGIC, sizeof(FILE_MAGIC));
+    header.byteOrderMark = BYTE_ORDER_MARK;
+    header.reserved = 0;
+    output.write(reinterpret_cast<const char*>(&header), sizeof(header));
+}
+
+BinaryLogSystem::BinaryLogSystem(LogLevel logLevel, const std::shared_ptr<Aws::OStream>& logFile, size_t threadBufferSize) :
+    m_logLevel(logLevel),
+    m_logFile(logFile),
+    m_filenamePrefix(),
+    m_threadBufferSize(threadBufferSize),
+    m_id(s_nextSystemId.fetch_add(1, std::memory_order_relaxed)),
+    m_stringTable(nullptr),
+    m_strings(nullptr),
+    m_signatures(nullptr),
+    m_stringCount(1),
+    m_buffers(nullptr),
+    m_nextThreadIndex(0),
+    m_writtenStringCount(1),
+    m_reportedDroppedMessages(0),
+    m_lastRolledHour(-1),
+    m_droppedMessages(0),
+    m_flushRequested(false),
+    m_stopLogging(false),
+    m_nextLive(nullptr)
+{
+    Start();
+}
+
+BinaryLogSystem::BinaryLogSystem(LogLevel logLevel, const Aws::String& filenamePrefix, size_t threadBufferSize) :
+    m_logLevel(logLevel),
+    m_logFile(MakeBinaryLogFile(filenamePrefix)),
+    m_filenamePrefix(filenamePrefix),
+    m_threadBufferSize(threadBufferSize),
+    m_id(s_nextSystemId.fetch_add(1, std::memory_order_relaxed)),
+    m_stringTable(nullptr),
+    m_strings(nullptr),
+    m_signatures(nullptr),
+    m_stringCount(1),
+    m_buffers(nullptr),
+    m_nextThreadIndex(0),
+    m_writtenStringCount(1),
+    m_reportedDroppedMessages(0),
+    // localtime requires access to env. variables to get Timezone, which is not thread-safe
+    m_lastRolledHour(DateTime::Now().GetHour(false /*localtime*/)),
+    m_droppedMessages(0),
+    m_flushRequested(false),
+    m_stopLogging(false),
+    m_nextLive(nullptr)
+{
+    Start();
+}
+
+void BinaryLogSystem::Start()
+{
+    //the largest record from Log has to fit in a quarter of the buffer.
+    size_t capacity = 16 * 1024;
+    while (capacity < m_threadBufferSize)
+    {
+        capacity <<= 1;
+    }
+    m_threadBufferSize = capacity;
+
+    m_stringTable = Aws::NewArray<StringEntry>(STRING_TABLE_SIZE, AllocationTag);
+    m_strings = static_cast<const char**>(Aws::Malloc(AllocationTag, MAX_STRINGS * sizeof(const char*)));
+    m_signatures = static_cast<const unsigned char**>(Aws::Malloc(AllocationTag, MAX_STRINGS * sizeof(const unsigned char*)));
+    memset(m_strings, 0, MAX_STRINGS * sizeof(const char*));
+    memset(m_signatures, 0, MAX_STRINGS * sizeof(const unsigned char*));
+
+    WriteFileHeader(*m_logFile);
+
+    {
+        std::lock_guard<std::mutex> locker(s_liveSystemsLock);
+        m_nextLive = s_liveSystems;
+        s_liveSystems = this;
+    }
+
+    m_loggingThread = std::thread(&BinaryLogSystem::LoggingThread, this);
+}
+
+BinaryLogSystem::~BinaryLogSystem()
+{
+    {
+        std::lock_guard<std::mutex> locker(s_liveSystemsLock);
+        BinaryLogSystem** link = &s_liveSystems;
+        while (*link != this)
+        {
+            link = &(*link)->m_nextLive;
+        }
+        *link = m_nextLive;
+    }
+
+    if (s_threadBuffer.systemId == m_id)
+    {
+        s_threadBuffer.buffer = nullptr;
+        s_threadBuffer.systemId = 0;
+    }
+
+    {
+        std::lock_guard<std::mutex> locker(m_signalLock);
+        m_stopLogging.store(true);
+    }
+    m_signal.notify_one();
+    m_loggingThread.join();
+
+    WriteBuffers();
+
+    while (m_buffers)
+    {
+        ThreadLogBuffer* buffer = m_buffers;
+        m_buffers = buffer->next;
+        Aws::Free(buffer->data);
+        Aws::Delete(buffer);
+    }
+
+    uint32_t stringCount = m_stringCount.load();
+    for (uint32_t id = 1; id < stringCount; ++id)
+    {
+        Aws::Free(const_cast<char*>(m_strings[id]));
+        Aws::Free(const_cast<unsigned char*>(m_signatures[id]));
+    }
+    Aws::Free(m_strings);
+    Aws::Free(m_signatures);
+    Aws::DeleteArray(m_stringTable);
+}
+
+void BinaryLogSystem::Log(LogLevel logLevel, const char* tag, const char* formatStr, ...)
+{
+    uint32_t tagId = InternString(tag, true);
+    uint32_t formatId = InternString(formatStr, false);
+    const unsigned char* signature = formatId ? m_signatures[formatId] : nullptr;
+
+    std::va_list args;
+    va_start(args, formatStr);
+
+    if (!tagId || !signature || signature[0] == ARG_UNSUPPORTED)
+    {
+        //formats the arguments can't be copied for are formatted right away.
+        va_list tmp_args;
+        va_copy(tmp_args, args);
+        #ifdef WIN32
+            const int requiredLength = _vscprintf(formatStr, tmp_args) + 1;
+        #else
+            const int requiredLength = vsnprintf(nullptr, 0, formatStr, tmp_args) + 1;
+        #endif
+        va_end(tmp_args);
+
+        Array<char> outputBuff(requiredLength);
+        #ifdef WIN32
+            vsnprintf_s(outputBuff.GetUnderlyingData(), requiredLength, _TRUNCATE, formatStr, args);
+        #else
+            vsnprintf(outputBuff.GetUnderlyingData(), requiredLength, formatStr, args);
+        #endif // WIN32
+        va_end(args);
+
+        LogText(logLevel, tag, outputBuff.GetUnderlyingData(), requiredLength - 1);
+        return;
+    }
+
+    //room for the header, MAX_EVENT_SIZE bytes of strings and whatever fixed size arguments come after the last one.
+    char record[sizeof(RecordHeader) + MAX_EVENT_SIZE + MAX_ARGUMENTS * sizeof(uint64_t)];
+    char* cursor = record + sizeof(RecordHeader);
+    const char* stringLimit = record + sizeof(RecordHeader) + MAX_EVENT_SIZE;
+
+    for (; *signature != ARG_END; ++signature)
+    {
+        switch (*signature)
+        {
+            case ARG_INT: cursor = Put<int64_t>(cursor, va_arg(args, int)); break;
+            case ARG_UINT: cursor = Put<uint64_t>(cursor, va_arg(args, unsigned int)); break;
+            case ARG_LONG: cursor = Put<int64_t>(cursor, va_arg(args, long)); break;
+            case ARG_ULONG: cursor = Put<uint64_t>(cursor, va_arg(args, unsigned long)); break;
+            case ARG_LONG_LONG: cursor = Put<int64_t>(cursor, va_arg(args, long long)); break;
+            case ARG_ULONG_LONG: cursor = Put<uint64_t>(cursor, va_arg(args, unsigned long long)); break;
+            case ARG_SIZE: cursor = Put<uint64_t>(cursor, va_arg(args, size_t)); break;
+            case ARG_PTRDIFF: cursor = Put<int64_t>(cursor, va_arg(args, ptrdiff_t)); break;
+            case ARG_INTMAX: cursor = Put<int64_t>(cursor, va_arg(args, intmax_t)); break;
+            case ARG_UINTMAX: cursor = Put<uint64_t>(cursor, va_arg(args, uintmax_t)); break;
+            case ARG_DOUBLE: cursor = Put<double>(cursor, va_arg(args, double)); break;
+            case ARG_LONG_DOUBLE: cursor = Put<double>(cursor, static_cast<double>(va_arg(args, long double))); break;
+            case ARG_POINTER: cursor = Put<uint64_t>(cursor, static_cast<uint64_t>(reinterpret_cast<uintptr_t>(va_arg(args, void*)))); break;
+            case ARG_STRING:
+            {
+                const char* str = va_arg(args, const char*);
+                if (!str)
+                {
+                    cursor = Put<uint32_t>(cursor, NULL_STRING);
+                    break;
+                }
+                size_t room = cursor + sizeof(uint32_t) < stringLimit ? stringLimit - cursor - sizeof(uint32_t) : 0;
+                size_t length = strlen(str);
+                length = length < room ? length : room;
+                cursor = Put<uint32_t>(cursor, static_cast<uint32_t>(length));
+                memcpy(cursor, str, length);
+                cursor += length;
+                break;
+            }
+            default:
+                break;
+        }
+    }
+    va_end(args);
+
+    RecordHeader header;
+    header.size = static_cast<uint32_t>(AlignRecordSize(static_cast<size_t>(cursor - record)));
+    header.kind = RECORD_EVENT;
+    header.level = static_cast<uint8_t>(logLevel);
+    header.inlineTagLength = 0;
+    header.tagId = tagId;
+    header.formatId = formatId;
+    header.timestamp = GetTimestamp();
+    memcpy(record, &header, sizeof(header));
+
+    ThreadLogBuffer* buffer = GetThreadBuffer();
+    char* destination = Reserve(buffer, header.size);
+    if (destination)
+    {
+        memcpy(destination, record, cursor - record);
+        Commit(buffer);
+    }
+}
+
+void BinaryLogSystem::LogStream(LogLevel logLevel, const char* tag, const Aws::OStringStream &messageStream)
+{
+    Aws::String message = messageStream.str();
+    LogText(logLevel, tag, message.c_str(), message.size());
+}
+
+void BinaryLogSystem::LogText(LogLevel logLevel, const char* tag, const char* text, size_t length)
+{
+    uint32_t tagId = InternString(tag, true);
+    size_t tagLength = tagId || !tag ? 0 : (std::min)(strlen(tag), static_cast<size_t>(0xFFFF));
+
+    //messages longer than a quarter of the buffer are cut short.
+    size_t maxRecordSize = m_threadBufferSize / 4;
+    size_t maxLength = maxRecordSize - sizeof(RecordHeader) - tagLength - RECORD_ALIGNMENT;
+    length = length < maxLength ? length : maxLength;
+
+    RecordHeader header;
+    header.size = static_cast<uint32_t>(AlignRecordSize(sizeof(RecordHeader) + tagLength + length));
+    header.kind = RECORD_TEXT;
+    header.level = static_cast<uint8_t>(logLevel);
+    header.inlineTagLength = static_cast<uint16_t>(tagLength);
+    header.tagId = tagId;
+    header.formatId = static_cast<uint32_t>(length);
+    header.timestamp = GetTimestamp();
+
+    ThreadLogBuffer* buffer = GetThreadBuffer();
+    char* destination = Reserve(buffer, header.size);
+    if (destination)
+    {
+        memcpy(destination, &header, sizeof(header));
+        memcpy(destination + sizeof(header), tag, tagLength);
+        memcpy(destination + sizeof(header) + tagLength, text, length);
+        Commit(buffer);
+    }
+}
+
+uint32_t BinaryLogSystem::InternString(const char* str, bool compareText)
+{
+    if (!str)
+    {
+        str = "";
+    }
+
+    size_t index = HashPointer(str);
+    for (size_t probes = 0; probes < STRING_TABLE_SIZE; ++probes, index = (index + 1) & (STRING_TABLE_SIZE - 1))
+    {
+        const char* key = m_stringTable[index].key.load(std::memory_order_acquire);
+        if (!key)
+        {
+            break;
+        }
+        if (key == str)
+        {
+            uint32_t id = m_stringTable[index].id.load(std::memory_order_acquire);
+            //a tag's address may have been reused for other text since it was seen.
+            if (!compareText || strcmp(m_strings[id], str) == 0)
+            {
+                return id;
+            }
+            break;
+        }
+    }
+
+    std::lock_guard<std::mutex> locker(m_stringLock);
+    uint32_t id = m_stringCount.load(std::memory_order_relaxed);
+
+    index = HashPointer(str);
+    size_t probes = 0;
+    for (; probes < STRING_TABLE_SIZE; ++probes, index = (index + 1) & (STRING_TABLE_SIZE - 1))
+    {
+        const char* key = m_stringTable[index].key.load(std::memory_order_relaxed);
+        if (key == str)
+        {
+            uint32_t existing = m_stringTable[index].id.load(std::memory_order_relaxed);
+            if (!compareText || strcmp(m_strings[existing], str) == 0)
+            {
+                return existing;
+            }
+            break;
+        }
+        if (!key)
+        {
+            break;
+        }
+    }
+
+    if (id >= MAX_STRINGS || probes == STRING_TABLE_SIZE)
+    {
+        return 0;
+    }
+
+    Aws::Utils::Memory::HeapScope heapScope;
+    size_t length = strlen(str);
+    char* copy = static_cast<char*>(Aws::Malloc(AllocationTag, length + 1));
+    memcpy(copy, str, length + 1);
+    m_strings[id] = copy;
+    //tags get one too, in case the same literal is also used as a format string.
+    m_signatures[id] = CreateSignature(copy);
+    m_stringCount.store(id + 1, std::memory_order_release);
+
+    m_stringTable[index].id.store(id, std::memory_order_release);
+    m_stringTable[index].key.store(str, std::memory_order_release);
+    return id;
+}
+
+ThreadLogBuffer* BinaryLogSystem::GetThreadBuffer()
+{
+    if (s_threadBuffer.systemId == m_id)
+    {
+        return s_threadBuffer.buffer;
+    }
+
+    s_threadBuffer.Release();
+
+    Aws::Utils::Memory::HeapScope heapScope;
+    ThreadLogBuffer* buffer = Aws::New<ThreadLogBuffer>(AllocationTag);
+    buffer->capacity = m_threadBufferSize;
+    buffer->data = static_cast<char*>(Aws::Malloc(AllocationTag, m_threadBufferSize));
+    Aws::StringStream threadName;
+    threadName << std::this_thread::get_id();
+    buffer->threadName = threadName.str();
+
+    {
+        std::lock_guard<std::mutex> locker(m_bufferLock);
+        buffer->threadIndex = m_nextThreadIndex++;
+        buffer->next = m_buffers;
+        m_buffers = buffer;
+    }
+
+    s_threadBuffer.systemId = m_id;
+    s_threadBuffer.buffer = buffer;
+    return buffer;
+}
+
+void BinaryLogSystem::RetireThreadBuffer(ThreadLogBuffer* buffer)
+{
+    buffer->retired.store(true, std::memory_order_release);
+}
+
+char* BinaryLogSystem::Reserve(ThreadLogBuffer* buffer, size_t size)
+{
+    size_t head = buffer->head.load(std::memory_order_relaxed);
+    size_t offset = head & (buffer->capacity - 1);
+    size_t toEnd = buffer->capacity - offset;
+    //records don't wrap, the rest of the buffer is skipped instead.
+    size_t needed = toEnd < size ? toEnd + size : size;
+
+    if (head + needed - buffer->cachedTail > buffer->capacity)
+    {
+        buffer->cachedTail = buffer->tail.load(std::memory_order_acquire);
+        if (head + needed - buffer->cachedTail > buffer->capacity)
+        {
+            m_droppedMessages.fetch_add(1, std::memory_order_relaxed);
+            return nullptr;
+        }
+    }
+
+    if (toEnd < size)
+    {
+        RecordHeader padding;
+        padding.size = static_cast<uint32_t>(toEnd);
+        padding.kind = RECORD_PADDING;
+        padding.level = 0;
+        padding.inlineTagLength = 0;
+        memcpy(buffer->data + offset, &padding, PADDING_SIZE);
+        offset = 0;
+    }
+
+    buffer->pendingHead = head + needed;
+    return buffer->data + offset;
+}
+
+void BinaryLogSystem::Commit(ThreadLogBuffer* buffer)
+{
+    buffer->head.store(buffer->pendingHead, std::memory_order_release);
+
+    //a wake up lost to the race with the writer going to sleep only delays the write to the next flush interval.
+    if (buffer->pendingHead - buffer->cachedTail > buffer->capacity / 2 && !m_flushRequested.load(std::memory_order_relaxed))
+    {
+        m_flushRequested.store(true, std::memory_order_relaxed);
+        m_signal.notify_one();
+    }
+}
+
+void BinaryLogSystem::Flush()
+{
+    WriteBuffers();
+}
+
+void BinaryLogSystem::WriteBuffers()
+{
+    std::lock_guard<std::mutex> writeLocker(m_writeLock);
+
+    if (!m_filenamePrefix.empty())
+    {
+        // localtime requires access to env. variables to get Timezone, which is not thread-safe
+        int32_t currentHour = DateTime::Now().GetHour(false /*localtime*/);
+        if (currentHour != m_lastRolledHour)
+        {
+            m_logFile = MakeBinaryLogFile(m_filenamePrefix);
+            m_lastRolledHour = currentHour;
+            WriteFileHeader(*m_logFile);
+            //a new file has to define everything again.
+            m_writtenStringCount = 1;
+            std::lock_guard<std::mutex> locker(m_bufferLock);
+            for (ThreadLogBuffer* buffer = m_buffers; buffer; buffer = buffer->next)
+            {
+                buffer->announced = false;
+            }
+        }
+    }
+    Aws::OStream& log = *m_logFile;
+
+    bool wrote = false;
+    {
+        std::lock_guard<std::mutex> locker(m_bufferLock);
+        ThreadLogBuffer** link = &m_buffers;
+        while (*link)
+        {
+            ThreadLogBuffer* buffer = *link;
+            bool retired = buffer->retired.load(std::memory_order_acquire);
+            size_t head = buffer->head.load(std::memory_order_acquire);
+            size_t tail = buffer->tail.load(std::memory_order_relaxed);
+
+            if (head != tail)
+            {
+                //every string the records refer to was counted before they were committed.
+                uint32_t stringCount = m_stringCount.load(std::memory_order_acquire);
+                for (; m_writtenStringCount < stringCount; ++m_writtenStringCount)
+                {
+                    const char* str = m_strings[m_writtenStringCount];
+                    WriteEntry(log, ENTRY_STRING, &m_writtenStringCount, sizeof(uint32_t), str, strlen(str));
+                }
+
+                if (!buffer->announced)
+                {
+                    WriteEntry(log, ENTRY_THREAD, &buffer->threadIndex, sizeof(uint32_t), buffer->threadName.c_str(), buffer->threadName.size());
+                    buffer->announced = true;
+                }
+
+                //the records may wrap around the end of the buffer, one entry covers both parts.
+                size_t offset = tail & (buffer->capacity - 1);
+                size_t length = head - tail;
+                size_t firstPart = (std::min)(length, buffer->capacity - offset);
+                uint32_t recordsHeader[2] = { buffer->threadIndex, 0 };
+                EntryHeader entryHeader;
+                entryHeader.type = ENTRY_RECORDS;
+                entryHeader.length = static_cast<uint32_t>(sizeof(recordsHeader) + length);
+                log.write(reinterpret_cast<const char*>(&entryHeader), sizeof(entryHeader));
+                log.write(reinterpret_cast<const char*>(recordsHeader), sizeof(recordsHeader));
+                log.write(buffer->data + offset, firstPart);
+                log.write(buffer->data, length - firstPart);
+
+                buffer->tail.store(head, std::memory_order_release);
+                wrote = true;
+            }
+
+            if (retired)
+            {
+                *link = buffer->next;
+                Aws::Free(buffer->data);
+                Aws::Delete(buffer);
+            }
+            else
+            {
+                link = &buffer->next;
+            }
+        }
+    }
+
+    uint64_t dropped = m_droppedMessages.load(std::memory_order_relaxed);
+    if (dropped != m_reportedDroppedMessages)
+    {
+        uint64_t droppedEntry[2] = { dropped - m_reportedDroppedMessages, static_cast<uint64_t>(GetTimestamp()) };
+        WriteEntry(log, ENTRY_DROPPED, droppedEntry, sizeof(droppedEntry));
+        m_reportedDroppedMessages = dropped;
+        wrote = true;
+    }
+
+    if (wrote)
+    {
+        log.flush();
+    }
+}
+
+void BinaryLogSystem::LoggingThread()
+{
+    for (;;)
+    {
+        {
+            std::unique_lock<std::mutex> locker(m_signalLock);
+            m_signal.wait_for(locker, FLUSH_INTERVAL, [this]() { return m_stopLogging.load() || m_flushRequested.load(); });
+        }
+
+        if (m_stopLogging.load())
+        {
+            break;
+        }
+
+        m_flushRequested.store(false);
+        WriteBuffers();
+    }
+}
+
+static const char* GetLevelPrefix(uint8_t level)
+{
+    switch (static_cast<LogLevel>(level))
+    {
+        case LogLevel::Error: return "[ERROR] ";
+        case LogLevel::Fatal: return "[FATAL] ";
+        case LogLevel::Warn: return "[WARN] ";
+        case LogLevel::Info: return "[INFO] ";
+        case LogLevel::Debug: return "[DEBUG] ";
+        case LogLevel::Trace: return "[TRACE] ";
+        default: return "[UNKOWN] ";
+    }
+}
+
+static Aws::String FormatTimestamp(int64_t timestamp)
+{
+    return DateTime(timestamp / 1000000).ToGmtString("%Y-%m-%d %H:%M:%S");
+}
+
+static void AppendFormatted(Aws::String& line, const char* spec, ...)
+{
+    std::va_list args;
+    va_start(args, spec);
+
+    va_list tmp_args;
+    va_copy(tmp_args, args);
+    #ifdef WIN32
+        const int requiredLength = _vscprintf(spec, tmp_args) + 1;
+    #else
+        const int requiredLength = vsnprintf(nullptr, 0, spec, tmp_args) + 1;
+    #endif
+    va_end(tmp_args);
+
+    if (requiredLength > 0)
+    {
+        Array<char> outputBuff(requiredLength);
+        #ifdef WIN32
+            vsnprintf_s(outputBuff.GetUnderlyingData(), requiredLength, _TRUNCATE, spec, args);
+        #else
+            vsnprintf(outputBuff.GetUnderlyingData(), requiredLength, spec, args);
+        #endif // WIN32
+        line.append(outputBuff.GetUnderlyingData(), requiredLength - 1);
+    }
+
+    va_end(args);
+}
+
+//copies the text between conversions, turning %% back into %.
+static void AppendLiteral(Aws::String& line, const char* begin, const char* end)
+{
+    for (const char* c = begin; c < end; ++c)
+    {
+        line.push_back(*c);
+        if (*c == '%' && c + 1 < end && c[1] == '%')
+        {
+            ++c;
+        }
+    }
+}
+
+//formats a recorded event, returns false if its arguments run past the end of the record.
+static bool FormatEvent(Aws::String& line, const char* format, const char* arguments, const char* end)
+{
+    size_t cursor = 0;
+    size_t literalStart = 0;
+    Conversion conversion;
+    while (NextConversion(format, cursor, conversion))
+    {
+        AppendLiteral(line, format + literalStart, format + conversion.begin);
+        literalStart = conversion.end;
+
+        Aws::String spec(format + conversion.begin, format + conversion.end);
+        for (int i = 0; i < 2; ++i)
+        {
+            bool present = i == 0 ? conversion.widthArgument : conversion.precisionArgument;
+            if (!present)
+            {
+                continue;
+            }
+            if (end - arguments < static_cast<ptrdiff_t>(sizeof(int64_t)))
+            {
+                return false;
+            }
+            int64_t value;
+            memcpy(&value, arguments, sizeof(value));
+            arguments += sizeof(value);
+
+            size_t star = spec.find('*');
+            if (i == 1 && value < 0)
+            {
+                //a negative precision counts as none.
+                spec.erase(star - 1, 2);
+            }
+            else
+            {
+                spec.replace(star, 1, StringUtils::to_string(value));
+            }
+        }
+
+        if (conversion.type == ARG_STRING)
+        {
+            uint32_t length;
+            if (end - arguments < static_cast<ptrdiff_t>(sizeof(length)))
+            {
+                return false;
+            }
+            memcpy(&length, arguments, sizeof(length));
+            arguments += sizeof(length);
+            if (length == NULL_STRING)
+            {
+                AppendFormatted(line, spec.c_str(), "(null)");
+                continue;
+            }
+            if (end - arguments < static_cast<ptrdiff_t>(length))
+            {
+                return false;
+            }
+            Aws::String value(arguments, length);
+            arguments += length;
+            AppendFormatted(line, spec.c_str(), value.c_str());
+            continue;
+        }
+
+        uint64_t bits;
+        if (end - arguments < static_cast<ptrdiff_t>(sizeof(bits)))
+        {
+            return false;
+        }
+        memcpy(&bits, arguments, sizeof(bits));
+        arguments += sizeof(bits);
+        double floatingPoint;
+        memcpy(&floatingPoint, &bits, sizeof(floatingPoint));
+
+        switch (conversion.type)
+        {
+            case ARG_INT: AppendFormatted(line, spec.c_str(), static_cast<int>(bits)); break;
+            case ARG_UINT: AppendFormatted(line, spec.c_str(), static_cast<unsigned int>(bits)); break;
+            case ARG_LONG: AppendFormatted(line, spec.c_str(), static_cast<long>(bits)); break;
+            case ARG_ULONG: AppendFormatted(line, spec.c_str(), static_cast<unsigned long>(bits)); break;
+            case ARG_LONG_LONG: AppendFormatted(line, spec.c_str(), static_cast<long long>(bits)); break;
+            case ARG_ULONG_LONG: AppendFormatted(line, spec.c_str(), static_cast<unsigned long long>(bits)); break;
+            case ARG_SIZE: AppendFormatted(line, spec.c_str(), static_cast<size_t>(bits)); break;
+            case ARG_PTRDIFF: AppendFormatted(line, spec.c_str(), static_cast<ptrdiff_t>(bits)); break;
+            case ARG_INTMAX: AppendFormatted(line, spec.c_str(), static_cast<intmax_t>(bits)); break;
+            case ARG_UINTMAX: AppendFormatted(line, spec.c_str(), static_cast<uintmax_t>(bits)); break;
+            case ARG_DOUBLE: AppendFormatted(line, spec.c_str(), floatingPoint); break;
+            case ARG_LONG_DOUBLE: AppendFormatted(line, spec.c_str(), static_cast<long double>(floatingPoint)); break;
+            case ARG_POINTER: AppendFormatted(line, spec.c_str(), reinterpret_cast<void*>(static_cast<uintptr_t>(bits))); break;
+            default: break;
+        }
+    }
+
+    AppendLiteral(line, format + literalStart, format + strlen(format));
+    return true;
+}
+
+//reads length bytes into payload as they arrive, so a corrupt length fails at the end of the log instead of allocating
+//whatever it claims.
+static bool ReadPayload(Aws::IStream& input, uint32_t length, Aws::Vector<char>& payload)
+{
+    const size_t READ_SIZE = 64 * 1024;
+    payload.clear();
+    while (payload.size() < length)
+    {
+        size_t offset = payload.size();
+        size_t count = (std::min)(static_cast<size_t>(length) - offset, READ_SIZE);
+        payload.resize(offset + count);
+        if (!input.read(payload.data() + offset, static_cast<std::streamsize>(count)))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool BinaryLogDecoder::Decode(Aws::IStream& input, Aws::OStream& output)
+{
+    FileHeader fileHeader;
+    if (!input.read(reinterpret_cast<char*>(&fileHeader), sizeof(fileHeader)) ||
+        memcmp(fileHeader.magic, FILE_MAGIC, sizeof(FILE_MAGIC)) != 0 || fileHeader.byteOrderMark != BYTE_ORDER_MARK)
+    {
+        return false;
+    }
+
+    Aws::Map<uint32_t, Aws::String> strings;
+    Aws::Map<uint32_t, Aws::String> threads;
+    Aws::Vector<char> payload;
+
+    EntryHeader entryHeader;
+    while (input.read(reinterpret_cast<char*>(&entryHeader), sizeof(entryHeader)))
+    {
+        if (!ReadPayload(input, entryHeader.length, payload))
+        {
+            return false;
+        }
+        const char* data = payload.data();
+        const char* end = data + payload.size();
+
+        switch (entryHeader.type)
+        {
+            case ENTRY_STRING:
+            case ENTRY_THREAD:
+            {
+                uint32_t id;
+                if (payload.size() < sizeof(id))
+                {
+                    return false;
+                }
+                memcpy(&id, data, sizeof(id));
+                Aws::String text(data + sizeof(id), end);
+                (entryHeader.type == ENTRY_STRING ? strings : threads)[id] = text;
+                break;
+            }
+            case ENTRY_DROPPED:
+            {
+                uint64_t dropped[2];
+                if (payload.size() < sizeof(dropped))
+                {
+                    return false;
+                }
+                memcpy(dropped, data, sizeof(dropped));
+                output << "[WARN] " << FormatTimestamp(static_cast<int64_t>(dropped[1])) << " " << AllocationTag << " "
+                    << StringUtils::to_string(dropped[0]) << " log messages were dropped because a thread's log buffer was full.\n";
+                break;
+            }
+            case ENTRY_RECORDS:
+            {
+                uint32_t recordsHeader[2];
+                if (payload.size() < sizeof(recordsHeader))
+                {
+                    return false;
+                }
+                memcpy(recordsHeader, data, sizeof(recordsHeader));
+                const Aws::String& threadName = threads[recordsHeader[0]];
+
+                const char* record = data + sizeof(recordsHeader);
+                while (record < end)
+                {
+                    RecordHeader header;
+                    if (end - record < static_cast<ptrdiff_t>(PADDING_SIZE))
+                    {
+                        return false;
+                    }
+                    memcpy(&header, record, PADDING_SIZE);
+                    if (header.size < PADDING_SIZE || end - record < static_cast<ptrdiff_t>(header.size))
+                    {
+                        return false;
+                    }
+                    if (header.kind == RECORD_PADDING)
+                    {
+                        record += header.size;
+                        continue;
+                    }
+                    if (header.size < sizeof(RecordHeader))
+                    {
+                        return false;
+                    }
+                    memcpy(&header, record, sizeof(RecordHeader));
+                    const char* body = record + sizeof(RecordHeader);
+                    const char* recordEnd = record + header.size;
+                    record = recordEnd;
+
+                    Aws::String tag;
+                    if (header.tagId)
+                    {
+                        tag = strings[header.tagId];
+                    }
+                    else
+                    {
+                        if (recordEnd - body < static_cast<ptrdiff_t>(header.inlineTagLength))
+                        {
+                            return false;
+                        }
+                        tag.assign(body, header.inlineTagLength);
+                        body += header.inlineTagLength;
+                    }
+
+                    Aws::String line(GetLevelPrefix(header.level));
+                    line += FormatTimestamp(header.timestamp);
+                    line += " ";
+                    line += tag;
+                    line += " [";
+                    line += threadName;
+                    line += "] ";
+
+                    if (header.kind == RECORD_TEXT)
+                    {
+                        if (recordEnd - body < static_cast<ptrdiff_t>(header.formatId))
+                        {
+                            return false;
+                        }
+                        line.append(body, header.formatId);
+                    }
+                    else if (!FormatEvent(line, strings[header.formatId].c_str(), body, recordEnd))
+                    {
+                        return false;
+                    }
+
+                    line += "\n";
+                    output << line;
+                }
+                break;
+            }
+            default:
+                //entries added by later versions are skipped.
+                break;
+        }
+    }
+
+    //anything left over after the last complete entry means the log was cut short.
+    return input.eof() && input.gcount() == 0;
+}
@@ -0,0 +1,406 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/core/utils/logging/RingBufferLogSystem.h>
+
+#include <aws/core/utils/DateTime.h>
+#include <aws/core/utils/StringUtils.h>
+#include <aws/core/utils/memory/AWSMemory.h>
+
+#include <chrono>
+#include <fstream>
+
+#ifndef _WIN32
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/uio.h>
+#include <unistd.h>
+#endif
+
+using namespace Aws::Utils;
+using namespace Aws::Utils::Logging;
+
+static const char* AllocationTag = "RingBufferLogSystem";
+static const size_t BATCH_SIZE = 256;
+static const std::chrono::milliseconds FLUSH_INTERVAL(100);
+
+static Aws::String MakeLogFileName(const Aws::String& filenamePrefix)
+{
+    return filenamePrefix + DateTime::CalculateGmtTimestampAsString("%Y-%m-%d-%H") + ".log";
+}
+
+namespace Aws
+{
+    namespace Utils
+    {
+        namespace Logging
+        {
+            struct RingBufferLogSystem::Slot
+            {
+                std::atomic<size_t> sequence;
+                Aws::String message;
+            };
+
+            /**
+             * Where the logging thread writes its batches to.
+             */
+            class RingBufferLogSink
+            {
+            public:
+                virtual ~RingBufferLogSink() = default;
+                virtual void Write(const Aws::String* messages, size_t count) = 0;
+            };
+
+        } // namespace Logging
+    } // namespace Utils
+} // namespace Aws
+
+namespace
+{
+    //streams have no gather write, a batch is joined and written at once.
+    class StreamLogSink : public RingBufferLogSink
+    {
+    public:
+        StreamLogSink(const std::shared_ptr<Aws::OStream>& stream) : m_stream(stream) {}
+
+        void Write(const Aws::String* messages, size_t count) override
+        {
+            size_t totalSize = 0;
+            for (size_t i = 0; i < count; ++i)
+            {
+                totalSize += messages[i].size();
+            }
+
+            m_joined.clear();
+            m_joined.reserve(totalSize);
+            for (size_t i = 0; i < count; ++i)
+            {
+                m_joined.append(messages[i]);
+            }
+
+            m_stream->write(m_joined.data(), static_cast<std::streamsize>(m_joined.size()));
+            m_stream->flush();
+        }
+
+    private:
+        std::shared_ptr<Aws::OStream> m_stream;
+        Aws::String m_joined;
+    };
+
+    //rolls to a new file every hour like DefaultLogSystem.
+    class FileLogSink : public RingBufferLogSink
+    {
+    public:
+        FileLogSink(const Aws::String& filenamePrefix) :
+            m_filenamePrefix(filenamePrefix),
+            // localtime requires access to env. variables to get Timezone, which is not thread-safe
+            m_lastRolledHour(DateTime::Now().GetHour(false /*localtime*/))
+        {
+            Open();
+        }
+
+        ~FileLogSink()
+        {
+            Close();
+        }
+
+        void Write(const Aws::String* messages, size_t count) override
+        {
+            int32_t currentHour = DateTime::Now().GetHour(false /*localtime*/);
+            if (currentHour != m_lastRolledHour)
+            {
+                Close();
+                Open();
+                m_lastRolledHour = currentHour;
+            }
+
+#ifndef _WIN32
+            if (m_fd < 0)
+            {
+                return;
+            }
+
+            struct iovec vectors[BATCH_SIZE];
+            size_t vectorCount = 0;
+            for (size_t i = 0; i < count && vectorCount < BATCH_SIZE; ++i)
+            {
+                if (!messages[i].empty())
+                {
+                    vectors[vectorCount].iov_base = const_cast<char*>(messages[i].data());
+                    vectors[vectorCount].iov_len = messages[i].size();
+                    ++vectorCount;
+                }
+            }
+
+            struct iovec* next = vectors;
+            while (vectorCount > 0)
+            {
+                ssize_t written = writev(m_fd, next, static_cast<int>(vectorCount));
+                if (written < 0)
+                {
+                    if (errno == EINTR)
+                    {
+                        continue;
+                    }
+                    return;
+                }
+
+                //skip what a short write got out, then carry on with the rest.
+                size_t remaining = static_cast<size_t>(written);
+                while (vectorCount > 0 && remaining >= next->iov_len)
+                {
+                    remaining -= next->iov_len;
+                    ++next;
+                    --vectorCount;
+                }
+                if (vectorCount > 0)
+                {
+                    next->iov_base = static_cast<char*>(next->iov_base) + remaining;
+                    next->iov_len -= remaining;
+                }
+            }
+#else
+            m_streamSink->Write(messages, count);
+#endif
+        }
+
+    private:
+        void Open()
+        {
+            Aws::String fileName = MakeLogFileName(m_filenamePrefix);
+#ifndef _WIN32
+            m_fd = open(fileName.c_str(), O_WRONLY | O_CREAT | O_APPEND, 0644);
+#else
+            m_streamSink.reset(Aws::New<StreamLogSink>(AllocationTag,
+                Aws::MakeShared<Aws::OFStream>(AllocationTag, fileName.c_str(), Aws::OFStream::out | Aws::OFStream::app)));
+#endif
+        }
+
+        void Close()
+        {
+#ifndef _WIN32
+            if (m_fd >= 0)
+            {
+                close(m_fd);
+            }
+            m_fd = -1;
+#else
+            m_streamSink.reset();
+#endif
+        }
+
+        Aws::String m_filenamePrefix;
+        int32_t m_lastRolledHour;
+#ifndef _WIN32
+        int m_fd;
+#else
+        Aws::UniquePtr<StreamLogSink> m_streamSink;
+#endif
+    };
+}
+
+RingBufferLogSystem::RingBufferLogSystem(LogLevel logLevel, const std::shared_ptr<Aws::OStream>& logFile, size_t capacity, LogOverflowPolicy policy) :
+    Base(logLevel),
+    m_sink(Aws::New<StreamLogSink>(AllocationTag, logFile)),
+    m_policy(policy),
+    m_slots(nullptr),
+    m_mask(0),
+    m_enqueuePosition(0),
+    m_dequeuePosition(0),
+    m_droppedMessages(0),
+    m_reportedDroppedMessages(0),
+    m_blockedProducers(0),
+    m_stopLogging(false)
+{
+    Start(capacity);
+}
+
+RingBufferLogSystem::RingBufferLogSystem(LogLevel logLevel, const Aws::String& filenamePrefix, size_t capacity, LogOverflowPolicy policy) :
+    Base(logLevel),
+    m_sink(Aws::New<FileLogSink>(AllocationTag, filenamePrefix)),
+    m_policy(policy),
+    m_slots(nullptr),
+    m_mask(0),
+    m_enqueuePosition(0),
+    m_dequeuePosition(0),
+    m_droppedMessages(0),
+    m_reportedDroppedMessages(0),
+    m_blockedProducers(0),
+    m_stopLogging(false)
+{
+    Start(capacity);
+}
+
+RingBufferLogSystem::~RingBufferLogSystem()
+{
+    {
+        std::lock_guard<std::mutex> locker(m_signalLock);
+        m_stopLogging.store(true);
+    }
+    m_dataSignal.notify_one();
+    m_loggingThread.join();
+
+    Aws::DeleteArray(m_slots);
+    Aws::Delete(m_sink);
+}
+
+void RingBufferLogSystem::Start(size_t capacity)
+{
+    size_t slotCount = 2;
+    while (slotCount < capacity)
+    {
+        slotCount <<= 1;
+    }
+
+    m_slots = Aws::NewArray<Slot>(slotCount, AllocationTag);
+    for (size_t i = 0; i < slotCount; ++i)
+    {
+        m_slots[i].sequence.store(i, std::memory_order_relaxed);
+    }
+    m_mask = slotCount - 1;
+
+    m_loggingThread = std::thread(&RingBufferLogSystem::LoggingThread, this);
+}
+
+void RingBufferLogSystem::ProcessFormattedStatement(Aws::String&& statement)
+{
+    while (!TryPush(statement))
+    {
+        if (m_policy == LogOverflowPolicy::Drop || m_stopLogging.load(std::memory_order_relaxed))
+        {
+            m_droppedMessages.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+
+        std::unique_lock<std::mutex> locker(m_signalLock);
+        m_blockedProducers.fetch_add(1, std::memory_order_relaxed);
+        m_dataSignal.notify_one();
+        //the timeout covers a wakeup the logging thread sent just before this thread started waiting.
+        m_spaceSignal.wait_for(locker, FLUSH_INTERVAL);
+        m_blockedProducers.fetch_sub(1, std::memory_order_relaxed);
+    }
+}
+
+bool RingBufferLogSystem::TryPush(Aws::String& statement)
+{
+    size_t position = m_enqueuePosition.load(std::memory_order_relaxed);
+    Slot* slot = nullptr;
+    for (;;)
+    {
+        slot = &m_slots[position & m_mask];
+        size_t sequence = slot->sequence.load(std::memory_order_acquire);
+        intptr_t difference = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position);
+        if (difference == 0)
+        {
+            if (m_enqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+            {
+                break;
+            }
+        }
+        else if (difference < 0)
+        {
+            //the logging thread has not taken the message one lap ahead yet, the queue is full.
+            return false;
+        }
+        else
+        {
+            position = m_enqueuePosition.load(std::memory_order_relaxed);
+        }
+    }
+
+    slot->message = std::move(statement);
+    slot->sequence.store(position + 1, std::memory_order_release);
+
+    //wake the logging thread early once a batch is ready, otherwise it comes around every FLUSH_INTERVAL. The lock
+    //keeps the wakeup from landing between its check for a full batch and its wait.
+    if (((position + 1) & (BATCH_SIZE - 1)) == 0)
+    {
+        std::lock_guard<std::mutex> locker(m_signalLock);
+        m_dataSignal.notify_one();
+    }
+    return true;
+}
+
+size_t RingBufferLogSystem::DrainBatch()
+{
+    Aws::String batch[BATCH_SIZE];
+    size_t count = 0;
+    while (count < BATCH_SIZE)
+    {
+        Slot& slot = m_slots[m_dequeuePosition & m_mask];
+        if (slot.sequence.load(std::memory_order_acquire) != m_dequeuePosition + 1)
+        {
+            break;
+        }
+
+        batch[count++] = std::move(slot.message);
+        slot.sequence.store(m_dequeuePosition + m_mask + 1, std::memory_order_release);
+        ++m_dequeuePosition;
+    }
+
+    uint64_t dropped = m_droppedMessages.load(std::memory_order_relaxed);
+    if (dropped != m_reportedDroppedMessages && count < BATCH_SIZE)
+    {
+        batch[count++] = "[WARN] " + DateTime::CalculateGmtTimestampAsString("%Y-%m-%d %H:%M:%S") + " " + AllocationTag + " "
+            + StringUtils::to_string(dropped - m_reportedDroppedMessages) + " log messages were dropped because the log queue was full.\n";
+        m_reportedDroppedMessages = dropped;
+    }
+
+    if (count > 0)
+    {
+        m_sink->Write(batch, count);
+    }
+
+    if (m_blockedProducers.load(std::memory_order_relaxed) > 0)
+    {
+        std::lock_guard<std::mutex> locker(m_signalLock);
+        m_spaceSignal.notify_all();
+    }
+    return count;
+}
+
+void RingBufferLogSystem::LoggingThread()
+{
+    for (;;)
+    {
+        if (DrainBatch() > 0)
+        {
+            continue;
+        }
+
+        if (m_stopLogging.load())
+        {
+            //anything queued while the stop was being requested.
+            while (DrainBatch() > 0)
+            {
+            }
+            break;
+        }
+
+        //a message that is claimed but not yet published holds up the ones queued behind it, let its thread finish.
+        if (m_enqueuePosition.load(std::memory_order_relaxed) != m_dequeuePosition)
+        {
+            std::this_thread::yield();
+            continue;
+        }
+
+        std::unique_lock<std::mutex> locker(m_signalLock);
+        m_dataSignal.wait_for(locker, FLUSH_INTERVAL, [this]()
+        {
+            return m_stopLogging.load() || m_blockedProducers.load(std::memory_order_relaxed) > 0 ||
+                m_enqueuePosition.load(std::memory_order_relaxed) - m_dequeuePosition >= BATCH_SIZE;
+        });
+    }
+}
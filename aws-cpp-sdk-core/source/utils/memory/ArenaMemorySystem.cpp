@@ -0,0 +1,371 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/core/utils/memory/ArenaMemorySystem.h>
+
+#include <cassert>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+
+#if defined(_MSC_VER) && _MSC_VER < 1900
+#define AWS_ARENA_THREAD_LOCAL __declspec(thread)
+#else
+#define AWS_ARENA_THREAD_LOCAL thread_local
+#endif
+
+using namespace Aws::Utils::Memory;
+
+//arena allocations are aligned like malloc's on every platform we build for.
+static const std::size_t ARENA_ALIGNMENT = 16;
+static const std::size_t MIN_BLOCK_SHIFT = 10;
+
+static std::atomic<ArenaMemorySystem*> s_installedSystem(nullptr);
+static AWS_ARENA_THREAD_LOCAL Arena* s_currentArena = nullptr;
+
+namespace Aws
+{
+    namespace Utils
+    {
+        namespace Memory
+        {
+            /**
+             * Bump allocator over a chain of slab blocks. Only the thread that opened its scope allocates from it,
+             * any thread may free into it.
+             */
+            class Arena
+            {
+            public:
+                Arena(ArenaMemorySystem* system) :
+                    m_system(system), m_firstBlock(nullptr), m_extraBlocks(nullptr), m_extraBlockCount(0),
+                    m_cursor(nullptr), m_limit(nullptr), m_references(0), m_nextFree(nullptr)
+                {
+                }
+
+                void* Allocate(std::size_t size)
+                {
+                    size = (size + ARENA_ALIGNMENT - 1) & ~(ARENA_ALIGNMENT - 1);
+                    if (static_cast<std::size_t>(m_limit - m_cursor) < size && !AddBlock())
+                    {
+                        return nullptr;
+                    }
+
+                    void* memory = m_cursor;
+                    m_cursor += size;
+                    m_references.fetch_add(1, std::memory_order_relaxed);
+                    return memory;
+                }
+
+                void AddReference()
+                {
+                    m_references.fetch_add(1, std::memory_order_relaxed);
+                }
+
+                void Release()
+                {
+                    if (m_references.fetch_sub(1, std::memory_order_acq_rel) == 1)
+                    {
+                        m_system->RecycleArena(this);
+                    }
+                }
+
+                //gives back every block but the first and rewinds to its start.
+                void Reset()
+                {
+                    for (std::size_t i = 0; i < m_extraBlockCount; ++i)
+                    {
+                        m_system->ReleaseBlock(m_extraBlocks[i]);
+                    }
+                    m_extraBlockCount = 0;
+                    m_cursor = m_firstBlock;
+                    m_limit = m_firstBlock ? m_firstBlock + BlockSize() : nullptr;
+                }
+
+                inline ArenaMemorySystem* GetSystem() const { return m_system; }
+                inline Arena* NextFree() const { return m_nextFree; }
+                inline void SetNextFree(Arena* next) { m_nextFree = next; }
+                inline void SetExtraBlockStorage(char** storage) { m_extraBlocks = storage; }
+
+            private:
+                inline std::size_t BlockSize() const { return static_cast<std::size_t>(1) << m_system->m_blockShift; }
+
+                bool AddBlock()
+                {
+                    char* block = m_system->AcquireBlock(this);
+                    if (!block)
+                    {
+                        return false;
+                    }
+
+                    if (!m_firstBlock)
+                    {
+                        m_firstBlock = block;
+                    }
+                    else
+                    {
+                        m_extraBlocks[m_extraBlockCount++] = block;
+                    }
+                    m_cursor = block;
+                    m_limit = block + BlockSize();
+                    return true;
+                }
+
+                ArenaMemorySystem* m_system;
+                char* m_firstBlock;
+                //sized for every block in the slab, an arena can never hold more.
+                char** m_extraBlocks;
+                std::size_t m_extraBlockCount;
+                char* m_cursor;
+                char* m_limit;
+                std::atomic<std::size_t> m_references;
+                Arena* m_nextFree;
+            };
+
+        } // namespace Memory
+    } // namespace Utils
+} // namespace Aws
+
+ArenaMemorySystem::ArenaMemorySystem(std::size_t blockSize, std::size_t blockCount, MemorySystemInterface* underlying) :
+    m_underlying(underlying),
+    m_blockShift(MIN_BLOCK_SHIFT),
+    m_blockCount(blockCount),
+    m_slabAllocation(nullptr),
+    m_slabBegin(nullptr),
+    m_slabEnd(nullptr),
+    m_blockOwners(nullptr),
+    m_freeBlocks(nullptr),
+    m_freeBlockCount(0),
+    m_freeArenas(nullptr),
+    m_arenaAllocations(0),
+    m_liveArenas(0)
+{
+    while ((static_cast<std::size_t>(1) << m_blockShift) < blockSize)
+    {
+        ++m_blockShift;
+    }
+
+    std::size_t alignedBlockSize = static_cast<std::size_t>(1) << m_blockShift;
+    m_slabAllocation = AllocateFromHeap(alignedBlockSize * (m_blockCount + 1), 1, nullptr);
+    m_blockOwners = static_cast<std::atomic<Arena*>*>(AllocateFromHeap(sizeof(std::atomic<Arena*>) * m_blockCount, 1, nullptr));
+    m_freeBlocks = static_cast<std::size_t*>(AllocateFromHeap(sizeof(std::size_t) * m_blockCount, 1, nullptr));
+    if (!m_slabAllocation || !m_blockOwners || !m_freeBlocks)
+    {
+        //everything goes to the heap.
+        m_blockCount = 0;
+        return;
+    }
+
+    std::uintptr_t slabAddress = reinterpret_cast<std::uintptr_t>(m_slabAllocation);
+    slabAddress = (slabAddress + alignedBlockSize - 1) & ~(static_cast<std::uintptr_t>(alignedBlockSize) - 1);
+    m_slabBegin = reinterpret_cast<char*>(slabAddress);
+    m_slabEnd = m_slabBegin + alignedBlockSize * m_blockCount;
+
+    for (std::size_t i = 0; i < m_blockCount; ++i)
+    {
+        new (&m_blockOwners[i]) std::atomic<Arena*>(nullptr);
+        //hand out low blocks first.
+        m_freeBlocks[i] = m_blockCount - 1 - i;
+    }
+    m_freeBlockCount = m_blockCount;
+}
+
+ArenaMemorySystem::~ArenaMemorySystem()
+{
+    assert(m_liveArenas.load() == 0);
+
+    while (m_freeArenas)
+    {
+        Arena* arena = m_freeArenas;
+        m_freeArenas = arena->NextFree();
+        arena->~Arena();
+        FreeToHeap(arena);
+    }
+
+    FreeToHeap(m_freeBlocks);
+    FreeToHeap(m_blockOwners);
+    FreeToHeap(m_slabAllocation);
+}
+
+void ArenaMemorySystem::Begin()
+{
+    if (m_underlying)
+    {
+        m_underlying->Begin();
+    }
+    s_installedSystem.store(this, std::memory_order_release);
+}
+
+void ArenaMemorySystem::End()
+{
+    ArenaMemorySystem* expected = this;
+    s_installedSystem.compare_exchange_strong(expected, nullptr, std::memory_order_acq_rel);
+    if (m_underlying)
+    {
+        m_underlying->End();
+    }
+}
+
+void* ArenaMemorySystem::AllocateMemory(std::size_t blockSize, std::size_t alignment, const char* allocationTag)
+{
+    Arena* arena = s_currentArena;
+    if (arena && arena->GetSystem() == this && alignment <= ARENA_ALIGNMENT
+        && blockSize <= (static_cast<std::size_t>(1) << m_blockShift) / 4)
+    {
+        void* memory = arena->Allocate(blockSize);
+        if (memory)
+        {
+            m_arenaAllocations.fetch_add(1, std::memory_order_relaxed);
+            return memory;
+        }
+    }
+
+    return AllocateFromHeap(blockSize, alignment, allocationTag);
+}
+
+void ArenaMemorySystem::FreeMemory(void* memoryPtr)
+{
+    char* memory = static_cast<char*>(memoryPtr);
+    if (memory >= m_slabBegin && memory < m_slabEnd)
+    {
+        std::size_t blockIndex = static_cast<std::size_t>(memory - m_slabBegin) >> m_blockShift;
+        m_blockOwners[blockIndex].load(std::memory_order_relaxed)->Release();
+        return;
+    }
+
+    FreeToHeap(memoryPtr);
+}
+
+ArenaMemorySystem* ArenaMemorySystem::GetInstalledSystem()
+{
+    return s_installedSystem.load(std::memory_order_acquire);
+}
+
+Arena* ArenaMemorySystem::AcquireArena()
+{
+    Arena* arena = nullptr;
+    {
+        std::lock_guard<std::mutex> locker(m_poolLock);
+        arena = m_freeArenas;
+        if (arena)
+        {
+            m_freeArenas = arena->NextFree();
+        }
+    }
+
+    if (!arena)
+    {
+        void* memory = AllocateFromHeap(sizeof(Arena) + sizeof(char*) * m_blockCount, 1, nullptr);
+        if (!memory)
+        {
+            return nullptr;
+        }
+        arena = new (memory) Arena(this);
+        arena->SetExtraBlockStorage(reinterpret_cast<char**>(static_cast<char*>(memory) + sizeof(Arena)));
+    }
+
+    //the scope's own reference.
+    arena->AddReference();
+    m_liveArenas.fetch_add(1, std::memory_order_relaxed);
+    return arena;
+}
+
+void ArenaMemorySystem::RecycleArena(Arena* arena)
+{
+    arena->Reset();
+    m_liveArenas.fetch_sub(1, std::memory_order_relaxed);
+
+    std::lock_guard<std::mutex> locker(m_poolLock);
+    arena->SetNextFree(m_freeArenas);
+    m_freeArenas = arena;
+}
+
+char* ArenaMemorySystem::AcquireBlock(Arena* owner)
+{
+    std::size_t blockIndex = 0;
+    {
+        std::lock_guard<std::mutex> locker(m_poolLock);
+        if (m_freeBlockCount == 0)
+        {
+            return nullptr;
+        }
+        blockIndex = m_freeBlocks[--m_freeBlockCount];
+    }
+
+    m_blockOwners[blockIndex].store(owner, std::memory_order_relaxed);
+    return m_slabBegin + (blockIndex << m_blockShift);
+}
+
+void ArenaMemorySystem::ReleaseBlock(char* block)
+{
+    std::size_t blockIndex = static_cast<std::size_t>(block - m_slabBegin) >> m_blockShift;
+    m_blockOwners[blockIndex].store(nullptr, std::memory_order_relaxed);
+
+    std::lock_guard<std::mutex> locker(m_poolLock);
+    m_freeBlocks[m_freeBlockCount++] = blockIndex;
+}
+
+void* ArenaMemorySystem::AllocateFromHeap(std::size_t blockSize, std::size_t alignment, const char* allocationTag)
+{
+    if (m_underlying)
+    {
+        return m_underlying->AllocateMemory(blockSize, alignment, allocationTag);
+    }
+    return malloc(blockSize);
+}
+
+void ArenaMemorySystem::FreeToHeap(void* memoryPtr)
+{
+    if (!memoryPtr)
+    {
+        return;
+    }
+
+    if (m_underlying)
+    {
+        m_underlying->FreeMemory(memoryPtr);
+    }
+    else
+    {
+        free(memoryPtr);
+    }
+}
+
+ArenaScope::ArenaScope() :
+    m_arena(nullptr),
+    m_previous(s_currentArena)
+{
+    ArenaMemorySystem* system = ArenaMemorySystem::GetInstalledSystem();
+    if (system)
+    {
+        m_arena = system->AcquireArena();
+    }
+    s_currentArena = m_arena;
+}
+
+ArenaScope::ArenaScope(Arena* arena) :
+    m_arena(arena),
+    m_previous(s_currentArena)
+{
+    s_currentArena = m_arena;
+}
+
+ArenaScope::~ArenaScope()
+{
+    s_currentArena = m_previous;
+    if (m_arena)
+    {
+        m_arena->Release();
+    }
+}
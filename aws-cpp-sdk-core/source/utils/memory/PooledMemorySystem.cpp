@@ -0,0 +1,466 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/core/utils/memory/PooledMemorySystem.h>
+
+#include <cstdlib>
+#include <new>
+#include <stddef.h>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+//without thread_local there is no hook for thread exit, caches of exited threads are then never reused.
+#if defined(_MSC_VER) && _MSC_VER < 1900
+#define AWS_POOLED_THREAD_LOCAL __declspec(thread)
+#else
+#define AWS_POOLED_THREAD_LOCAL thread_local
+#define AWS_POOLED_THREAD_EXIT_HOOK 1
+#endif
+
+using namespace Aws::Utils::Memory;
+
+namespace
+{
+    struct BlockHeader
+    {
+        ThreadCache* owner;
+        std::size_t sizeClass;
+    };
+
+    //keeps the memory handed out aligned like malloc's.
+    const std::size_t HEADER_SIZE = (sizeof(BlockHeader) + alignof(max_align_t) - 1) / alignof(max_align_t) * alignof(max_align_t);
+
+    //16 byte steps up to 128, then four classes per power of two.
+    const std::size_t CLASS_SIZES[] =
+    {
+        16, 32, 48, 64, 80, 96, 112, 128,
+        160, 192, 224, 256,
+        320, 384, 448, 512,
+        640, 768, 896, 1024,
+        1280, 1536, 1792, 2048,
+        2560, 3072, 3584, 4096
+    };
+    const std::size_t CLASS_COUNT = sizeof(CLASS_SIZES) / sizeof(CLASS_SIZES[0]);
+
+    //index of the highest set bit of value, which must not be 0.
+    inline unsigned HighestBit(uint32_t value)
+    {
+#if defined(_MSC_VER)
+        unsigned long index;
+        _BitScanReverse(&index, value);
+        return static_cast<unsigned>(index);
+#elif defined(__GNUC__) || defined(__clang__)
+        return 31u - static_cast<unsigned>(__builtin_clz(value));
+#else
+        unsigned index = 0;
+        while (value >>= 1)
+        {
+            ++index;
+        }
+        return index;
+#endif
+    }
+
+    //size must not exceed MAX_POOLED_SIZE.
+    inline std::size_t GetSizeClass(std::size_t size)
+    {
+        if (size <= 128)
+        {
+            return size == 0 ? 0 : (size + 15) / 16 - 1;
+        }
+
+        uint32_t last = static_cast<uint32_t>(size - 1);
+        unsigned shift = HighestBit(last);
+        return 8 + (shift - 7) * 4 + ((last >> (shift - 2)) & 3);
+    }
+
+    inline void*& NextBlock(void* block)
+    {
+        return *reinterpret_cast<void**>(static_cast<char*>(block) + HEADER_SIZE);
+    }
+
+    inline BlockHeader* GetHeader(void* block)
+    {
+        return static_cast<BlockHeader*>(block);
+    }
+
+    //the calling thread's cache, read on every allocation and free. Kept trivially destructible so that reading it
+    //needs no initialization check; ThreadCacheHolder only adds the thread exit hook.
+    struct ThreadCacheSlot
+    {
+        uint64_t systemId;
+        ThreadCache* cache;
+    };
+
+    std::atomic<uint64_t> s_nextSystemId(1);
+    std::mutex s_liveSystemsLock;
+    PooledMemorySystem* s_liveSystems = nullptr;
+}
+
+namespace Aws
+{
+    namespace Utils
+    {
+        namespace Memory
+        {
+            struct ThreadCache
+            {
+                ThreadCache() : chunkCursor(nullptr), chunkLimit(nullptr), nextCache(nullptr), nextRetired(nullptr), remoteFrees(nullptr)
+                {
+                    for (std::size_t i = 0; i < CLASS_COUNT; ++i)
+                    {
+                        freeLists[i] = nullptr;
+                    }
+                }
+
+                //blocks freed by other threads move to the free lists the next time one of them runs dry.
+                void DrainRemoteFrees()
+                {
+                    void* block = remoteFrees.exchange(nullptr, std::memory_order_acquire);
+                    while (block)
+                    {
+                        void* next = NextBlock(block);
+                        void*& head = freeLists[GetHeader(block)->sizeClass];
+                        NextBlock(block) = head;
+                        head = block;
+                        block = next;
+                    }
+                }
+
+                void PushRemoteFree(void* block)
+                {
+                    void* head = remoteFrees.load(std::memory_order_relaxed);
+                    do
+                    {
+                        NextBlock(block) = head;
+                    } while (!remoteFrees.compare_exchange_weak(head, block, std::memory_order_release, std::memory_order_relaxed));
+                }
+
+                void* freeLists[CLASS_COUNT];
+                char* chunkCursor;
+                char* chunkLimit;
+                ThreadCache* nextCache;
+                ThreadCache* nextRetired;
+
+                //written by other threads, kept off the owner's cache lines.
+                char padding[64];
+                std::atomic<void*> remoteFrees;
+            };
+
+        } // namespace Memory
+    } // namespace Utils
+} // namespace Aws
+
+static AWS_POOLED_THREAD_LOCAL ThreadCacheSlot s_threadCache;
+
+namespace Aws
+{
+    namespace Utils
+    {
+        namespace Memory
+        {
+            class ThreadCacheHolder
+            {
+            public:
+#ifdef AWS_POOLED_THREAD_EXIT_HOOK
+                ~ThreadCacheHolder()
+                {
+                    Release();
+                }
+#endif
+
+                //gives this thread's cache back to its memory system, if that still exists.
+                static void Release()
+                {
+                    if (!s_threadCache.cache)
+                    {
+                        return;
+                    }
+
+                    std::lock_guard<std::mutex> locker(s_liveSystemsLock);
+                    for (PooledMemorySystem* system = s_liveSystems; system; system = system->m_nextLive)
+                    {
+                        if (system->m_id == s_threadCache.systemId)
+                        {
+                            system->RetireThreadCache(s_threadCache.cache);
+                            break;
+                        }
+                    }
+                    s_threadCache.cache = nullptr;
+                    s_threadCache.systemId = 0;
+                }
+
+                bool registered;
+            };
+
+        } // namespace Memory
+    } // namespace Utils
+} // namespace Aws
+
+static AWS_POOLED_THREAD_LOCAL ThreadCacheHolder s_threadCacheHolder;
+
+PooledMemorySystem::PooledMemorySystem(std::size_t chunkSize, MemorySystemInterface* underlying) :
+    m_underlying(underlying),
+    m_chunkSize(chunkSize < MAX_POOLED_SIZE * 4 ? MAX_POOLED_SIZE * 4 : chunkSize),
+    m_id(s_nextSystemId.fetch_add(1, std::memory_order_relaxed)),
+    m_allCaches(nullptr),
+    m_retiredCaches(nullptr),
+    m_chunks(nullptr),
+    m_chunkBytes(0),
+    m_threadCacheCount(0),
+    m_nextLive(nullptr)
+{
+    std::lock_guard<std::mutex> locker(s_liveSystemsLock);
+    m_nextLive = s_liveSystems;
+    s_liveSystems = this;
+}
+
+PooledMemorySystem::~PooledMemorySystem()
+{
+    {
+        std::lock_guard<std::mutex> locker(s_liveSystemsLock);
+        PooledMemorySystem** link = &s_liveSystems;
+        while (*link != this)
+        {
+            link = &(*link)->m_nextLive;
+        }
+        *link = m_nextLive;
+    }
+
+    if (s_threadCache.systemId == m_id)
+    {
+        s_threadCache.cache = nullptr;
+        s_threadCache.systemId = 0;
+    }
+
+    while (m_allCaches)
+    {
+        ThreadCache* cache = m_allCaches;
+        m_allCaches = cache->nextCache;
+        cache->~ThreadCache();
+        FreeToHeap(cache);
+    }
+
+    while (m_chunks)
+    {
+        void* chunk = m_chunks;
+        m_chunks = *static_cast<void**>(chunk);
+        FreeToHeap(chunk);
+    }
+}
+
+void PooledMemorySystem::Begin()
+{
+    if (m_underlying)
+    {
+        m_underlying->Begin();
+    }
+}
+
+void PooledMemorySystem::End()
+{
+    if (m_underlying)
+    {
+        m_underlying->End();
+    }
+}
+
+void* PooledMemorySystem::AllocateMemory(std::size_t blockSize, std::size_t alignment, const char* allocationTag)
+{
+    ThreadCache* cache = nullptr;
+    if (blockSize <= MAX_POOLED_SIZE)
+    {
+        cache = s_threadCache.systemId == m_id ? s_threadCache.cache : GetThreadCache();
+    }
+    if (cache)
+    {
+        std::size_t sizeClass = GetSizeClass(blockSize);
+        void* block = cache->freeLists[sizeClass];
+        if (!block)
+        {
+            cache->DrainRemoteFrees();
+            block = cache->freeLists[sizeClass];
+        }
+
+        if (block)
+        {
+            cache->freeLists[sizeClass] = NextBlock(block);
+            return static_cast<char*>(block) + HEADER_SIZE;
+        }
+
+        std::size_t carveSize = HEADER_SIZE + CLASS_SIZES[sizeClass];
+        if (static_cast<std::size_t>(cache->chunkLimit - cache->chunkCursor) >= carveSize || RefillChunk(cache, carveSize))
+        {
+            block = cache->chunkCursor;
+            cache->chunkCursor += carveSize;
+            //blocks belong to the cache that carved them for good, their header never changes.
+            GetHeader(block)->owner = cache;
+            GetHeader(block)->sizeClass = sizeClass;
+            return static_cast<char*>(block) + HEADER_SIZE;
+        }
+    }
+
+    char* rawMemory = static_cast<char*>(AllocateFromHeap(blockSize + HEADER_SIZE, alignment, allocationTag));
+    if (!rawMemory)
+    {
+        return nullptr;
+    }
+    GetHeader(rawMemory)->owner = nullptr;
+    GetHeader(rawMemory)->sizeClass = 0;
+    return rawMemory + HEADER_SIZE;
+}
+
+void PooledMemorySystem::FreeMemory(void* memoryPtr)
+{
+    if (!memoryPtr)
+    {
+        return;
+    }
+
+    void* block = static_cast<char*>(memoryPtr) - HEADER_SIZE;
+    ThreadCache* owner = GetHeader(block)->owner;
+    if (!owner)
+    {
+        FreeToHeap(block);
+        return;
+    }
+
+    if (owner == s_threadCache.cache && s_threadCache.systemId == m_id)
+    {
+        void*& head = owner->freeLists[GetHeader(block)->sizeClass];
+        NextBlock(block) = head;
+        head = block;
+        return;
+    }
+
+    owner->PushRemoteFree(block);
+}
+
+ThreadCache* PooledMemorySystem::GetThreadCache()
+{
+    if (s_threadCache.systemId == m_id)
+    {
+        return s_threadCache.cache;
+    }
+
+    //this thread last used another pooled memory system.
+    ThreadCacheHolder::Release();
+    s_threadCacheHolder.registered = true;
+
+    ThreadCache* cache = AcquireThreadCache();
+    if (cache)
+    {
+        s_threadCache.cache = cache;
+        s_threadCache.systemId = m_id;
+    }
+    return cache;
+}
+
+ThreadCache* PooledMemorySystem::AcquireThreadCache()
+{
+    {
+        std::lock_guard<std::mutex> locker(m_cacheLock);
+        if (m_retiredCaches)
+        {
+            ThreadCache* cache = m_retiredCaches;
+            m_retiredCaches = cache->nextRetired;
+            cache->nextRetired = nullptr;
+            return cache;
+        }
+    }
+
+    void* memory = AllocateFromHeap(sizeof(ThreadCache), alignof(ThreadCache), nullptr);
+    if (!memory)
+    {
+        return nullptr;
+    }
+
+    ThreadCache* cache = new (memory) ThreadCache();
+    m_threadCacheCount.fetch_add(1, std::memory_order_relaxed);
+
+    std::lock_guard<std::mutex> locker(m_cacheLock);
+    cache->nextCache = m_allCaches;
+    m_allCaches = cache;
+    return cache;
+}
+
+void PooledMemorySystem::RetireThreadCache(ThreadCache* cache)
+{
+    std::lock_guard<std::mutex> locker(m_cacheLock);
+    cache->nextRetired = m_retiredCaches;
+    m_retiredCaches = cache;
+}
+
+bool PooledMemorySystem::RefillChunk(ThreadCache* cache, std::size_t blockSize)
+{
+    //the first slot of every chunk links it into m_chunks.
+    char* chunk = static_cast<char*>(AllocateFromHeap(m_chunkSize, alignof(max_align_t), nullptr));
+    if (!chunk)
+    {
+        return false;
+    }
+
+    {
+        std::lock_guard<std::mutex> locker(m_cacheLock);
+        *reinterpret_cast<void**>(chunk) = m_chunks;
+        m_chunks = chunk;
+    }
+    m_chunkBytes.fetch_add(m_chunkSize, std::memory_order_relaxed);
+
+    //what is left of the previous chunk is too small for this class, give it to the smaller ones.
+    while (cache->chunkCursor && static_cast<std::size_t>(cache->chunkLimit - cache->chunkCursor) >= HEADER_SIZE + CLASS_SIZES[0])
+    {
+        std::size_t remaining = static_cast<std::size_t>(cache->chunkLimit - cache->chunkCursor) - HEADER_SIZE;
+        std::size_t sizeClass = GetSizeClass(remaining);
+        if (CLASS_SIZES[sizeClass] > remaining)
+        {
+            --sizeClass;
+        }
+
+        void* block = cache->chunkCursor;
+        cache->chunkCursor += HEADER_SIZE + CLASS_SIZES[sizeClass];
+        GetHeader(block)->owner = cache;
+        GetHeader(block)->sizeClass = sizeClass;
+        NextBlock(block) = cache->freeLists[sizeClass];
+        cache->freeLists[sizeClass] = block;
+    }
+
+    cache->chunkCursor = chunk + HEADER_SIZE;
+    cache->chunkLimit = chunk + m_chunkSize;
+    return static_cast<std::size_t>(cache->chunkLimit - cache->chunkCursor) >= blockSize;
+}
+
+void* PooledMemorySystem::AllocateFromHeap(std::size_t blockSize, std::size_t alignment, const char* allocationTag)
+{
+    if (m_underlying)
+    {
+        return m_underlying->AllocateMemory(blockSize, alignment, allocationTag);
+    }
+    return malloc(blockSize);
+}
+
+void PooledMemorySystem::FreeToHeap(void* memoryPtr)
+{
+    if (m_underlying)
+    {
+        m_underlying->FreeMemory(memoryPtr);
+    }
+    else
+    {
+        free(memoryPtr);
+    }
+}
@@ -0,0 +1,400 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/core/utils/memory/TagProfilingMemorySystem.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <new>
+#include <ostream>
+#include <stddef.h>
+
+#if defined(_MSC_VER) && _MSC_VER < 1900
+#define AWS_PROFILER_THREAD_LOCAL __declspec(thread)
+#define AWS_PROFILER_CACHE_LINE_ALIGNED __declspec(align(64))
+#else
+#define AWS_PROFILER_THREAD_LOCAL thread_local
+#define AWS_PROFILER_CACHE_LINE_ALIGNED alignas(64)
+#endif
+
+using namespace Aws::Utils::Memory;
+
+static const std::size_t STRIPE_COUNT = 8;
+static const std::size_t MAX_TAG_LENGTH = 63;
+static const std::size_t UNTAGGED_INDEX = 0;
+static const std::size_t OVERFLOW_INDEX = 1;
+static const std::size_t RESERVED_TAG_COUNT = 2;
+
+namespace
+{
+    struct AllocationHeader
+    {
+        std::size_t size;
+        std::size_t tagIndex;
+    };
+
+    //keeps the memory handed out aligned like malloc's.
+    const std::size_t HEADER_SIZE = (sizeof(AllocationHeader) + alignof(max_align_t) - 1) / alignof(max_align_t) * alignof(max_align_t);
+
+    std::atomic<unsigned> s_nextStripe(0);
+    AWS_PROFILER_THREAD_LOCAL unsigned s_threadStripe = 0;
+    AWS_PROFILER_THREAD_LOCAL bool s_threadStripeAssigned = false;
+
+    inline std::size_t GetThreadStripe()
+    {
+        if (!s_threadStripeAssigned)
+        {
+            s_threadStripe = s_nextStripe.fetch_add(1, std::memory_order_relaxed) % STRIPE_COUNT;
+            s_threadStripeAssigned = true;
+        }
+        return s_threadStripe;
+    }
+
+    inline std::size_t HashTag(const char* allocationTag)
+    {
+        return static_cast<std::size_t>((reinterpret_cast<std::uintptr_t>(allocationTag) >> 3) * 0x9E3779B1u);
+    }
+}
+
+namespace Aws
+{
+    namespace Utils
+    {
+        namespace Memory
+        {
+            //each stripe starts its own cache line and fills it, so threads on different stripes do not share one.
+            struct AWS_PROFILER_CACHE_LINE_ALIGNED TagProfilingMemorySystem::TagStripe
+            {
+                TagStripe() : allocations(0), frees(0), allocatedBytes(0), freedBytes(0) {}
+
+                std::atomic<uint64_t> allocations;
+                std::atomic<uint64_t> frees;
+                std::atomic<uint64_t> allocatedBytes;
+                std::atomic<uint64_t> freedBytes;
+            };
+
+            struct TagProfilingMemorySystem::TagRecord
+            {
+                TagRecord() : liveBytes(0), peakBytes(0)
+                {
+                    name[0] = '\0';
+                }
+
+                char name[MAX_TAG_LENGTH + 1];
+                TagStripe stripes[STRIPE_COUNT];
+                std::atomic<std::size_t> liveBytes;
+                std::atomic<std::size_t> peakBytes;
+            };
+
+            struct TagProfilingMemorySystem::TagLookupEntry
+            {
+                TagLookupEntry() : key(nullptr), tagIndex(0) {}
+
+                std::atomic<const char*> key;
+                std::size_t tagIndex;
+            };
+
+        } // namespace Memory
+    } // namespace Utils
+} // namespace Aws
+
+TagProfilingMemorySystem::TagProfilingMemorySystem(std::size_t tagCapacity, MemorySystemInterface* underlying) :
+    m_underlying(underlying),
+    m_tagCapacity(tagCapacity + RESERVED_TAG_COUNT),
+    m_tagsAllocation(nullptr),
+    m_tags(nullptr),
+    m_tagCount(RESERVED_TAG_COUNT),
+    m_lookup(nullptr),
+    m_lookupMask(0)
+{
+    //several translation units may define the same tag, leave room for that.
+    std::size_t lookupSize = 16;
+    while (lookupSize < m_tagCapacity * 8)
+    {
+        lookupSize <<= 1;
+    }
+    m_lookupMask = lookupSize - 1;
+
+    static_assert(sizeof(TagStripe) == 64 && alignof(TagStripe) == 64, "stripes must each fill one cache line");
+
+    //the heap only guarantees malloc's alignment, round the records up to their cache line alignment by hand.
+    m_tagsAllocation = AllocateFromHeap(sizeof(TagRecord) * m_tagCapacity + alignof(TagRecord) - 1, alignof(TagRecord), nullptr);
+    std::uintptr_t tagsAddress = reinterpret_cast<std::uintptr_t>(m_tagsAllocation);
+    m_tags = reinterpret_cast<TagRecord*>((tagsAddress + alignof(TagRecord) - 1) & ~static_cast<std::uintptr_t>(alignof(TagRecord) - 1));
+    m_lookup = static_cast<TagLookupEntry*>(AllocateFromHeap(sizeof(TagLookupEntry) * lookupSize, alignof(TagLookupEntry), nullptr));
+    if (!m_tagsAllocation || !m_lookup)
+    {
+        std::abort();
+    }
+
+    for (std::size_t i = 0; i < m_tagCapacity; ++i)
+    {
+        new (&m_tags[i]) TagRecord();
+    }
+    for (std::size_t i = 0; i < lookupSize; ++i)
+    {
+        new (&m_lookup[i]) TagLookupEntry();
+    }
+
+    strcpy(m_tags[UNTAGGED_INDEX].name, "(untagged)");
+    strcpy(m_tags[OVERFLOW_INDEX].name, "(overflow)");
+}
+
+TagProfilingMemorySystem::~TagProfilingMemorySystem()
+{
+    FreeToHeap(m_lookup);
+    FreeToHeap(m_tagsAllocation);
+}
+
+void TagProfilingMemorySystem::Begin()
+{
+    if (m_underlying)
+    {
+        m_underlying->Begin();
+    }
+}
+
+void TagProfilingMemorySystem::End()
+{
+    if (m_underlying)
+    {
+        m_underlying->End();
+    }
+}
+
+void* TagProfilingMemorySystem::AllocateMemory(std::size_t blockSize, std::size_t alignment, const char* allocationTag)
+{
+    char* rawMemory = static_cast<char*>(AllocateFromHeap(blockSize + HEADER_SIZE, alignment, allocationTag));
+    if (!rawMemory)
+    {
+        return nullptr;
+    }
+
+    std::size_t tagIndex = FindTag(allocationTag);
+    AllocationHeader* header = reinterpret_cast<AllocationHeader*>(rawMemory);
+    header->size = blockSize;
+    header->tagIndex = tagIndex;
+
+    TagRecord& record = m_tags[tagIndex];
+    TagStripe& stripe = record.stripes[GetThreadStripe()];
+    stripe.allocations.fetch_add(1, std::memory_order_relaxed);
+    stripe.allocatedBytes.fetch_add(blockSize, std::memory_order_relaxed);
+
+    std::size_t liveBytes = record.liveBytes.fetch_add(blockSize, std::memory_order_relaxed) + blockSize;
+    std::size_t peakBytes = record.peakBytes.load(std::memory_order_relaxed);
+    while (liveBytes > peakBytes && !record.peakBytes.compare_exchange_weak(peakBytes, liveBytes, std::memory_order_relaxed))
+    {
+    }
+
+    return rawMemory + HEADER_SIZE;
+}
+
+void TagProfilingMemorySystem::FreeMemory(void* memoryPtr)
+{
+    if (!memoryPtr)
+    {
+        return;
+    }
+
+    char* rawMemory = static_cast<char*>(memoryPtr) - HEADER_SIZE;
+    const AllocationHeader* header = reinterpret_cast<const AllocationHeader*>(rawMemory);
+
+    TagRecord& record = m_tags[header->tagIndex];
+    TagStripe& stripe = record.stripes[GetThreadStripe()];
+    stripe.frees.fetch_add(1, std::memory_order_relaxed);
+    stripe.freedBytes.fetch_add(header->size, std::memory_order_relaxed);
+    record.liveBytes.fetch_sub(header->size, std::memory_order_relaxed);
+
+    FreeToHeap(rawMemory);
+}
+
+Aws::Vector<TagAllocationStatistics> TagProfilingMemorySystem::GetSnapshot() const
+{
+    Aws::Vector<TagAllocationStatistics> snapshot;
+    std::size_t tagCount = m_tagCount.load(std::memory_order_acquire);
+    snapshot.reserve(tagCount);
+
+    for (std::size_t i = 0; i < tagCount; ++i)
+    {
+        const TagRecord& record = m_tags[i];
+        uint64_t allocations = 0;
+        uint64_t frees = 0;
+        uint64_t allocatedBytes = 0;
+        for (const auto& stripe : record.stripes)
+        {
+            allocations += stripe.allocations.load(std::memory_order_relaxed);
+            frees += stripe.frees.load(std::memory_order_relaxed);
+            allocatedBytes += stripe.allocatedBytes.load(std::memory_order_relaxed);
+        }
+
+        if (allocations == 0)
+        {
+            continue;
+        }
+
+        TagAllocationStatistics statistics;
+        statistics.tag = record.name;
+        statistics.liveBytes = record.liveBytes.load(std::memory_order_relaxed);
+        statistics.peakBytes = (std::max)(statistics.liveBytes, record.peakBytes.load(std::memory_order_relaxed));
+        //a free can be counted before the allocation it belongs to on another stripe.
+        statistics.liveAllocations = allocations > frees ? allocations - frees : 0;
+        statistics.totalAllocations = allocations;
+        statistics.totalBytes = allocatedBytes;
+        snapshot.push_back(std::move(statistics));
+    }
+
+    std::sort(snapshot.begin(), snapshot.end(), [](const TagAllocationStatistics& lhs, const TagAllocationStatistics& rhs)
+    {
+        return lhs.liveBytes != rhs.liveBytes ? lhs.liveBytes > rhs.liveBytes : lhs.tag < rhs.tag;
+    });
+    return snapshot;
+}
+
+void TagProfilingMemorySystem::Dump(Aws::OStream& out) const
+{
+    Aws::Vector<TagAllocationStatistics> snapshot = GetSnapshot();
+
+    out << std::left << std::setw(40) << "Tag" << std::right
+        << std::setw(16) << "LiveBytes" << std::setw(16) << "LiveAllocs" << std::setw(16) << "PeakBytes"
+        << std::setw(16) << "TotalAllocs" << std::setw(16) << "TotalBytes" << "\n";
+
+    TagAllocationStatistics totals;
+    totals.tag = "Total";
+    totals.liveBytes = totals.peakBytes = 0;
+    totals.liveAllocations = totals.totalAllocations = totals.totalBytes = 0;
+
+    for (const auto& statistics : snapshot)
+    {
+        out << std::left << std::setw(40) << statistics.tag << std::right
+            << std::setw(16) << statistics.liveBytes << std::setw(16) << statistics.liveAllocations << std::setw(16) << statistics.peakBytes
+            << std::setw(16) << statistics.totalAllocations << std::setw(16) << statistics.totalBytes << "\n";
+
+        totals.liveBytes += statistics.liveBytes;
+        totals.liveAllocations += statistics.liveAllocations;
+        totals.totalAllocations += statistics.totalAllocations;
+        totals.totalBytes += statistics.totalBytes;
+    }
+
+    //per tag peaks are reached at different times, there is no meaningful total.
+    out << std::left << std::setw(40) << totals.tag << std::right
+        << std::setw(16) << totals.liveBytes << std::setw(16) << totals.liveAllocations << std::setw(16) << "-"
+        << std::setw(16) << totals.totalAllocations << std::setw(16) << totals.totalBytes << "\n";
+}
+
+std::size_t TagProfilingMemorySystem::FindTag(const char* allocationTag)
+{
+    if (!allocationTag)
+    {
+        return UNTAGGED_INDEX;
+    }
+
+    std::size_t hash = HashTag(allocationTag);
+    for (std::size_t probe = 0; probe <= m_lookupMask; ++probe)
+    {
+        const TagLookupEntry& entry = m_lookup[(hash + probe) & m_lookupMask];
+        const char* key = entry.key.load(std::memory_order_acquire);
+        if (key == allocationTag)
+        {
+            return entry.tagIndex;
+        }
+        if (!key)
+        {
+            break;
+        }
+    }
+
+    return AddTag(allocationTag);
+}
+
+std::size_t TagProfilingMemorySystem::AddTag(const char* allocationTag)
+{
+    std::lock_guard<std::mutex> locker(m_tagLock);
+
+    std::size_t hash = HashTag(allocationTag);
+    TagLookupEntry* freeEntry = nullptr;
+    std::size_t usedEntries = 0;
+    for (std::size_t probe = 0; probe <= m_lookupMask; ++probe)
+    {
+        TagLookupEntry& entry = m_lookup[(hash + probe) & m_lookupMask];
+        const char* key = entry.key.load(std::memory_order_relaxed);
+        if (key == allocationTag)
+        {
+            //another thread got here first.
+            return entry.tagIndex;
+        }
+        if (!key)
+        {
+            freeEntry = &entry;
+            break;
+        }
+        ++usedEntries;
+    }
+
+    std::size_t tagCount = m_tagCount.load(std::memory_order_relaxed);
+    std::size_t tagIndex = OVERFLOW_INDEX;
+    for (std::size_t i = RESERVED_TAG_COUNT; i < tagCount; ++i)
+    {
+        if (strncmp(m_tags[i].name, allocationTag, MAX_TAG_LENGTH) == 0)
+        {
+            tagIndex = i;
+            break;
+        }
+    }
+
+    if (tagIndex == OVERFLOW_INDEX && tagCount < m_tagCapacity)
+    {
+        tagIndex = tagCount;
+        strncpy(m_tags[tagIndex].name, allocationTag, MAX_TAG_LENGTH);
+        m_tags[tagIndex].name[MAX_TAG_LENGTH] = '\0';
+        m_tagCount.store(tagCount + 1, std::memory_order_release);
+    }
+
+    //a run this long means the table is close to full, those tags take this path every time instead.
+    if (freeEntry && usedEntries < m_lookupMask / 4)
+    {
+        freeEntry->tagIndex = tagIndex;
+        freeEntry->key.store(allocationTag, std::memory_order_release);
+    }
+
+    return tagIndex;
+}
+
+void* TagProfilingMemorySystem::AllocateFromHeap(std::size_t blockSize, std::size_t alignment, const char* allocationTag)
+{
+    if (m_underlying)
+    {
+        return m_underlying->AllocateMemory(blockSize, alignment, allocationTag);
+    }
+    return malloc(blockSize);
+}
+
+void TagProfilingMemorySystem::FreeToHeap(void* memoryPtr)
+{
+    if (!memoryPtr)
+    {
+        return;
+    }
+
+    if (m_underlying)
+    {
+        m_underlying->FreeMemory(memoryPtr);
+    }
+    else
+    {
+        free(memoryPtr);
+    }
+}
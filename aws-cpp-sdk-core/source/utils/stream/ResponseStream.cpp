@@ -15,9 +15,10 @@
 
 #include <aws/core/utils/stream/ResponseStream.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/SimpleStreamBuf.h>
+#include <aws/core/utils/BufferPool.h>
 
 #if defined(_GLIBCXX_FULLY_DYNAMIC_STRING) && _GLIBCXX_FULLY_DYNAMIC_STRING == 0 && defined(__ANDROID__)
-#include <aws/core/utils/stream/SimpleStreamBuf.h>
 using DefaultStreamBufType = Aws::Utils::Stream::SimpleStreamBuf;
 #else
 using DefaultStreamBufType = Aws::StringBuf;
@@ -77,8 +78,18 @@ void ResponseStream::ReleaseStream()
 
 static const char *DEFAULT_STREAM_TAG = "DefaultUnderlyingStream";
 
+static std::streambuf* CreateDefaultStreamBuf()
+{
+    //SimpleStreamBuf grows through the buffer pool.
+    if (Aws::Utils::GetBufferPool())
+    {
+        return Aws::New<Aws::Utils::Stream::SimpleStreamBuf>(DEFAULT_STREAM_TAG);
+    }
+    return Aws::New<DefaultStreamBufType>(DEFAULT_STREAM_TAG);
+}
+
 DefaultUnderlyingStream::DefaultUnderlyingStream() :
-    Base( Aws::New< DefaultStreamBufType >( DEFAULT_STREAM_TAG ) )
+    Base( CreateDefaultStreamBuf() )
 {}
 
 DefaultUnderlyingStream::DefaultUnderlyingStream(Aws::UniquePtr<std::streambuf> buf) :
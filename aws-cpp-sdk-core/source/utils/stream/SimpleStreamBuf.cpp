@@ -15,6 +15,7 @@
 */
 
 #include <aws/core/utils/stream/SimpleStreamBuf.h>
+#include <aws/core/utils/BufferPool.h>
 
 #include <algorithm>
 #include <cassert>
@@ -28,14 +29,12 @@ namespace Stream
 {
 
 static const uint32_t DEFAULT_BUFFER_SIZE = 100;
-static const char* SIMPLE_STREAMBUF_ALLOCATION_TAG = "SimpleStreamBufTag";
 
 SimpleStreamBuf::SimpleStreamBuf() :
     m_buffer(nullptr),
     m_bufferSize(0)
 {
-    m_buffer = Aws::NewArray<char>(DEFAULT_BUFFER_SIZE, SIMPLE_STREAMBUF_ALLOCATION_TAG);
-    m_bufferSize = DEFAULT_BUFFER_SIZE;
+    m_buffer = Aws::Utils::AcquireBuffer(DEFAULT_BUFFER_SIZE, m_bufferSize);
 
     char* begin = m_buffer;
     char* end = begin + m_bufferSize;
@@ -50,8 +49,7 @@ SimpleStreamBuf::SimpleStreamBuf(const Aws::String& value) :
 {
     size_t baseSize = (std::max)(value.size(), static_cast<std::size_t>(DEFAULT_BUFFER_SIZE));
 
-    m_buffer = Aws::NewArray<char>(baseSize, SIMPLE_STREAMBUF_ALLOCATION_TAG);
-    m_bufferSize = baseSize;
+    m_buffer = Aws::Utils::AcquireBuffer(baseSize, m_bufferSize);
 
     std::memcpy(m_buffer, value.c_str(), value.size());
 
@@ -64,12 +62,8 @@ SimpleStreamBuf::SimpleStreamBuf(const Aws::String& value) :
 
 SimpleStreamBuf::~SimpleStreamBuf()
 {
-    if(m_buffer)
-    {
-        Aws::DeleteArray<char>(m_buffer);
-        m_buffer = nullptr;
-    }
-
+    Aws::Utils::ReleaseBuffer(m_buffer, m_bufferSize);
+    m_buffer = nullptr;
     m_bufferSize = 0;
 }
 
@@ -123,9 +117,9 @@ std::streampos SimpleStreamBuf::seekpos(std::streampos pos, std::ios_base::openm
 bool SimpleStreamBuf::GrowBuffer()
 {
     size_t currentSize = m_bufferSize;
-    size_t newSize = currentSize * 2;
+    size_t newSize = 0;
 
-    char* newBuffer = Aws::NewArray<char>(newSize, SIMPLE_STREAMBUF_ALLOCATION_TAG);
+    char* newBuffer = Aws::Utils::AcquireBuffer(currentSize * 2, newSize);
     if(newBuffer == nullptr)
     {
         return false;
@@ -136,10 +130,7 @@ bool SimpleStreamBuf::GrowBuffer()
         std::memcpy(newBuffer, m_buffer, currentSize);
     }
 
-    if(m_buffer)
-    {
-        Aws::DeleteArray<char>(m_buffer);
-    }
+    Aws::Utils::ReleaseBuffer(m_buffer, currentSize);
 
     m_buffer = newBuffer;
     m_bufferSize = newSize;
@@ -0,0 +1,671 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/core/utils/xml/XmlReader.h>
+
+#include <algorithm>
+#include <cstring>
+#include <istream>
+
+using namespace Aws::Utils::Xml;
+
+static const size_t XML_READER_CHUNK_SIZE = 8192;
+static const size_t MAX_ENTITY_LENGTH = 12;
+
+static inline bool IsXmlSpace(char c)
+{
+    return c == ' ' || c == '\t' || c == '\r' || c == '\n';
+}
+
+static void AppendUtf8(unsigned long codePoint, Aws::String& out)
+{
+    if (codePoint < 0x80)
+    {
+        out.push_back(static_cast<char>(codePoint));
+    }
+    else if (codePoint < 0x800)
+    {
+        out.push_back(static_cast<char>(0xC0 | (codePoint >> 6)));
+        out.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+    }
+    else if (codePoint < 0x10000)
+    {
+        out.push_back(static_cast<char>(0xE0 | (codePoint >> 12)));
+        out.push_back(static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F)));
+        out.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+    }
+    else
+    {
+        out.push_back(static_cast<char>(0xF0 | (codePoint >> 18)));
+        out.push_back(static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F)));
+        out.push_back(static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F)));
+        out.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+    }
+}
+
+// name points just past the '&', length excludes the trailing ';'
+static bool DecodeEntity(const char* name, size_t length, Aws::String& out)
+{
+    if (length == 2 && name[0] == 'l' && name[1] == 't')
+    {
+        out.push_back('<');
+        return true;
+    }
+    if (length == 2 && name[0] == 'g' && name[1] == 't')
+    {
+        out.push_back('>');
+        return true;
+    }
+    if (length == 3 && strncmp(name, "amp", 3) == 0)
+    {
+        out.push_back('&');
+        return true;
+    }
+    if (length == 4 && strncmp(name, "quot", 4) == 0)
+    {
+        out.push_back('"');
+        return true;
+    }
+    if (length == 4 && strncmp(name, "apos", 4) == 0)
+    {
+        out.push_back('\'');
+        return true;
+    }
+
+    if (length < 2 || name[0] != '#')
+    {
+        return false;
+    }
+
+    bool isHex = name[1] == 'x' || name[1] == 'X';
+    size_t i = isHex ? 2 : 1;
+    if (i == length)
+    {
+        return false;
+    }
+
+    unsigned long codePoint = 0;
+    for (; i < length; ++i)
+    {
+        char c = name[i];
+        unsigned digit = 0;
+        if (c >= '0' && c <= '9')
+        {
+            digit = static_cast<unsigned>(c - '0');
+        }
+        else if (isHex && c >= 'a' && c <= 'f')
+        {
+            digit = static_cast<unsigned>(c - 'a' + 10);
+        }
+        else if (isHex && c >= 'A' && c <= 'F')
+        {
+            digit = static_cast<unsigned>(c - 'A' + 10);
+        }
+        else
+        {
+            return false;
+        }
+
+        codePoint = codePoint * (isHex ? 16 : 10) + digit;
+        if (codePoint > 0x10FFFF)
+        {
+            return false;
+        }
+    }
+
+    AppendUtf8(codePoint, out);
+    return true;
+}
+
+// Decodes entities and normalizes line endings the same way tinyxml2 does for XmlDocument.
+static void DecodeText(const char* text, size_t length, Aws::String& out)
+{
+    out.reserve(out.size() + length);
+    for (size_t i = 0; i < length; ++i)
+    {
+        char c = text[i];
+        if (c == '&')
+        {
+            const char* semicolon = static_cast<const char*>(memchr(text + i, ';', (std::min)(length - i, MAX_ENTITY_LENGTH)));
+            if (semicolon)
+            {
+                size_t entityLength = static_cast<size_t>(semicolon - (text + i));
+                if (DecodeEntity(text + i + 1, entityLength - 1, out))
+                {
+                    i += entityLength;
+                    continue;
+                }
+            }
+            out.push_back(c);
+        }
+        else if (c == '\r')
+        {
+            out.push_back('\n');
+            if (i + 1 < length && text[i + 1] == '\n')
+            {
+                ++i;
+            }
+        }
+        else
+        {
+            out.push_back(c);
+        }
+    }
+}
+
+XmlReader::XmlReader(Aws::IStream& stream) :
+    m_stream(stream),
+    m_position(0),
+    m_endOfStream(false),
+    m_tokenType(XmlTokenType::None),
+    m_depth(0),
+    m_isEmptyElement(false),
+    m_pendingEndElement(false),
+    m_seenRootElement(false),
+    m_skipText(false)
+{
+}
+
+bool XmlReader::Read()
+{
+    if (!m_errorMessage.empty() || m_tokenType == XmlTokenType::EndOfDocument)
+    {
+        return false;
+    }
+
+    if (m_pendingEndElement)
+    {
+        m_pendingEndElement = false;
+        m_openElements.pop_back();
+        m_depth = m_openElements.size();
+        m_isEmptyElement = false;
+        m_attributes.clear();
+        m_tokenType = XmlTokenType::EndElement;
+        return true;
+    }
+
+    for (;;)
+    {
+        if (!EnsureAvailable(1))
+        {
+            if (!m_openElements.empty())
+            {
+                return SetError("Unexpected end of document, element was not closed.");
+            }
+            return SetEndOfDocument();
+        }
+
+        if (m_buffer[m_position] != '<')
+        {
+            if (ReadText())
+            {
+                return true;
+            }
+            if (!m_errorMessage.empty())
+            {
+                return false;
+            }
+            continue;
+        }
+
+        if (StartsWith("<?"))
+        {
+            if (!SkipUntil("?>"))
+            {
+                return false;
+            }
+        }
+        else if (StartsWith("<!--"))
+        {
+            if (!SkipUntil("-->"))
+            {
+                return false;
+            }
+        }
+        else if (StartsWith("<![CDATA["))
+        {
+            static const size_t cdataStartLength = sizeof("<![CDATA[") - 1;
+            size_t end = Find("]]>", cdataStartLength);
+            if (end == Aws::String::npos)
+            {
+                return SetError("Unterminated CDATA section.");
+            }
+            if (m_openElements.empty())
+            {
+                return SetError("Text found outside of the root element.");
+            }
+
+            m_value.assign(m_buffer, m_position + cdataStartLength, end - cdataStartLength);
+            m_position += end + 3;
+            m_depth = m_openElements.size();
+            m_tokenType = XmlTokenType::Text;
+            return true;
+        }
+        else if (StartsWith("<!"))
+        {
+            size_t end = FindTagEnd();
+            if (end == Aws::String::npos)
+            {
+                return SetError("Unterminated declaration.");
+            }
+            m_position += end + 1;
+        }
+        else if (StartsWith("</"))
+        {
+            return ReadEndElement();
+        }
+        else
+        {
+            return ReadStartElement();
+        }
+    }
+}
+
+Aws::String XmlReader::GetAttributeValue(const Aws::String& name) const
+{
+    for (const auto& attribute : m_attributes)
+    {
+        if (attribute.first == name)
+        {
+            return attribute.second;
+        }
+    }
+
+    return "";
+}
+
+bool XmlReader::ReadToRootElement()
+{
+    while (Read())
+    {
+        if (m_tokenType == XmlTokenType::StartElement)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool XmlReader::ReadChildElement(size_t parentDepth)
+{
+    while (Read())
+    {
+        if (m_tokenType == XmlTokenType::StartElement && m_depth == parentDepth + 1)
+        {
+            return true;
+        }
+        if (m_tokenType == XmlTokenType::EndElement && m_depth == parentDepth)
+        {
+            return false;
+        }
+    }
+
+    return false;
+}
+
+Aws::String XmlReader::ReadElementText()
+{
+    Aws::String text;
+    if (m_tokenType != XmlTokenType::StartElement)
+    {
+        return text;
+    }
+
+    size_t depth = m_depth;
+    while (Read())
+    {
+        if (m_tokenType == XmlTokenType::Text)
+        {
+            if (text.empty())
+            {
+                text.swap(m_value);
+            }
+            else
+            {
+                text.append(m_value);
+            }
+        }
+        else if (m_tokenType == XmlTokenType::EndElement && m_depth == depth)
+        {
+            break;
+        }
+    }
+
+    return text;
+}
+
+void XmlReader::SkipElement()
+{
+    if (m_tokenType != XmlTokenType::StartElement)
+    {
+        return;
+    }
+
+    size_t depth = m_depth;
+    m_skipText = true;
+    while (Read())
+    {
+        if (m_tokenType == XmlTokenType::EndElement && m_depth == depth)
+        {
+            break;
+        }
+    }
+    m_skipText = false;
+}
+
+bool XmlReader::FillBuffer()
+{
+    if (m_endOfStream)
+    {
+        return false;
+    }
+
+    // drop everything that was already consumed, offsets relative to m_position stay valid.
+    if (m_position > 0)
+    {
+        m_buffer.erase(0, m_position);
+        m_position = 0;
+    }
+
+    size_t previousSize = m_buffer.size();
+    m_buffer.resize(previousSize + XML_READER_CHUNK_SIZE);
+    m_stream.read(&m_buffer[previousSize], XML_READER_CHUNK_SIZE);
+    size_t readCount = static_cast<size_t>(m_stream.gcount());
+    m_buffer.resize(previousSize + readCount);
+
+    if (readCount < XML_READER_CHUNK_SIZE)
+    {
+        m_endOfStream = true;
+    }
+
+    return readCount > 0;
+}
+
+bool XmlReader::EnsureAvailable(size_t count)
+{
+    while (m_buffer.size() - m_position < count)
+    {
+        if (!FillBuffer())
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+size_t XmlReader::Find(const char* delimiter, size_t fromOffset)
+{
+    size_t delimiterLength = strlen(delimiter);
+    for (;;)
+    {
+        size_t found = m_buffer.find(delimiter, m_position + fromOffset);
+        if (found != Aws::String::npos)
+        {
+            return found - m_position;
+        }
+
+        // the delimiter may straddle the chunk boundary, so rescan its length minus one.
+        size_t available = m_buffer.size() - m_position;
+        if (available >= delimiterLength)
+        {
+            fromOffset = (std::max)(fromOffset, available - delimiterLength + 1);
+        }
+
+        if (!FillBuffer())
+        {
+            return Aws::String::npos;
+        }
+    }
+}
+
+size_t XmlReader::FindTagEnd()
+{
+    // a DOCTYPE internal subset ("[...]") may hold markup declarations and comments with their own '>'.
+    static const size_t commentStartLength = sizeof("<!--") - 1;
+    char quote = 0;
+    size_t subsetDepth = 0;
+    size_t offset = 1;
+    for (;;)
+    {
+        for (; m_position + offset < m_buffer.size(); ++offset)
+        {
+            char c = m_buffer[m_position + offset];
+            if (quote)
+            {
+                if (c == quote)
+                {
+                    quote = 0;
+                }
+            }
+            else if (c == '"' || c == '\'')
+            {
+                quote = c;
+            }
+            else if (c == '[')
+            {
+                ++subsetDepth;
+            }
+            else if (c == ']' && subsetDepth > 0)
+            {
+                --subsetDepth;
+            }
+            else if (subsetDepth > 0 && c == '<' && EnsureAvailable(offset + commentStartLength) &&
+                     m_buffer.compare(m_position + offset, commentStartLength, "<!--") == 0)
+            {
+                size_t commentEnd = Find("-->", offset + commentStartLength);
+                if (commentEnd == Aws::String::npos)
+                {
+                    return Aws::String::npos;
+                }
+                offset = commentEnd + 2;
+            }
+            else if (c == '>' && subsetDepth == 0)
+            {
+                return offset;
+            }
+        }
+
+        if (!FillBuffer())
+        {
+            return Aws::String::npos;
+        }
+    }
+}
+
+bool XmlReader::StartsWith(const char* prefix)
+{
+    size_t prefixLength = strlen(prefix);
+    return EnsureAvailable(prefixLength) && m_buffer.compare(m_position, prefixLength, prefix) == 0;
+}
+
+bool XmlReader::ReadStartElement()
+{
+    size_t end = FindTagEnd();
+    if (end == Aws::String::npos)
+    {
+        return SetError("Unterminated element tag.");
+    }
+    if (m_openElements.empty() && m_seenRootElement)
+    {
+        return SetError("Multiple root elements found.");
+    }
+
+    const char* tag = m_buffer.c_str() + m_position + 1;
+    size_t tagLength = end - 1;
+    bool selfClosing = tagLength > 0 && tag[tagLength - 1] == '/';
+    if (selfClosing)
+    {
+        --tagLength;
+    }
+
+    size_t i = 0;
+    while (i < tagLength && !IsXmlSpace(tag[i]))
+    {
+        ++i;
+    }
+    if (i == 0)
+    {
+        return SetError("Element name is missing.");
+    }
+
+    m_name.assign(tag, i);
+    m_attributes.clear();
+    while (i < tagLength)
+    {
+        while (i < tagLength && IsXmlSpace(tag[i]))
+        {
+            ++i;
+        }
+        if (i == tagLength)
+        {
+            break;
+        }
+
+        size_t nameStart = i;
+        while (i < tagLength && tag[i] != '=' && !IsXmlSpace(tag[i]))
+        {
+            ++i;
+        }
+        size_t nameEnd = i;
+        while (i < tagLength && IsXmlSpace(tag[i]))
+        {
+            ++i;
+        }
+        if (i == tagLength || tag[i] != '=')
+        {
+            return SetError("Malformed attribute.");
+        }
+        ++i;
+        while (i < tagLength && IsXmlSpace(tag[i]))
+        {
+            ++i;
+        }
+        if (i == tagLength || (tag[i] != '"' && tag[i] != '\''))
+        {
+            return SetError("Malformed attribute.");
+        }
+
+        char quote = tag[i++];
+        size_t valueStart = i;
+        while (i < tagLength && tag[i] != quote)
+        {
+            ++i;
+        }
+        if (i == tagLength)
+        {
+            return SetError("Malformed attribute.");
+        }
+
+        Aws::String value;
+        DecodeText(tag + valueStart, i - valueStart, value);
+        m_attributes.emplace_back(Aws::String(tag + nameStart, nameEnd - nameStart), std::move(value));
+        ++i;
+    }
+
+    m_position += end + 1;
+    m_depth = m_openElements.size();
+    m_openElements.push_back(m_name);
+    m_seenRootElement = true;
+    m_isEmptyElement = selfClosing;
+    m_pendingEndElement = selfClosing;
+    m_tokenType = XmlTokenType::StartElement;
+    return true;
+}
+
+bool XmlReader::ReadEndElement()
+{
+    size_t end = FindTagEnd();
+    if (end == Aws::String::npos)
+    {
+        return SetError("Unterminated end tag.");
+    }
+
+    const char* tag = m_buffer.c_str() + m_position + 2;
+    size_t tagLength = end - 2;
+    while (tagLength > 0 && IsXmlSpace(tag[tagLength - 1]))
+    {
+        --tagLength;
+    }
+
+    if (m_openElements.empty() || m_openElements.back().compare(0, Aws::String::npos, tag, tagLength) != 0)
+    {
+        return SetError("Mismatched end tag.");
+    }
+
+    m_name.swap(m_openElements.back());
+    m_openElements.pop_back();
+    m_position += end + 1;
+    m_depth = m_openElements.size();
+    m_isEmptyElement = false;
+    m_attributes.clear();
+    m_tokenType = XmlTokenType::EndElement;
+    return true;
+}
+
+bool XmlReader::ReadText()
+{
+    size_t end = Find("<", 0);
+    // no more markup, Find() has already pulled the rest of the stream into the buffer.
+    size_t length = end == Aws::String::npos ? m_buffer.size() - m_position : end;
+    const char* text = m_buffer.c_str() + m_position;
+
+    if (m_openElements.empty())
+    {
+        if (std::any_of(text, text + length, [](char c) { return !IsXmlSpace(c); }))
+        {
+            return SetError("Text found outside of the root element.");
+        }
+        m_position += length;
+        return false;
+    }
+
+    m_value.clear();
+    if (!m_skipText)
+    {
+        DecodeText(text, length, m_value);
+    }
+    m_position += length;
+    m_depth = m_openElements.size();
+    m_tokenType = XmlTokenType::Text;
+    return true;
+}
+
+bool XmlReader::SkipUntil(const char* delimiter)
+{
+    size_t end = Find(delimiter, 0);
+    if (end == Aws::String::npos)
+    {
+        return SetError("Unterminated markup.");
+    }
+
+    m_position += end + strlen(delimiter);
+    return true;
+}
+
+bool XmlReader::SetError(const char* message)
+{
+    m_errorMessage = message;
+    m_tokenType = XmlTokenType::EndOfDocument;
+    return false;
+}
+
+bool XmlReader::SetEndOfDocument()
+{
+    m_depth = 0;
+    m_tokenType = XmlTokenType::EndOfDocument;
+    return false;
+}
@@ -159,7 +159,7 @@ XmlNode XmlNode::CreateSiblingElement(const Aws::String& name)
     return XmlNode(m_node->Parent()->InsertEndChild(element), *m_doc);
 }
 
-bool XmlNode::IsNull()
+bool XmlNode::IsNull() const
 {
     return m_node == nullptr;
 }
@@ -176,6 +176,17 @@ XmlDocument::XmlDocument(XmlDocument&& doc) : m_doc{ doc.m_doc } // take the inn
     doc.m_doc = nullptr; // leave nothing behind
 }
 
+XmlDocument& XmlDocument::operator=(XmlDocument&& other)
+{
+    if (this != &other)
+    {
+        Aws::Delete(m_doc);
+        m_doc = other.m_doc;
+        other.m_doc = nullptr;
+    }
+    return *this;
+}
+
 XmlDocument::~XmlDocument()
 {
     Aws::Delete(m_doc);
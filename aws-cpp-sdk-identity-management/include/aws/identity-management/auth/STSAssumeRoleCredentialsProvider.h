@@ -50,18 +50,26 @@ namespace Aws
              * externalId - if not specified, it will not be sent to STS.
              * loadFrequency, defaults to 15 minutes.
              * stsClient, sts client implementation to use.
+             * refreshMode, whether GetAWSCredentials assumes the role when the credentials are due or a background
+             * thread does it ahead of their expiration.
              *
              * For more information, see:
              *    http://docs.aws.amazon.com/STS/latest/APIReference/API_AssumeRole.html
              */
             STSAssumeRoleCredentialsProvider(const Aws::String& roleArn, const Aws::String& sessionName = Aws::String(), 
                 const Aws::String& externalId = Aws::String(), int loadFrequency = DEFAULT_CREDS_LOAD_FREQ_SECONDS, 
-                const std::shared_ptr<Aws::STS::STSClient>& stsClient = nullptr);
+                const std::shared_ptr<Aws::STS::STSClient>& stsClient = nullptr,
+                CredentialsRefreshMode refreshMode = CredentialsRefreshMode::OnDemand);
 
             AWSCredentials GetAWSCredentials() override;
 
+            std::shared_ptr<const AWSCredentials> GetAWSCredentialsSnapshot() override;
+
+            inline bool ServesCredentialsSnapshots() const override { return true; }
+
         private:
             void LoadCredentialsFromSTS();
+            bool AssumeRole(AWSCredentials& credentials, Aws::Utils::DateTime& expiration);
 
             std::shared_ptr<Aws::STS::STSClient> m_stsClient;
             AWSCredentials m_cachedCredentials;
@@ -71,6 +79,8 @@ namespace Aws
             std::atomic<int64_t> m_expiry;
             std::mutex m_credsMutex;
             std::atomic<int> m_loadFrequency;
+            Aws::UniquePtr<BackgroundCredentialsRefresher> m_backgroundRefresher;
+            PublishedCredentials m_publishedCredentials;
         };
     }
 }
\ No newline at end of file
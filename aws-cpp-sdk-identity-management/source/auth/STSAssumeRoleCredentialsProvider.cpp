@@ -31,7 +31,8 @@ namespace Aws
         static const int ACCOUNT_FOR_LATENCY = 60;
 
         STSAssumeRoleCredentialsProvider::STSAssumeRoleCredentialsProvider(const Aws::String& roleArn, const Aws::String& sessionName,
-            const Aws::String& externalId, int loadFrequency, const std::shared_ptr<Aws::STS::STSClient>& stsClient) :
+            const Aws::String& externalId, int loadFrequency, const std::shared_ptr<Aws::STS::STSClient>& stsClient,
+            CredentialsRefreshMode refreshMode) :
             m_stsClient(stsClient == nullptr ? Aws::MakeShared<Aws::STS::STSClient>(CLASS_TAG) : stsClient),
             m_roleArn(roleArn), m_sessionName(sessionName), m_externalId(externalId),
             m_expiry(0), m_loadFrequency(loadFrequency)            
@@ -43,15 +44,53 @@ namespace Aws
                 m_sessionName = ss.str();
             }
             AWS_LOGSTREAM_INFO(CLASS_TAG, "Role ARN set to: " << m_roleArn << ". Session Name set to: " << m_sessionName);
+
+            if (refreshMode == CredentialsRefreshMode::Background)
+            {
+                //the role is assumed without holding m_credsMutex, which is only taken to swap the new credentials in.
+                m_backgroundRefresher = Aws::MakeUnique<BackgroundCredentialsRefresher>(CLASS_TAG, [this](DateTime& expiration)
+                {
+                    AWSCredentials credentials;
+                    if (!AssumeRole(credentials, expiration))
+                    {
+                        return false;
+                    }
+                    std::lock_guard<std::mutex> locker(m_credsMutex);
+                    m_cachedCredentials = credentials;
+                    m_expiry = expiration.Millis();
+                    m_publishedCredentials.Publish(credentials);
+                    return true;
+                }, static_cast<long>(loadFrequency) * 1000);
+            }
         }
 
         AWSCredentials STSAssumeRoleCredentialsProvider::GetAWSCredentials()
         {
-            LoadCredentialsFromSTS();
+            if (m_backgroundRefresher)
+            {
+                m_backgroundRefresher->WaitForFirstRefresh();
+            }
+            else
+            {
+                LoadCredentialsFromSTS();
+            }
             std::lock_guard<std::mutex> locker(m_credsMutex);
             return m_cachedCredentials;
         }
 
+        std::shared_ptr<const AWSCredentials> STSAssumeRoleCredentialsProvider::GetAWSCredentialsSnapshot()
+        {
+            if (m_backgroundRefresher)
+            {
+                m_backgroundRefresher->WaitForFirstRefresh();
+            }
+            else
+            {
+                LoadCredentialsFromSTS();
+            }
+            return m_publishedCredentials.Get();
+        }
+
         void STSAssumeRoleCredentialsProvider::LoadCredentialsFromSTS()
         {
             //standard check lock check
@@ -66,32 +105,41 @@ namespace Aws
                 if (diffSeconds > 0 - ACCOUNT_FOR_LATENCY)
                 {
                     AWS_LOGSTREAM_INFO(CLASS_TAG, "Credentials have expired with diff of " << diffSeconds << " since last credentials pull.");
-                    Model::AssumeRoleRequest assumeRoleRequest;
-                    assumeRoleRequest.WithRoleArn(m_roleArn)
-                        .WithRoleSessionName(m_sessionName)
-                        .WithDurationSeconds(m_loadFrequency);
-
-                    if (!m_externalId.empty())
-                    {
-                        assumeRoleRequest.SetExternalId(m_externalId);
-                    }
-
-                    auto assumeRoleOutcome = m_stsClient->AssumeRole(assumeRoleRequest);
-                    if (assumeRoleOutcome.IsSuccess())
+                    DateTime expiration;
+                    if (AssumeRole(m_cachedCredentials, expiration))
                     {
-                        const auto& stsCredentials = assumeRoleOutcome.GetResult().GetCredentials();
-                        m_cachedCredentials = AWSCredentials(stsCredentials.GetAccessKeyId(), stsCredentials.GetSecretAccessKey(), stsCredentials.GetSessionToken());
-                        m_expiry = stsCredentials.GetExpiration().Millis();
-                        AWS_LOGSTREAM_DEBUG(CLASS_TAG, "Credentials refreshed with new expiry " << 
-                            DateTime(m_expiry.load()).ToGmtString(DateFormat::ISO_8601));
-                    }
-                    else
-                    {
-                        AWS_LOGSTREAM_ERROR(CLASS_TAG, "Credentials refresh failed with error " << assumeRoleOutcome.GetError().GetExceptionName()
-                                << " message: " << assumeRoleOutcome.GetError().GetMessage());
+                        m_expiry = expiration.Millis();
+                        m_publishedCredentials.Publish(m_cachedCredentials);
                     }
                 }
             }            
         }
+
+        bool STSAssumeRoleCredentialsProvider::AssumeRole(AWSCredentials& credentials, DateTime& expiration)
+        {
+            Model::AssumeRoleRequest assumeRoleRequest;
+            assumeRoleRequest.WithRoleArn(m_roleArn)
+                .WithRoleSessionName(m_sessionName)
+                .WithDurationSeconds(m_loadFrequency);
+
+            if (!m_externalId.empty())
+            {
+                assumeRoleRequest.SetExternalId(m_externalId);
+            }
+
+            auto assumeRoleOutcome = m_stsClient->AssumeRole(assumeRoleRequest);
+            if (!assumeRoleOutcome.IsSuccess())
+            {
+                AWS_LOGSTREAM_ERROR(CLASS_TAG, "Credentials refresh failed with error " << assumeRoleOutcome.GetError().GetExceptionName()
+                        << " message: " << assumeRoleOutcome.GetError().GetMessage());
+                return false;
+            }
+
+            const auto& stsCredentials = assumeRoleOutcome.GetResult().GetCredentials();
+            credentials = AWSCredentials(stsCredentials.GetAccessKeyId(), stsCredentials.GetSecretAccessKey(), stsCredentials.GetSessionToken());
+            expiration = stsCredentials.GetExpiration();
+            AWS_LOGSTREAM_DEBUG(CLASS_TAG, "Credentials refreshed with new expiry " << expiration.ToGmtString(DateFormat::ISO_8601));
+            return true;
+        }
     }
 }
\ No newline at end of file
@@ -23,6 +23,9 @@
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/DNS.h>
+#include <aws/core/http/URI.h>
+#include <aws/core/utils/memory/stl/AWSMap.h>
+#include <aws/core/utils/threading/ReaderWriterLock.h>
 #include <aws/s3/model/AbortMultipartUploadResult.h>
 #include <aws/s3/model/CompleteMultipartUploadResult.h>
 #include <aws/s3/model/CopyObjectResult.h>
@@ -2572,6 +2575,7 @@ namespace Aws
         void init(const Client::ClientConfiguration& clientConfiguration);
         Aws::String ComputeEndpointString(const Aws::String& bucket) const;
         Aws::String ComputeEndpointString() const;
+        Aws::Http::URI ComputeEndpointUri(const Aws::String& bucket) const;
 
         /**Async helpers**/
         void AbortMultipartUploadAsyncHelper(const Model::AbortMultipartUploadRequest& request, const AbortMultipartUploadResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const;
@@ -2650,6 +2654,10 @@ namespace Aws
 
         Aws::String m_baseUri;
         Aws::String m_scheme;
+        Aws::Http::URI m_uri;
+        //endpoints computed so far, by bucket.
+        mutable Aws::Map<Aws::String, Aws::Http::URI> m_bucketUris;
+        mutable Aws::Utils::Threading::ReaderWriterLock m_bucketUrisLock;
         std::shared_ptr<Utils::Threading::Executor> m_executor;
         bool m_useVirtualAdressing;
     };
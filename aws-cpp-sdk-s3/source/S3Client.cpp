@@ -111,6 +111,7 @@ using namespace Aws::Utils::Xml;
 
 static const char* SERVICE_NAME = "s3";
 static const char* ALLOCATION_TAG = "S3Client";
+static const size_t MAX_CACHED_BUCKET_URIS = 1024;
 
 
 S3Client::S3Client(const Client::ClientConfiguration& clientConfiguration, Aws::Client::AWSAuthV4Signer::PayloadSigningPolicy signPayloads, bool useVirtualAdressing) :
@@ -159,12 +160,13 @@ void S3Client::init(const ClientConfiguration& config)
         m_baseUri = config.endpointOverride;
     }
     m_scheme = SchemeMapper::ToString(config.scheme);
+    m_uri = ComputeEndpointString();
 }
 
 AbortMultipartUploadOutcome S3Client::AbortMultipartUpload(const AbortMultipartUploadRequest& request) const
 {
   Aws::StringStream ss;
-  Aws::Http::URI uri = ComputeEndpointString(request.GetBucket());
+  Aws::Http::URI uri = ComputeEndpointUri(request.GetBucket());
   ss << "/";
   ss << request.GetKey();
   uri.SetPath(uri.GetPath() + ss.str());
@@ -200,7 +202,7 @@ void S3Client::AbortMultipartUploadAsyncHelper(const AbortMultipartUploadRequest
 CompleteMultipartUploadOutcome S3Client::CompleteMultipartUpload(const CompleteMultipartUploadRequest& request) const
 {
   Aws::StringStream ss;
-  Aws::Http::URI uri = ComputeEndpointString(request.GetBucket());
+  Aws::Http::URI uri = ComputeEndpointUri(request.GetBucket());
   ss << "/";
   ss << request.GetKey();
   uri.SetPath(uri.GetPath() + ss.str());
@@ -236,7 +238,7 @@ void S3Client::CompleteMultipartUploadAsyncHelper(const CompleteMultipartUploadR
 CopyObjectOutcome S3Client::CopyObject(const CopyObjectRequest& request) const
 {
   Aws::StringStream ss;
-  Aws::Http::URI uri = ComputeEndpointString(request.GetBucket());
+  Aws::Http::URI uri = ComputeEndpointUri(request.GetBucket());
   ss << "/";
   ss << request.GetKey();
   uri.SetPath(uri.GetPath() + ss.str());
@@ -272,7 +274,7 @@ void S3Client::CopyObjectAsyncHelper(const CopyObjectRequest& request, const Cop
 CreateBucketOutcome S3Client::CreateBucket(const CreateBucketRequest& request) const
 {
   Aws::StringStream ss;
-  Aws::Http::URI uri = ComputeEndpointString();
+  Aws::Http::URI uri = m_uri;
   ss << "/";
   ss << request.GetBucket();
   uri.SetPath(uri.GetPath() + ss.str());
@@ -308,7 +310,7 @@ void S3Client::CreateBucketAsyncHelper(const CreateBucketRequest& request, const
 CreateMultipartUploadOutcome S3Client::CreateMultipartUpload(const CreateMultipartUploadRequest& request) const
 {
   Aws::StringStream ss;
-  Aws::Http::URI uri = ComputeEndpointString(request.GetBucket());
+  Aws::Http::URI uri = ComputeEndpointUri(request.GetBucket());
   ss << "/";
   ss << request.GetKey();
   uri.SetPath(uri.GetPath() + ss.str());
@@ -346,7 +348,7 @@ void S3Client::CreateMultipartUploadAsyncHelper(const CreateMultipartUploadReque
 DeleteBucketOutcome S3Client::DeleteBucket(const DeleteBucketRequest& request) const
 {
   Aws::StringStream ss;
-  Aws::Http::URI uri = ComputeEndpointString(request.GetBucket());
+  Aws::Http::URI uri = ComputeEndpointUri(request.GetBucket());
   uri.SetPath(uri.GetPath() + ss.str());
   XmlOutcome outcome = MakeRequest(uri, request, HttpMethod::HTTP_DELETE);
   if(outcome.IsSuccess())
@@ -380,7 +382,7 @@ void S3Client::DeleteBucketAsyncHelper(const DeleteBucketRequest& request, const
 DeleteBucketAnalyticsConfigurationOutcome S3Client::DeleteBucketAnalyticsConfiguration(const DeleteBucketAnalyticsConfigurationRequest& request) const
 {
   Aws::StringStream ss;
-  Aws::Http::URI uri = ComputeEndpointString(request.GetBucket());
+  Aws::Http::URI uri = ComputeEndpointUri(request.GetBucket());
   ss.str("?analytics");
   uri.SetQueryString(ss.str());
   XmlOutcome outcome = MakeRequest(uri, request, HttpMethod::HTTP_DELETE);
@@ -415,7 +417,7 @@ void S3Client::DeleteBucketAnalyticsConfigurationAsyncHelper(const DeleteBucketA
 DeleteBucketCorsOutcome S3Client::DeleteBucketCors(const DeleteBucketCorsRequest& request) const
 {
   Aws::StringStream ss;
-  Aws::Http::URI uri = ComputeEndpointString(request.GetBucket());
+  Aws::Http::URI uri = ComputeEndpointUri(request.GetBucket());
   ss.str("?cors");
   uri.SetQueryString(ss.str());
   XmlOutcome outcome = MakeRequest(uri, request, HttpMethod::HTTP_DELETE);
@@ -450,7 +452,7 @@ void S3Client::DeleteBucketCorsAsyncHelper(const DeleteBucketCorsRequest& reques
 DeleteBucketEncryptionOutcome S3Client::DeleteBucketEncryption(const DeleteBucketEncryptionRequest& request) const
 {
   Aws::StringStream ss;
-  Aws::Http::URI uri = ComputeEndpointString(request.GetBucket());
+  Aws::Http::URI uri = ComputeEndpointUri(request.GetBucket());
   ss.str("?encryption");
   uri.SetQueryString(ss.str());
   XmlOutcome outcome = MakeRequest(uri, request, HttpMethod::HTTP_DELETE);
@@ -485,7 +487,7 @@ void S3Client::DeleteBucketEncryptionAsyncHelper(const DeleteBucketEncryptionReq
 DeleteBucketInventoryConfigurationOutcome S3Client::DeleteBucketInventoryConfiguration(const DeleteBucketInventoryConfigurationRequest& request) const
 {
   Aws::StringStream ss;
-  Aws::Http::URI uri = ComputeEndpointString(request.GetBucket());
+  Aws::Http::URI uri = ComputeEndpointUri(request.GetBucket());
   ss.str("?inventory");
   uri.SetQueryString(ss.str());
   XmlOutcome outcome = MakeRequest(uri, request, HttpMethod::HTTP_DELETE);
@@ -520,7 +522,7 @@ void S3Client::DeleteBucketInventoryConfigurationAsyncHelper(const DeleteBucketI
 DeleteBucketLifecycleOutcome S3Client::DeleteBucketLifecycle(const DeleteBucketLifecycleRequest& request) const
 {
   Aws::StringStream ss;
-  Aws::Http::URI uri = ComputeEndpointString(request.GetBucket());
+  Aws::Http::URI uri = ComputeEndpointUri(request.GetBucket());
   ss.str("?lifecycle");
   uri.SetQueryString(ss.str());
   XmlOutcome outcome = MakeRequest(uri, request, HttpMethod::HTTP_DELETE);
@@ -555,7 +557,7 @@ void S3Client::DeleteBucketLifecycleAsyncHelper(const DeleteBucketLifecycleReque
 DeleteBucketMetricsConfigurationOutcome S3Client::DeleteBucketMetricsConfiguration(const DeleteBucketMetricsConfigurationRequest& request) const
 {
   Aws::StringStream ss;
-  Aws::Http::URI uri = ComputeEndpointString(request.GetBucket());
+  Aws::Http::URI uri = ComputeEndpointUri(request.GetBucket());
   ss.str("?metrics");
   uri.SetQueryString(ss.str());
   XmlOutcome outcome = MakeRequest(uri, request, HttpMethod::HTTP_DELETE);
@@ -590,7 +592,7 @@ void S3Client::DeleteBucketMetricsConfigurationAsyncHelper(const DeleteBucketMet
 DeleteBucketPolicyOutcome S3Client::DeleteBucketPolicy(const DeleteBucketPolicyRequest& request) const
 {
   Aws::StringStream ss;
-  Aws::Http::URI uri = ComputeEndpointString(request.GetBucket());
+  Aws::Http::URI uri = ComputeEndpointUri(request.GetBucket());
   ss.str("?policy");
   uri.SetQueryString(ss.str());
   XmlOutcome outcome = MakeRequest(uri, request, HttpMethod::HTTP_DELETE);
@@ -625,7 +627,7 @@ void S3Client::DeleteBucketPolicyAsyncHelper(const DeleteBucketPolicyRequest& re
 DeleteBucketReplicationOutcome S3Client::DeleteBucketReplication(const DeleteBucketReplicationRequest& request) const
 {
   Aws::StringStream ss;
-  Aws::Http::URI uri = ComputeEndpointString(request.GetBucket());
+  Aws::Http::URI uri = ComputeEndpointUri(request.GetBucket());
   ss.str("?replication");
   uri.SetQueryString(ss.str());
   XmlOutcome outcome = MakeRequest(uri, request, HttpMethod::HTTP_DELETE);
@@ -660,7 +662,7 @@ void S3Client::DeleteBucketReplicationAsyncHelper(const DeleteBucketReplicationR
 DeleteBucketTaggingOutcome S3Client::DeleteBucketTagging(const DeleteBucketTaggingRequest& request) const
 {
   Aws::StringStream ss;
-  Aws::Http::URI uri = ComputeEndpointString(request.GetBucket());
+  Aws::Http::URI uri = ComputeEndpointUri(request.GetBucket());
   ss.str("?tagging");
   uri.SetQueryString(ss.str());
   XmlOutcome outcome = MakeRequest(uri, request, HttpMethod::HTTP_DELETE);
@@ -695,7 +697,7 @@ void S3Client::DeleteBucketTaggingAsyncHelper(const DeleteBucketTaggingRequest&
 DeleteBucketWebsiteOutcome S3Client::DeleteBucketWebsite(const DeleteBucketWebsiteRequest& request) const
 {
   Aws::StringStream ss;
-  Aws::Http::URI uri = ComputeEndpointString(request.GetBucket());
+  Aws::Http::URI uri = ComputeEndpointUri(request.GetBucket());
   ss.str("?website");
   uri.SetQueryString(ss.str());
   XmlOutcome outcome = MakeRequest(uri, request, HttpMethod::HTTP_DELETE);
@@ -730,7 +732,7 @@ void S3Client::DeleteBucketWebsiteAsyncHelper(const DeleteBucketWebsiteRequest&
 DeleteObjectOutcome S3Client::DeleteObject(const DeleteObjectRequest& request) const
 {
   Aws::StringStream ss;
-  Aws::Http::URI uri = ComputeEndpointString(request.GetBucket());
+  Aws::Http::URI uri = ComputeEndpointUri(request.GetBucket());
   ss << "/";
   ss << request.GetKey();
   uri.SetPath(uri.GetPath() + ss.str());
@@ -766,7 +768,7 @@ void S3Client::DeleteObjectAsyncHelper(const DeleteObjectRequest& request, const
 DeleteObjectTaggingOutcome S3Client::DeleteObjectTagging(const DeleteObjectTaggingRequest& request) const
 {
   Aws::StringStream ss;
-  Aws::Http::URI uri = ComputeEndpointString(request.GetBucket());
+  Aws::Http::URI uri = ComputeEndpointUri(request.GetBucket());
   ss << "/";
   ss << request.GetKey();
   uri.SetPath(uri.GetPath() + ss.str());
@@ -804,7 +806,7 @@ void S3Client::DeleteObjectTaggingAsyncHelper(const DeleteObjectTaggingRequest&
 DeleteObjectsOutcome S3Client::DeleteObjects(const DeleteObjectsRequest& request) const
 {
   Aws::StringStream ss;
-  Aws::Http::URI uri = ComputeEndpointString(request.GetBucket());
+  Aws::Http::URI uri = ComputeEndpointUri(request.GetBucket());
   ss.str("?delete");
   uri.SetQueryString(ss.str());
   XmlOutcome outcome = MakeRequest(uri, request, HttpMethod::HTTP_POST);
@@ -839,7 +841,7 @@ void S3Client::DeleteObjectsAsyncHelper(const DeleteObjectsRequest& request, con
 GetBucketAccelerateConfigurationOutcome S3Client::GetBucketAccelerateConfiguration(const GetBucketAccelerateConfigurationRequest& request) const
 {
   Aws::StringStream ss;
-  Aws::Http::URI uri = ComputeEndpointString(request.GetBucket());
+  Aws::Http::URI uri = ComputeEndpointUri(request.GetBucket());
   ss.str("?accelerate");
   uri.SetQueryString(ss.str());
   XmlOutcome outcome = MakeRequest(uri, request, HttpMethod::HTTP_GET);
@@ -874,7 +876,7 @@ void S3Client::GetBucketAccelerateConfigurationAsyncHelper(const GetBucketAccele
 GetBucketAclOutcome S3Client::GetBucketAcl(const GetBucketAclRequest& request) const
 {
   Aws::StringStream ss;
-  Aws::Http::URI uri = ComputeEndpointString(request.GetBucket());
+  Aws::Http::URI uri = ComputeEndpointUri(request.GetBucket());
   ss.str("?acl");
   uri.SetQueryString(ss.str());
   XmlOutcome outcome = MakeRequest(uri, request, HttpMethod::HTTP_GET);
@@ -909,7 +911,7 @@ void S3Client::GetBucketAclAsyncHelper(const GetBucketAclRequest& request, const
 GetBucketAnalyticsConfigurationOutcome S3Client::GetBucketAnalyticsConfiguration(const GetBucketAnalyticsConfigurationRequest& request) const
 {
   Aws::StringStream ss;
-  Aws::Http::URI uri = ComputeEndpointString(request.GetBucket());
+  Aws::Http::URI uri = ComputeEndpointUri(request.GetBucket());
   ss.str("?analytics");
   uri.SetQueryString(ss.str());
   XmlOutcome outcome = MakeRequest(uri, request, HttpMethod::HTTP_GET);
@@ -944,7 +946,7 @@ void S3Client::GetBucketAnalyticsConfigurationAsyncHelper(const GetBucketAnalyti
 GetBucketCorsOutcome S3Client::GetBucketCors(const GetBucketCorsRequest& request) const
 {
   Aws::StringStream ss;
-  Aws::Http::URI uri = ComputeEndpointString(request.GetBucket());
+  Aws::Http::URI uri = ComputeEndpointUri(request.GetBucket());
   ss.str("?cors");
   uri.SetQueryString(ss.str());
   XmlOutcome outcome = MakeRequest(uri, request, HttpMethod::HTTP_GET);
@@ -979,7 +981,7 @@ void S3Client::GetBucketCorsAsyncHelper(const GetBucketCorsRequest& request, con
 GetBucketEncryptionOutcome S3Client::GetBucketEncryption(const GetBucketEncryptionRequest& request) const
 {
   Aws::StringStream ss;
-  Aws::Http::URI uri = ComputeEndpointString(request.GetBucket());
+  Aws::Http::URI uri = ComputeEndpointUri(request.GetBucket());
   ss.str("?encryption");
   uri.SetQueryString(ss.str());
   XmlOutcome outcome = MakeRequest(uri, request, HttpMethod::HTTP_GET);
@@ -1014,7 +1016,7 @@ void S3Client::GetBucketEncryptionAsyncHelper(const GetBucketEncryptionRequest&
 GetBucketInventoryConfigurationOutcome S3Client::GetBucketInventoryConfiguration(const GetBucketInventoryConfigurationRequest& request) const
 {
   Aws::StringStream ss;
-  Aws::Http::URI uri = ComputeEndpointString(request.GetBucket());
+  Aws::Http::URI uri = ComputeEndpointUri(request.GetBucket());
   ss.str("?inventory");
   uri.SetQueryString(ss.str());
   XmlOutcome outcome = MakeRequest(uri, request, HttpMethod::HTTP_GET);
@@ -1049,7 +1051,7 @@ void S3Client::GetBucketInventoryConfigurationAsyncHelper(const GetBucketInvento
 GetBucketLifecycleConfigurationOutcome S3Client::GetBucketLifecycleConfiguration(const GetBucketLifecycleConfigurationRequest& request) const
 {
   Aws::StringStream ss;
-  Aws::Http::URI uri = ComputeEndpointString(request.GetBucket());
+  Aws::Http::URI uri = ComputeEndpointUri(request.GetBucket());
   ss.str("?lifecycle");
   uri.SetQueryString(ss.str());
   XmlOutcome outcome = MakeRequest(uri, request, HttpMethod::HTTP_GET);
@@ -1084,7 +1086,7 @@ void S3Client::GetBucketLifecycleConfigurationAsyncHelper(const GetBucketLifecyc
 GetBucketLocationOutcome S3Client::GetBucketLocation(const GetBucketLocationRequest& request) const
 {
   Aws::StringStream ss;
-  Aws::Http::URI uri = ComputeEndpointString(request.GetBucket());
+  Aws::Http::URI uri = ComputeEndpointUri(request.GetBucket());
   ss.str("?location");
   uri.SetQueryString(ss.str());
   XmlOutcome outcome = MakeRequest(uri, request, HttpMethod::HTTP_GET);
@@ -1119,7 +1121,7 @@ void S3Client::GetBucketLocationAsyncHelper(const GetBucketLocationRequest& requ
 GetBucketLoggingOutcome S3Client::GetBucketLogging(const GetBucketLoggingRequest& request) const
 {
   Aws::StringStream ss;
-  Aws::Http::URI uri = ComputeEndpointString(request.GetBucket());
+  Aws::Http::URI uri = ComputeEndpointUri(request.GetBucket());
   ss.str("?logging");
   uri.SetQueryString(ss.str());
   XmlOutcome outcome = MakeRequest(uri, request, HttpMethod::HTTP_GET);
@@ -1154,7 +1156,7 @@ void S3Client::GetBucketLoggingAsyncHelper(const GetBucketLoggingRequest& reques
 GetBucketMetricsConfigurationOutcome S3Client::GetBucketMetricsConfiguration(const GetBucketMetricsConfigurationRequest& request) const
 {
   Aws::StringStream ss;
-  Aws::Http::URI uri = ComputeEndpointString(request.GetBucket());
+  Aws::Http::URI uri = ComputeEndpointUri(request.GetBucket());
   ss.str("?metrics");
   uri.SetQueryString(ss.str());
   XmlOutcome outcome = MakeRequest(uri, request, HttpMethod::HTTP_GET);
@@ -1189,7 +1191,7 @@ void S3Client::GetBucketMetricsConfigurationAsyncHelper(const GetBucketMetricsCo
 GetBucketNotificationConfigurationOutcome S3Client::GetBucketNotificationConfiguration(const GetBucketNotificationConfigurationRequest& request) const
 {
   Aws::StringStream ss;
-  Aws::Http::URI uri = ComputeEndpointString(request.GetBucket());
+  Aws::Http::URI uri = ComputeEndpointUri(request.GetBucket());
   ss.str("?notification");
   uri.SetQueryString(ss.str());
   XmlOutcome outcome = MakeRequest(uri, request, HttpMethod::HTTP_GET);
@@ -1224,7 +1226,7 @@ void S3Client::GetBucketNotificationConfigurationAsyncHelper(const GetBucketNoti
 GetBucketPolicyOutcome S3Client::GetBucketPolicy(const GetBucketPolicyRequest& request) const
 {
   Aws::StringStream ss;
-  Aws::Http::URI uri = ComputeEndpointString(request.GetBucket());
+  Aws::Http::URI uri = ComputeEndpointUri(request.GetBucket());
   ss.str("?policy");
   uri.SetQueryString(ss.str());
   StreamOutcome outcome = MakeRequestWithUnparsedResponse(uri, request, HttpMethod::HTTP_GET);
@@ -1259,7 +1261,7 @@ void S3Client::GetBucketPolicyAsyncHelper(const GetBucketPolicyRequest& request,
 GetBucketReplicationOutcome S3Client::GetBucketReplication(const GetBucketReplicationRequest& request) const
 {
   Aws::StringStream ss;
-  Aws::Http::URI uri = ComputeEndpointString(request.GetBucket());
+  Aws::Http::URI uri = ComputeEndpointUri(request.GetBucket());
   ss.str("?replication");
   uri.SetQueryString(ss.str());
   XmlOutcome outcome = MakeRequest(uri, request, HttpMethod::HTTP_GET);
@@ -1294,7 +1296,7 @@ void S3Client::GetBucketReplicationAsyncHelper(const GetBucketReplicationRequest
 GetBucketRequestPaymentOutcome S3Client::GetBucketRequestPayment(const GetBucketRequestPaymentRequest& request) const
 {
   Aws::StringStream ss;
-  Aws::Http::URI uri = ComputeEndpointString(request.GetBucket());
+  Aws::Http::URI uri = ComputeEndpointUri(request.GetBucket());
   ss.str("?requestPayment");
   uri.SetQueryString(ss.str());
   XmlOutcome outcome = MakeRequest(uri, request, HttpMethod::HTTP_GET);
@@ -1329,7 +1331,7 @@ void S3Client::GetBucketRequestPaymentAsyncHelper(const GetBucketRequestPaymentR
 GetBucketTaggingOutcome S3Client::GetBucketTagging(const GetBucketTaggingRequest& request) const
 {
   Aws::StringStream ss;
-  Aws::Http::URI uri = ComputeEndpointString(request.GetBucket());
+  Aws::Http::URI uri = ComputeEndpointUri(request.GetBucket());
   ss.str("?tagging");
   uri.SetQueryString(ss.str());
   XmlOutcome outcome = MakeRequest(uri, request, HttpMethod::HTTP_GET);
@@ -1364,7 +1366,7 @@ void S3Client::GetBucketTaggingAsyncHelper(const GetBucketTaggingRequest& reques
 GetBucketVersioningOutcome S3Client::GetBucketVersioning(const GetBucketVersioningRequest& request) const
 {
   Aws::StringStream ss;
-  Aws::Http::URI uri = ComputeEndpointString(request.GetBucket());
+  Aws::Http::URI uri = ComputeEndpointUri(request.GetBucket());
   ss.str("?versioning");
   uri.SetQueryString(ss.str());
   XmlOutcome outcome = MakeRequest(uri, request, HttpMethod::HTTP_GET);
@@ -1399,7 +1401,7 @@ void S3Client::GetBucketVersioningAsyncHelper(const GetBucketVersioningRequest&
 GetBucketWebsiteOutcome S3Client::GetBucketWebsite(const GetBucketWebsiteRequest& request) const
 {
   Aws::StringStream ss;
-  Aws::Http::URI uri = ComputeEndpointString(request.GetBucket());
+  Aws::Http::URI uri = ComputeEndpointUri(request.GetBucket());
   ss.str("?website");
   uri.SetQueryString(ss.str());
   XmlOutcome outcome = MakeRequest(uri, request, HttpMethod::HTTP_GET);
@@ -1434,7 +1436,7 @@ void S3Client::GetBucketWebsiteAsyncHelper(const GetBucketWebsiteRequest& reques
 GetObjectOutcome S3Client::GetObject(const GetObjectRequest& request) const
 {
   Aws::StringStream ss;
-  Aws::Http::URI uri = ComputeEndpointString(request.GetBucket());
+  Aws::Http::URI uri = ComputeEndpointUri(request.GetBucket());
   ss << "/";
   ss << request.GetKey();
   uri.SetPath(uri.GetPath() + ss.str());
@@ -1470,7 +1472,7 @@ void S3Client::GetObjectAsyncHelper(const GetObjectRequest& request, const GetOb
 GetObjectAclOutcome S3Client::GetObjectAcl(const GetObjectAclRequest& request) const
 {
   Aws::StringStream ss;
-  Aws::Http::URI uri = ComputeEndpointString(request.GetBucket());
+  Aws::Http::URI uri = ComputeEndpointUri(request.GetBucket());
   ss << "/";
   ss << request.GetKey();
   uri.SetPath(uri.GetPath() + ss.str());
@@ -1508,7 +1510,7 @@ void S3Client::GetObjectAclAsyncHelper(const GetObjectAclRequest& request, const
 GetObjectTaggingOutcome S3Client::GetObjectTagging(const GetObjectTaggingRequest& request) const
 {
   Aws::StringStream ss;
-  Aws::Http::URI uri = ComputeEndpointString(request.GetBucket());
+  Aws::Http::URI uri = ComputeEndpointUri(request.GetBucket());
   ss << "/";
   ss << request.GetKey();
   uri.SetPath(uri.GetPath() + ss.str());
@@ -1546,7 +1548,7 @@ void S3Client::GetObjectTaggingAsyncHelper(const GetObjectTaggingRequest& reques
 GetObjectTorrentOutcome S3Client::GetObjectTorrent(const GetObjectTorrentRequest& request) const
 {
   Aws::StringStream ss;
-  Aws::Http::URI uri = ComputeEndpointString(request.GetBucket());
+  Aws::Http::URI uri = ComputeEndpointUri(request.GetBucket());
   ss << "/";
   ss << request.GetKey();
   uri.SetPath(uri.GetPath() + ss.str());
@@ -1584,7 +1586,7 @@ void S3Client::GetObjectTorrentAsyncHelper(const GetObjectTorrentRequest& reques
 HeadBucketOutcome S3Client::HeadBucket(const HeadBucketRequest& request) const
 {
   Aws::StringStream ss;
-  Aws::Http::URI uri = ComputeEndpointString(request.GetBucket());
+  Aws::Http::URI uri = ComputeEndpointUri(request.GetBucket());
   uri.SetPath(uri.GetPath() + ss.str());
   XmlOutcome outcome = MakeRequest(uri, request, HttpMethod::HTTP_HEAD);
   if(outcome.IsSuccess())
@@ -1618,7 +1620,7 @@ void S3Client::HeadBucketAsyncHelper(const HeadBucketRequest& request, const Hea
 HeadObjectOutcome S3Client::HeadObject(const HeadObjectRequest& request) const
 {
   Aws::StringStream ss;
-  Aws::Http::URI uri = ComputeEndpointString(request.GetBucket());
+  Aws::Http::URI uri = ComputeEndpointUri(request.GetBucket());
   ss << "/";
   ss << request.GetKey();
   uri.SetPath(uri.GetPath() + ss.str());
@@ -1654,7 +1656,7 @@ void S3Client::HeadObjectAsyncHelper(const HeadObjectRequest& request, const Hea
 ListBucketAnalyticsConfigurationsOutcome S3Client::ListBucketAnalyticsConfigurations(const ListBucketAnalyticsConfigurationsRequest& request) const
 {
   Aws::StringStream ss;
-  Aws::Http::URI uri = ComputeEndpointString(request.GetBucket());
+  Aws::Http::URI uri = ComputeEndpointUri(request.GetBucket());
   ss.str("?analytics");
   uri.SetQueryString(ss.str());
   XmlOutcome outcome = MakeRequest(uri, request, HttpMethod::HTTP_GET);
@@ -1689,7 +1691,7 @@ void S3Client::ListBucketAnalyticsConfigurationsAsyncHelper(const ListBucketAnal
 ListBucketInventoryConfigurationsOutcome S3Client::ListBucketInventoryConfigurations(const ListBucketInventoryConfigurationsRequest& request) const
 {
   Aws::StringStream ss;
-  Aws::Http::URI uri = ComputeEndpointString(request.GetBucket());
+  Aws::Http::URI uri = ComputeEndpointUri(request.GetBucket());
   ss.str("?inventory");
   uri.SetQueryString(ss.str());
   XmlOutcome outcome = MakeRequest(uri, request, HttpMethod::HTTP_GET);
@@ -1724,7 +1726,7 @@ void S3Client::ListBucketInventoryConfigurationsAsyncHelper(const ListBucketInve
 ListBucketMetricsConfigurationsOutcome S3Client::ListBucketMetricsConfigurations(const ListBucketMetricsConfigurationsRequest& request) const
 {
   Aws::StringStream ss;
-  Aws::Http::URI uri = ComputeEndpointString(request.GetBucket());
+  Aws::Http::URI uri = ComputeEndpointUri(request.GetBucket());
   ss.str("?metrics");
   uri.SetQueryString(ss.str());
   XmlOutcome outcome = MakeRequest(uri, request, HttpMethod::HTTP_GET);
@@ -1792,7 +1794,7 @@ void S3Client::ListBucketsAsyncHelper(const ListBucketsResponseReceivedHandler&
 ListMultipartUploadsOutcome S3Client::ListMultipartUploads(const ListMultipartUploadsRequest& request) const
 {
   Aws::StringStream ss;
-  Aws::Http::URI uri = ComputeEndpointString(request.GetBucket());
+  Aws::Http::URI uri = ComputeEndpointUri(request.GetBucket());
   ss.str("?uploads");
   uri.SetQueryString(ss.str());
   XmlOutcome outcome = MakeRequest(uri, request, HttpMethod::HTTP_GET);
@@ -1827,7 +1829,7 @@ void S3Client::ListMultipartUploadsAsyncHelper(const ListMultipartUploadsRequest
 ListObjectVersionsOutcome S3Client::ListObjectVersions(const ListObjectVersionsRequest& request) const
 {
   Aws::StringStream ss;
-  Aws::Http::URI uri = ComputeEndpointString(request.GetBucket());
+  Aws::Http::URI uri = ComputeEndpointUri(request.GetBucket());
   ss.str("?versions");
   uri.SetQueryString(ss.str());
   XmlOutcome outcome = MakeRequest(uri, request, HttpMethod::HTTP_GET);
@@ -1862,7 +1864,7 @@ void S3Client::ListObjectVersionsAsyncHelper(const ListObjectVersionsRequest& re
 ListObjectsOutcome S3Client::ListObjects(const ListObjectsRequest& request) const
 {
   Aws::StringStream ss;
-  Aws::Http::URI uri = ComputeEndpointString(request.GetBucket());
+  Aws::Http::URI uri = ComputeEndpointUri(request.GetBucket());
   uri.SetPath(uri.GetPath() + ss.str());
   XmlOutcome outcome = MakeRequest(uri, request, HttpMethod::HTTP_GET);
   if(outcome.IsSuccess())
@@ -1896,7 +1898,7 @@ void S3Client::ListObjectsAsyncHelper(const ListObjectsRequest& request, const L
 ListObjectsV2Outcome S3Client::ListObjectsV2(const ListObjectsV2Request& request) const
 {
   Aws::StringStream ss;
-  Aws::Http::URI uri = ComputeEndpointString(request.GetBucket());
+  Aws::Http::URI uri = ComputeEndpointUri(request.GetBucket());
   ss.str("?list-type=2");
   uri.SetQueryString(ss.str());
   XmlOutcome outcome = MakeRequest(uri, request, HttpMethod::HTTP_GET);
@@ -1931,7 +1933,7 @@ void S3Client::ListObjectsV2AsyncHelper(const ListObjectsV2Request& request, con
 ListPartsOutcome S3Client::ListParts(const ListPartsRequest& request) const
 {
   Aws::StringStream ss;
-  Aws::Http::URI uri = ComputeEndpointString(request.GetBucket());
+  Aws::Http::URI uri = ComputeEndpointUri(request.GetBucket());
   ss << "/";
   ss << request.GetKey();
   uri.SetPath(uri.GetPath() + ss.str());
@@ -1967,7 +1969,7 @@ void S3Client::ListPartsAsyncHelper(const ListPartsRequest& request, const ListP
 PutBucketAccelerateConfigurationOutcome S3Client::PutBucketAccelerateConfiguration(const PutBucketAccelerateConfigurationRequest& request) const
 {
   Aws::StringStream ss;
-  Aws::Http::URI uri = ComputeEndpointString(request.GetBucket());
+  Aws::Http::URI uri = ComputeEndpointUri(request.GetBucket());
   ss.str("?accelerate");
   uri.SetQueryString(ss.str());
   XmlOutcome outcome = MakeRequest(uri, request, HttpMethod::HTTP_PUT);
@@ -2002,7 +2004,7 @@ void S3Client::PutBucketAccelerateConfigurationAsyncHelper(const PutBucketAccele
 PutBucketAclOutcome S3Client::PutBucketAcl(const PutBucketAclRequest& request) const
 {
   Aws::StringStream ss;
-  Aws::Http::URI uri = ComputeEndpointString(request.GetBucket());
+  Aws::Http::URI uri = ComputeEndpointUri(request.GetBucket());
   ss.str("?acl");
   uri.SetQueryString(ss.str());
   XmlOutcome outcome = MakeRequest(uri, request, HttpMethod::HTTP_PUT);
@@ -2037,7 +2039,7 @@ void S3Client::PutBucketAclAsyncHelper(const PutBucketAclRequest& request, const
 PutBucketAnalyticsConfigurationOutcome S3Client::PutBucketAnalyticsConfiguration(const PutBucketAnalyticsConfigurationRequest& request) const
 {
   Aws::StringStream ss;
-  Aws::Http::URI uri = ComputeEndpointString(request.GetBucket());
+  Aws::Http::URI uri = ComputeEndpointUri(request.GetBucket());
   ss.str("?analytics");
   uri.SetQueryString(ss.str());
   XmlOutcome outcome = MakeRequest(uri, request, HttpMethod::HTTP_PUT);
@@ -2072,7 +2074,7 @@ void S3Client::PutBucketAnalyticsConfigurationAsyncHelper(const PutBucketAnalyti
 PutBucketCorsOutcome S3Client::PutBucketCors(const PutBucketCorsRequest& request) const
 {
   Aws::StringStream ss;
-  Aws::Http::URI uri = ComputeEndpointString(request.GetBucket());
+  Aws::Http::URI uri = ComputeEndpointUri(request.GetBucket());
   ss.str("?cors");
   uri.SetQueryString(ss.str());
   XmlOutcome outcome = MakeRequest(uri, request, HttpMethod::HTTP_PUT);
@@ -2107,7 +2109,7 @@ void S3Client::PutBucketCorsAsyncHelper(const PutBucketCorsRequest& request, con
 PutBucketEncryptionOutcome S3Client::PutBucketEncryption(const PutBucketEncryptionRequest& request) const
 {
   Aws::StringStream ss;
-  Aws::Http::URI uri = ComputeEndpointString(request.GetBucket());
+  Aws::Http::URI uri = ComputeEndpointUri(request.GetBucket());
   ss.str("?encryption");
   uri.SetQueryString(ss.str());
   XmlOutcome outcome = MakeRequest(uri, request, HttpMethod::HTTP_PUT);
@@ -2142,7 +2144,7 @@ void S3Client::PutBucketEncryptionAsyncHelper(const PutBucketEncryptionRequest&
 PutBucketInventoryConfigurationOutcome S3Client::PutBucketInventoryConfiguration(const PutBucketInventoryConfigurationRequest& request) const
 {
   Aws::StringStream ss;
-  Aws::Http::URI uri = ComputeEndpointString(request.GetBucket());
+  Aws::Http::URI uri = ComputeEndpointUri(request.GetBucket());
   ss.str("?inventory");
   uri.SetQueryString(ss.str());
   XmlOutcome outcome = MakeRequest(uri, request, HttpMethod::HTTP_PUT);
@@ -2177,7 +2179,7 @@ void S3Client::PutBucketInventoryConfigurationAsyncHelper(const PutBucketInvento
 PutBucketLifecycleConfigurationOutcome S3Client::PutBucketLifecycleConfiguration(const PutBucketLifecycleConfigurationRequest& request) const
 {
   Aws::StringStream ss;
-  Aws::Http::URI uri = ComputeEndpointString(request.GetBucket());
+  Aws::Http::URI uri = ComputeEndpointUri(request.GetBucket());
   ss.str("?lifecycle");
   uri.SetQueryString(ss.str());
   XmlOutcome outcome = MakeRequest(uri, request, HttpMethod::HTTP_PUT);
@@ -2212,7 +2214,7 @@ void S3Client::PutBucketLifecycleConfigurationAsyncHelper(const PutBucketLifecyc
 PutBucketLoggingOutcome S3Client::PutBucketLogging(const PutBucketLoggingRequest& request) const
 {
   Aws::StringStream ss;
-  Aws::Http::URI uri = ComputeEndpointString(request.GetBucket());
+  Aws::Http::URI uri = ComputeEndpointUri(request.GetBucket());
   ss.str("?logging");
   uri.SetQueryString(ss.str());
   XmlOutcome outcome = MakeRequest(uri, request, HttpMethod::HTTP_PUT);
@@ -2247,7 +2249,7 @@ void S3Client::PutBucketLoggingAsyncHelper(const PutBucketLoggingRequest& reques
 PutBucketMetricsConfigurationOutcome S3Client::PutBucketMetricsConfiguration(const PutBucketMetricsConfigurationRequest& request) const
 {
   Aws::StringStream ss;
-  Aws::Http::URI uri = ComputeEndpointString(request.GetBucket());
+  Aws::Http::URI uri = ComputeEndpointUri(request.GetBucket());
   ss.str("?metrics");
   uri.SetQueryString(ss.str());
   XmlOutcome outcome = MakeRequest(uri, request, HttpMethod::HTTP_PUT);
@@ -2282,7 +2284,7 @@ void S3Client::PutBucketMetricsConfigurationAsyncHelper(const PutBucketMetricsCo
 PutBucketNotificationConfigurationOutcome S3Client::PutBucketNotificationConfiguration(const PutBucketNotificationConfigurationRequest& request) const
 {
   Aws::StringStream ss;
-  Aws::Http::URI uri = ComputeEndpointString(request.GetBucket());
+  Aws::Http::URI uri = ComputeEndpointUri(request.GetBucket());
   ss.str("?notification");
   uri.SetQueryString(ss.str());
   XmlOutcome outcome = MakeRequest(uri, request, HttpMethod::HTTP_PUT);
@@ -2317,7 +2319,7 @@ void S3Client::PutBucketNotificationConfigurationAsyncHelper(const PutBucketNoti
 PutBucketPolicyOutcome S3Client::PutBucketPolicy(const PutBucketPolicyRequest& request) const
 {
   Aws::StringStream ss;
-  Aws::Http::URI uri = ComputeEndpointString(request.GetBucket());
+  Aws::Http::URI uri = ComputeEndpointUri(request.GetBucket());
   ss.str("?policy");
   uri.SetQueryString(ss.str());
   XmlOutcome outcome = MakeRequest(uri, request, HttpMethod::HTTP_PUT);
@@ -2352,7 +2354,7 @@ void S3Client::PutBucketPolicyAsyncHelper(const PutBucketPolicyRequest& request,
 PutBucketReplicationOutcome S3Client::PutBucketReplication(const PutBucketReplicationRequest& request) const
 {
   Aws::StringStream ss;
-  Aws::Http::URI uri = ComputeEndpointString(request.GetBucket());
+  Aws::Http::URI uri = ComputeEndpointUri(request.GetBucket());
   ss.str("?replication");
   uri.SetQueryString(ss.str());
   XmlOutcome outcome = MakeRequest(uri, request, HttpMethod::HTTP_PUT);
@@ -2387,7 +2389,7 @@ void S3Client::PutBucketReplicationAsyncHelper(const PutBucketReplicationRequest
 PutBucketRequestPaymentOutcome S3Client::PutBucketRequestPayment(const PutBucketRequestPaymentRequest& request) const
 {
   Aws::StringStream ss;
-  Aws::Http::URI uri = ComputeEndpointString(request.GetBucket());
+  Aws::Http::URI uri = ComputeEndpointUri(request.GetBucket());
   ss.str("?requestPayment");
   uri.SetQueryString(ss.str());
   XmlOutcome outcome = MakeRequest(uri, request, HttpMethod::HTTP_PUT);
@@ -2422,7 +2424,7 @@ void S3Client::PutBucketRequestPaymentAsyncHelper(const PutBucketRequestPaymentR
 PutBucketTaggingOutcome S3Client::PutBucketTagging(const PutBucketTaggingRequest& request) const
 {
   Aws::StringStream ss;
-  Aws::Http::URI uri = ComputeEndpointString(request.GetBucket());
+  Aws::Http::URI uri = ComputeEndpointUri(request.GetBucket());
   ss.str("?tagging");
   uri.SetQueryString(ss.str());
   XmlOutcome outcome = MakeRequest(uri, request, HttpMethod::HTTP_PUT);
@@ -2457,7 +2459,7 @@ void S3Client::PutBucketTaggingAsyncHelper(const PutBucketTaggingRequest& reques
 PutBucketVersioningOutcome S3Client::PutBucketVersioning(const PutBucketVersioningRequest& request) const
 {
   Aws::StringStream ss;
-  Aws::Http::URI uri = ComputeEndpointString(request.GetBucket());
+  Aws::Http::URI uri = ComputeEndpointUri(request.GetBucket());
   ss.str("?versioning");
   uri.SetQueryString(ss.str());
   XmlOutcome outcome = MakeRequest(uri, request, HttpMethod::HTTP_PUT);
@@ -2492,7 +2494,7 @@ void S3Client::PutBucketVersioningAsyncHelper(const PutBucketVersioningRequest&
 PutBucketWebsiteOutcome S3Client::PutBucketWebsite(const PutBucketWebsiteRequest& request) const
 {
   Aws::StringStream ss;
-  Aws::Http::URI uri = ComputeEndpointString(request.GetBucket());
+  Aws::Http::URI uri = ComputeEndpointUri(request.GetBucket());
   ss.str("?website");
   uri.SetQueryString(ss.str());
   XmlOutcome outcome = MakeRequest(uri, request, HttpMethod::HTTP_PUT);
@@ -2527,7 +2529,7 @@ void S3Client::PutBucketWebsiteAsyncHelper(const PutBucketWebsiteRequest& reques
 PutObjectOutcome S3Client::PutObject(const PutObjectRequest& request) const
 {
   Aws::StringStream ss;
-  Aws::Http::URI uri = ComputeEndpointString(request.GetBucket());
+  Aws::Http::URI uri = ComputeEndpointUri(request.GetBucket());
   ss << "/";
   ss << request.GetKey();
   uri.SetPath(uri.GetPath() + ss.str());
@@ -2563,7 +2565,7 @@ void S3Client::PutObjectAsyncHelper(const PutObjectRequest& request, const PutOb
 PutObjectAclOutcome S3Client::PutObjectAcl(const PutObjectAclRequest& request) const
 {
   Aws::StringStream ss;
-  Aws::Http::URI uri = ComputeEndpointString(request.GetBucket());
+  Aws::Http::URI uri = ComputeEndpointUri(request.GetBucket());
   ss << "/";
   ss << request.GetKey();
   uri.SetPath(uri.GetPath() + ss.str());
@@ -2601,7 +2603,7 @@ void S3Client::PutObjectAclAsyncHelper(const PutObjectAclRequest& request, const
 PutObjectTaggingOutcome S3Client::PutObjectTagging(const PutObjectTaggingRequest& request) const
 {
   Aws::StringStream ss;
-  Aws::Http::URI uri = ComputeEndpointString(request.GetBucket());
+  Aws::Http::URI uri = ComputeEndpointUri(request.GetBucket());
   ss << "/";
   ss << request.GetKey();
   uri.SetPath(uri.GetPath() + ss.str());
@@ -2639,7 +2641,7 @@ void S3Client::PutObjectTaggingAsyncHelper(const PutObjectTaggingRequest& reques
 RestoreObjectOutcome S3Client::RestoreObject(const RestoreObjectRequest& request) const
 {
   Aws::StringStream ss;
-  Aws::Http::URI uri = ComputeEndpointString(request.GetBucket());
+  Aws::Http::URI uri = ComputeEndpointUri(request.GetBucket());
   ss << "/";
   ss << request.GetKey();
   uri.SetPath(uri.GetPath() + ss.str());
@@ -2677,7 +2679,7 @@ void S3Client::RestoreObjectAsyncHelper(const RestoreObjectRequest& request, con
 UploadPartOutcome S3Client::UploadPart(const UploadPartRequest& request) const
 {
   Aws::StringStream ss;
-  Aws::Http::URI uri = ComputeEndpointString(request.GetBucket());
+  Aws::Http::URI uri = ComputeEndpointUri(request.GetBucket());
   ss << "/";
   ss << request.GetKey();
   uri.SetPath(uri.GetPath() + ss.str());
@@ -2713,7 +2715,7 @@ void S3Client::UploadPartAsyncHelper(const UploadPartRequest& request, const Upl
 UploadPartCopyOutcome S3Client::UploadPartCopy(const UploadPartCopyRequest& request) const
 {
   Aws::StringStream ss;
-  Aws::Http::URI uri = ComputeEndpointString(request.GetBucket());
+  Aws::Http::URI uri = ComputeEndpointUri(request.GetBucket());
   ss << "/";
   ss << request.GetKey();
   uri.SetPath(uri.GetPath() + ss.str());
@@ -2856,6 +2858,28 @@ Aws::String S3Client::ComputeEndpointString() const
     return ss.str();
 }
 
+Aws::Http::URI S3Client::ComputeEndpointUri(const Aws::String& bucket) const
+{
+    {
+        Aws::Utils::Threading::ReaderLockGuard guard(m_bucketUrisLock);
+        auto cached = m_bucketUris.find(bucket);
+        if(cached != m_bucketUris.end())
+        {
+            return cached->second;
+        }
+    }
+
+    Aws::Http::URI uri = ComputeEndpointString(bucket);
+    Aws::Utils::Threading::WriterLockGuard guard(m_bucketUrisLock);
+    // bucket names come from callers, don't let them pile up.
+    if(m_bucketUris.size() >= MAX_CACHED_BUCKET_URIS)
+    {
+        m_bucketUris.clear();
+    }
+    m_bucketUris.emplace(bucket, uri);
+    return uri;
+}
+
 bool S3Client::MultipartUploadSupported() const
 {
     return true;
@@ -135,7 +135,7 @@ list(APPEND SDK_TEST_PROJECT_LIST "sqs:aws-cpp-sdk-sqs-integration-tests")
 list(APPEND SDK_TEST_PROJECT_LIST "transfer:aws-cpp-sdk-transfer-tests")
 list(APPEND SDK_TEST_PROJECT_LIST "s3-encryption:aws-cpp-sdk-s3-encryption-tests,aws-cpp-sdk-s3-encryption-integration-tests")
 list(APPEND SDK_TEST_PROJECT_LIST "ec2:aws-cpp-sdk-ec2-integration-tests")
-list(APPEND SDK_TEST_PROJECT_LIST "core:aws-cpp-sdk-core-tests")
+list(APPEND SDK_TEST_PROJECT_LIST "core:aws-cpp-sdk-core-tests,aws-cpp-sdk-binary-log-decoder")
 list(APPEND SDK_TEST_PROJECT_LIST "text-to-speech:aws-cpp-sdk-text-to-speech-tests,aws-cpp-sdk-polly-sample")
 
 set(SDK_DEPENDENCY_LIST "")
@@ -32,4 +32,5 @@ public class Operation {
     private String virtualAddressMemberName;
     private String authtype;
     private String authorizer;
+    private String signerName;
 }
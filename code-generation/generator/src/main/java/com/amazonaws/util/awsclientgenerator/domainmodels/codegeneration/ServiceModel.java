@@ -35,6 +35,11 @@ public class ServiceModel {
     Map<String, Shape> shapes;
     Map<String, Operation> operations;
     Collection<Error> serviceErrors;
+    Set<String> generatorOptions = new HashSet<>();
+    /**
+     * Shapes whose (de)serialization code comes from a service specific template; generator options leave them alone.
+     */
+    Set<String> customSerializedShapes = new HashSet<>();
 
     @Getter(AccessLevel.PRIVATE)
     @Setter(AccessLevel.PRIVATE)
@@ -48,4 +53,12 @@ public class ServiceModel {
         return shapes.values().parallelStream().anyMatch(shape -> shape.isRequest() && shape.hasStreamMembers());
     }
 
+    public boolean hasGeneratorOption(String option) {
+        return generatorOptions != null && generatorOptions.contains(option);
+    }
+
+    public boolean hasGeneratorOption(String option, Shape shape) {
+        return hasGeneratorOption(option) && shape != null && !customSerializedShapes.contains(shape.getName());
+    }
+
 }
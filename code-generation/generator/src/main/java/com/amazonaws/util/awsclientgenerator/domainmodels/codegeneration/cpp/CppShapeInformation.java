@@ -44,6 +44,12 @@ public class CppShapeInformation {
        exportValue = CppViewHelper.computeExportValue(serviceModel.getMetadata().getClassNamePrefix());
        cppType = CppViewHelper.computeCppType(shape);
        headerIncludes = CppViewHelper.computeHeaderIncludes(serviceModel.getMetadata().getProjectName(), shape);
+       if (serviceModel.hasGeneratorOption("packed-flags", shape)) {
+           headerIncludes.add("<aws/core/utils/PackedFlags.h>");
+       }
+       if (serviceModel.hasGeneratorOption("string-view", shape)) {
+           headerIncludes.add("<aws/core/utils/StringView.h>");
+       }
        sourceIncludes = CppViewHelper.computeSourceIncludes(shape);
        baseClass = CppViewHelper.computeBaseClass(serviceModel.getMetadata().getClassNamePrefix(), shape);
        requestContentType = CppViewHelper.computeRequestContentType(serviceModel.getMetadata());
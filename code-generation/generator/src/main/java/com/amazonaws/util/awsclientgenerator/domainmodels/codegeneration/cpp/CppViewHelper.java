@@ -16,13 +16,16 @@
 package com.amazonaws.util.awsclientgenerator.domainmodels.codegeneration.cpp;
 
 import com.amazonaws.util.awsclientgenerator.domainmodels.codegeneration.Metadata;
+import com.amazonaws.util.awsclientgenerator.domainmodels.codegeneration.ServiceModel;
 import com.amazonaws.util.awsclientgenerator.domainmodels.codegeneration.Shape;
 import com.amazonaws.util.awsclientgenerator.domainmodels.codegeneration.ShapeMember;
 import com.google.common.base.CaseFormat;
 
+import java.util.ArrayList;
 import java.util.HashMap;
 import java.util.LinkedHashSet;
 import java.util.LinkedList;
+import java.util.List;
 import java.util.Map;
 import java.util.Queue;
 import java.util.Set;
@@ -34,6 +37,7 @@ public class CppViewHelper {
     private static final Map<String, String> CORAL_TO_XML_CONVERSION_MAPPING = new HashMap<>();
     private static final Map<String, String> CORAL_TYPE_TO_DEFAULT_VALUES = new HashMap<>();
     private static final Map<String, String> CORAL_TO_CONTENT_TYPE_MAPPING = new HashMap<>();
+    private static final String PACKED_HAS_BEEN_SET_FLAGS_NAME = "m_hasBeenSet";
 
     static {
         CORAL_TO_CPP_TYPE_MAPPING.put("long", "long long");
@@ -115,6 +119,50 @@ public class CppViewHelper {
         return String.format("%sHasBeenSet", computeMemberVariableName(memberName));
     }
 
+    /**
+     * With the packed-flags option the HasBeenSet flags of a shape are the bits of a single PackedFlags member,
+     * indexed by the position of the member in the model. Otherwise every member has its own bool.
+     */
+    public static String computeVariableHasBeenSetName(ServiceModel serviceModel, Shape shape, String memberName) {
+        if (serviceModel.hasGeneratorOption("packed-flags", shape)) {
+            return String.format("%s[%d]", PACKED_HAS_BEEN_SET_FLAGS_NAME, computeHasBeenSetFlagIndex(shape, memberName));
+        }
+
+        return computeVariableHasBeenSetName(memberName);
+    }
+
+    public static int computeHasBeenSetFlagIndex(Shape shape, String memberName) {
+        return new ArrayList<>(shape.getMembers().keySet()).indexOf(memberName);
+    }
+
+    /**
+     * Order the member variables of a shape are declared and initialized in. With the packed-flags option members are
+     * ordered by alignment, largest first, so the compiler does not need to pad between them. Otherwise model order.
+     */
+    public static List<Map.Entry<String, ShapeMember>> computeMemberDeclarationOrder(ServiceModel serviceModel, Shape shape) {
+        List<Map.Entry<String, ShapeMember>> members = new ArrayList<>(shape.getMembers().entrySet());
+        if (serviceModel.hasGeneratorOption("packed-flags", shape)) {
+            members.sort((lhs, rhs) -> computeMemberAlignment(shape, rhs) - computeMemberAlignment(shape, lhs));
+        }
+
+        return members;
+    }
+
+    private static int computeMemberAlignment(Shape shape, Map.Entry<String, ShapeMember> member) {
+        Shape memberShape = member.getValue().getShape();
+        if (memberShape.getName().equals(shape.getName())) {
+            return 8;
+        }
+        if (memberShape.isBoolean()) {
+            return 1;
+        }
+        if (memberShape.isEnum() || "integer".equals(memberShape.getType().toLowerCase())) {
+            return 4;
+        }
+        // long long, double, strings, containers, nested models, DateTime, ByteBuffer and streams.
+        return 8;
+    }
+
     public static String computeJsonizeString(Shape shape) {
         String jsonizeString = ".Jsonize()";
 
@@ -179,6 +227,102 @@ public class CppViewHelper {
         return CORAL_TO_XML_CONVERSION_MAPPING.get(shape.getType());
     }
 
+    /**
+     * Expression that decodes the element an Aws::Utils::Xml::XmlReader named reader is positioned on into a value of shape's type.
+     */
+    public static String computeXmlReaderValueExpression(Shape shape) {
+        String text = "StringUtils::Trim(reader.ReadElementText().c_str())";
+
+        if(shape.isStructure()) {
+            return String.format("%s(reader)", shape.getName());
+        }
+        else if(shape.isEnum()) {
+            return String.format("%sMapper::Get%sForName(%s)", shape.getName(), shape.getName(), text);
+        }
+        else if(shape.isString()) {
+            return text;
+        }
+        else if(shape.isTimeStamp()) {
+            return String.format("DateTime(%s.c_str(), DateFormat::ISO_8601)", text);
+        }
+        else if(shape.isBlob()) {
+            return String.format("HashingUtils::Base64Decode(%s)", text);
+        }
+
+        return String.format("%s(%s.c_str())", computeXmlConversionMethodName(shape), text);
+    }
+
+    /**
+     * Expression handing the scalar held in varName to Aws::Utils::QueryStringBuilder::AddParameter.
+     */
+    public static String computeQueryStringValueExpression(Shape shape, String varName) {
+        if(shape.isEnum()) {
+            return String.format("%sMapper::GetNameFor%s(%s)", shape.getName(), shape.getName(), varName);
+        }
+        else if(shape.isTimeStamp()) {
+            return String.format("%s.ToGmtString(DateFormat::ISO_8601)", varName);
+        }
+        else if(shape.isBlob()) {
+            return String.format("HashingUtils::Base64Encode(%s)", varName);
+        }
+
+        return varName;
+    }
+
+    /**
+     * Results with a streaming member, or whose payload is a scalar, keep using the XmlDocument based deserializer.
+     */
+    public static boolean isXmlReaderDeserializable(Shape shape) {
+        if(shape == null || shape.hasStreamMembers()) {
+            return false;
+        }
+
+        return shape.getPayload() == null || shape.getMembers().get(shape.getPayload()).getShape().isStructure();
+    }
+
+    /**
+     * Lists of structures in an xml result payload, which the lazy-lists option exposes as Aws::Utils::Xml::XmlListView.
+     */
+    public static boolean isXmlLazyListMember(Shape shape, String memberName) {
+        ShapeMember member = shape.getMembers().get(memberName);
+
+        return member != null && shape.isResult() && member.isUsedForPayload() && !"ResponseMetadata".equals(memberName) &&
+                !memberName.equals(shape.getPayload()) && member.getShape().isList() &&
+                member.getShape().getListMember().getShape().isStructure();
+    }
+
+    public static boolean hasXmlLazyListMembers(Shape shape) {
+        return shape != null && !shape.hasStreamMembers() &&
+                shape.getMembers().keySet().stream().anyMatch(memberName -> isXmlLazyListMember(shape, memberName));
+    }
+
+    /**
+     * Name of the element wrapping the items of a list member, or null if the list is flattened.
+     */
+    public static String computeXmlListWrapperName(String memberName, ShapeMember member) {
+        if(member.isFlattened() || member.getShape().isFlattened()) {
+            return null;
+        }
+
+        return member.getLocationName() != null ? member.getLocationName() : memberName;
+    }
+
+    /**
+     * Name of the elements holding the items of a list member.
+     */
+    public static String computeXmlListElementName(String memberName, ShapeMember member) {
+        String listMemberLocationName = member.getShape().getListMember().getLocationName();
+
+        if(member.isFlattened() || member.getShape().isFlattened()) {
+            if(member.getLocationName() != null) {
+                return member.getLocationName();
+            }
+            return listMemberLocationName != null ? listMemberLocationName : memberName;
+        }
+
+        return listMemberLocationName != null ? listMemberLocationName : "member";
+    }
+
     public static String computeRequestContentType(Metadata metadata) {
         String protocolAndVersion = metadata.getProtocol();
 
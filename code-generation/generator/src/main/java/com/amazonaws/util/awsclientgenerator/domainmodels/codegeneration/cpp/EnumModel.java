@@ -23,6 +23,15 @@ import java.util.*;
 public class EnumModel {
     private String name;
     private List<EnumMemberModel> members;
+    /**
+     * Minimal perfect hash table over the member string values, looked up by aws/core/utils/PerfectHash.h.
+     * Displacements are per bucket, slot values are the enum values (one based member indexes) stored in each slot.
+     * Both are null when no table could be built, the mapper falls back to comparing hash codes then.
+     */
+    private List<Integer> perfectHashDisplacements;
+    private List<Integer> perfectHashSlotValues;
+
+    private static final int MAX_PERFECT_HASH_DISPLACEMENT = 1 << 16;
 
     public EnumModel(String enumName, Collection<String> enumMembers) {
         name = enumName;
@@ -30,6 +39,100 @@ public class EnumModel {
         for (String enumMember : enumMembers) {
            members.add(new EnumMemberModel(PlatformAndKeywordSanitizer.fixEnumValue(enumMember), enumMember));
         }
+        buildPerfectHashTable();
+    }
+
+    private void buildPerfectHashTable() {
+        int tableSize = members.size();
+        if (tableSize == 0) {
+            return;
+        }
+
+        int[] hashes = new int[tableSize];
+        List<List<Integer>> buckets = new ArrayList<>(tableSize);
+        for (int i = 0; i < tableSize; ++i) {
+            buckets.add(new ArrayList<>());
+        }
+        for (int i = 0; i < tableSize; ++i) {
+            String value = members.get(i).getMemberStringValue();
+            // HashingUtils::HashString hashes chars, which only agrees with String.hashCode() for ASCII.
+            if (!value.chars().allMatch(c -> c < 0x80)) {
+                return;
+            }
+            hashes[i] = value.hashCode();
+            buckets.get(Integer.remainderUnsigned(hashes[i], tableSize)).add(i);
+        }
+
+        List<Integer> bucketOrder = new ArrayList<>(tableSize);
+        for (int i = 0; i < tableSize; ++i) {
+            bucketOrder.add(i);
+        }
+        bucketOrder.sort((lhs, rhs) -> buckets.get(rhs).size() - buckets.get(lhs).size());
+
+        int[] slots = new int[tableSize];
+        Arrays.fill(slots, -1);
+        int[] displacements = new int[tableSize];
+        for (int bucket : bucketOrder) {
+            List<Integer> keys = buckets.get(bucket);
+            if (keys.size() <= 1) {
+                break;
+            }
+
+            int[] positions = new int[keys.size()];
+            for (int displacement = 1; ; ++displacement) {
+                // members with identical hash codes can never be separated.
+                if (displacement > MAX_PERFECT_HASH_DISPLACEMENT) {
+                    return;
+                }
+
+                boolean placed = true;
+                for (int k = 0; k < keys.size() && placed; ++k) {
+                    positions[k] = Integer.remainderUnsigned(perfectHashMix(hashes[keys.get(k)], displacement), tableSize);
+                    placed = slots[positions[k]] < 0;
+                    for (int j = 0; j < k && placed; ++j) {
+                        placed = positions[j] != positions[k];
+                    }
+                }
+
+                if (placed) {
+                    for (int k = 0; k < keys.size(); ++k) {
+                        slots[positions[k]] = keys.get(k);
+                    }
+                    displacements[bucket] = displacement;
+                    break;
+                }
+            }
+        }
+
+        // buckets with a single key store its slot directly, as -slot - 1.
+        int freeSlot = tableSize - 1;
+        for (int bucket : bucketOrder) {
+            if (buckets.get(bucket).size() == 1) {
+                while (slots[freeSlot] >= 0) {
+                    --freeSlot;
+                }
+                slots[freeSlot] = buckets.get(bucket).get(0);
+                displacements[bucket] = -freeSlot - 1;
+            }
+        }
+
+        perfectHashDisplacements = new ArrayList<>(tableSize);
+        perfectHashSlotValues = new ArrayList<>(tableSize);
+        for (int i = 0; i < tableSize; ++i) {
+            perfectHashDisplacements.add(displacements[i]);
+            perfectHashSlotValues.add(slots[i] + 1);
+        }
+    }
+
+    // must match PerfectHash::Mix in aws-cpp-sdk-core.
+    private static int perfectHashMix(int hashCode, int displacement) {
+        int x = hashCode ^ (displacement * 0x9E3779B9);
+        x ^= x >>> 16;
+        x *= 0x85EBCA6B;
+        x ^= x >>> 13;
+        x *= 0xC2B2AE35;
+        x ^= x >>> 16;
+        return x;
     }
 
 }
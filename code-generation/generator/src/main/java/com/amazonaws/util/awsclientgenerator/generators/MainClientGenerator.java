@@ -26,12 +26,13 @@ import com.google.gson.GsonBuilder;
 
 import java.io.*;
 import java.nio.charset.StandardCharsets;
+import java.util.Set;
 import java.util.zip.ZipEntry;
 import java.util.zip.ZipOutputStream;
 
 public class MainClientGenerator {
 
-    public File generateSourceFromC2jModel(C2jServiceModel c2jModel, String serviceName, String languageBinding, String namespace, String licenseText, boolean generateStandalonePackage) throws Exception {
+    public File generateSourceFromC2jModel(C2jServiceModel c2jModel, String serviceName, String languageBinding, String namespace, String licenseText, boolean generateStandalonePackage, Set<String> generatorOptions) throws Exception {
 
         SdkSpec spec = new SdkSpec(languageBinding, serviceName, null);
         // Transform to ServiceModel
@@ -42,6 +43,7 @@ public class MainClientGenerator {
         serviceModel.setRuntimeMinorVersion("@RUNTIME_MINOR_VERSION@");
         serviceModel.setNamespace(namespace);
         serviceModel.setLicenseText(licenseText);
+        serviceModel.setGeneratorOptions(generatorOptions);
 
         spec.setVersion(serviceModel.getMetadata().getApiVersion());
 
@@ -34,6 +34,14 @@ public class CloudfrontCppClientGenerator extends RestXmlCppClientGenerator {
         super();
     }
 
+    @Override
+    public SdkFileEntry[] generateSourceFiles(ServiceModel serviceModel) throws Exception {
+        //cloudfront results have their own deserializer, which generator options don't cover.
+        serviceModel.getShapes().values().stream().filter(Shape::isResult)
+                .forEach(shape -> serviceModel.getCustomSerializedShapes().add(shape.getName()));
+        return super.generateSourceFiles(serviceModel);
+    }
+
     @Override
     protected Map<String, String> computeRegionEndpointsForService(final ServiceModel serviceModel) {
         Map<String, String> endpoints = new HashMap<>();
@@ -41,6 +41,8 @@ public class DynamoDBJsonCppClientGenerator extends JsonCppClientGenerator {
         attributeValueShape.setName("AttributeValueValue");
         attributeValueShape.setType("structure");
         serviceModel.getShapes().put(attributeValueShape.getName(), attributeValueShape);
+        serviceModel.getCustomSerializedShapes().add("AttributeValue");
+        serviceModel.getCustomSerializedShapes().add(attributeValueShape.getName());
 
         return super.generateSourceFiles(serviceModel);
     }
@@ -78,6 +78,7 @@ public class S3RestXmlCppClientGenerator  extends RestXmlCppClientGenerator {
 		
         // Add ID2 and RequestId to GetObjectResult
         hackGetObjectOutputResponse(serviceModel);
+        serviceModel.getCustomSerializedShapes().add("GetBucketLocationResult");
 
         //if an operation should precompute md5, make sure it is added here.
         serviceModel.getOperations().values().stream()
@@ -21,8 +21,12 @@ import com.amazonaws.util.awsclientgenerator.generators.MainClientGenerator;
 
 import java.io.*;
 import java.nio.charset.StandardCharsets;
+import java.util.Arrays;
 import java.util.HashMap;
+import java.util.HashSet;
 import java.util.Map;
+import java.util.Set;
+import java.util.stream.Collectors;
 
 public class main {
 
@@ -33,6 +37,9 @@ public class main {
     static final String NAMESPACE = "namespace";
     static final String LICENSE_TEXT = "license-text";
     static final String STANDALONE_OPTION = "standlone";
+    static final String GENERATOR_OPTIONS = "generator-options";
+    static final Set<String> KNOWN_GENERATOR_OPTIONS = new HashSet<>(Arrays.asList(
+            "streaming-xml", "lazy-lists", "projection", "packed-flags", "query-builder", "string-view"));
 
     public static void main(String[] args) throws IOException {
 
@@ -67,6 +74,21 @@ public class main {
                 licenseText = argPairs.get(LICENSE_TEXT);
             }
             boolean generateStandalonePakckage = argPairs.containsKey(STANDALONE_OPTION);
+            Set<String> generatorOptions = new HashSet<>();
+            if (argPairs.containsKey(GENERATOR_OPTIONS) && !argPairs.get(GENERATOR_OPTIONS).isEmpty()) {
+                generatorOptions = Arrays.stream(argPairs.get(GENERATOR_OPTIONS).split(","))
+                        .map(String::trim).filter(option -> !option.isEmpty()).collect(Collectors.toSet());
+            }
+            Set<String> unknownOptions = generatorOptions.stream()
+                    .filter(option -> !KNOWN_GENERATOR_OPTIONS.contains(option)).collect(Collectors.toSet());
+            if (!unknownOptions.isEmpty()) {
+                System.out.println("Error: Unknown generator options: " + String.join(", ", unknownOptions) + ".");
+                return;
+            }
+            if (generatorOptions.contains("projection") && (generatorOptions.contains("streaming-xml") || generatorOptions.contains("lazy-lists"))) {
+                System.out.println("Error: The projection generator option can't be combined with streaming-xml or lazy-lists, their results would ignore the mask.");
+                return;
+            }
             String languageBinding = argPairs.get(LANGUAGE_BINDING_OPTION);
             String serviceName = argPairs.get(SERVICE_OPTION);
 
@@ -90,7 +112,8 @@ public class main {
                             serviceName,
                             namespace,
                             licenseText,
-                            generateStandalonePakckage);
+                            generateStandalonePakckage,
+                            generatorOptions);
                     System.out.println(outputLib.getAbsolutePath());
                 } catch (GeneratorNotImplementedException e) {
                     e.printStackTrace();
@@ -125,6 +148,13 @@ public class main {
         System.out.println("\t\t--service service to generate service for. If this is specified, you must specify version and language-binding");
         System.out.println("\t\t--version version of service to generate sdk for. If this is specified, you must specify language-binding and service.");
         System.out.println("\t\t  If you generate a specific SDK, the output will be the file where the sdk is stored in zip format");
+        System.out.println("\t\t--generator-options comma separated list of optional code generation features to enable:");
+        System.out.println("\t\t  streaming-xml  xml results are deserialized incrementally with Aws::Utils::Xml::XmlReader instead of an XmlDocument");
+        System.out.println("\t\t  lazy-lists     lists of structures in xml results are also exposed as lazily decoded Aws::Utils::Xml::XmlListView");
+        System.out.println("\t\t  projection     results honor the Aws::Utils::ProjectionMask set with AmazonWebServiceRequest::SetResponseProjection, not with streaming-xml or lazy-lists");
+        System.out.println("\t\t  packed-flags   models keep their HasBeenSet flags in one Aws::Utils::PackedFlags and order members by alignment");
+        System.out.println("\t\t  query-builder  query protocol requests are serialized into an Aws::Utils::QueryStringBuilder instead of string streams");
+        System.out.println("\t\t  string-view    models get Aws::Utils::StringView setters that assign string members in place");
     }
 
     private static String getOptionName(String optionStr) {
@@ -342,6 +342,14 @@ public class C2jModelToGeneratorModelTransformer {
         operation.setAuthtype(c2jOperation.getAuthtype());
         operation.setAuthorizer(c2jOperation.getAuthorizer());
 
+        if(operation.getAuthtype() == null || operation.getAuthtype().equals("v4-unsigned-body")) {
+            operation.setSignerName("Aws::Auth::SIGV4_SIGNER");
+        } else if (operation.getAuthtype().equals("custom")) {
+            operation.setSignerName("\"" + operation.getAuthorizer() + "\"");
+        } else {
+            operation.setSignerName("Aws::Auth::NULL_SIGNER");
+        }
+
         // input
         if (c2jOperation.getInput() != null) {
             String requestName = c2jOperation.getName() + "Request";
@@ -357,18 +365,8 @@ public class C2jModelToGeneratorModelTransformer {
                 requestShape.setPayload(requestName);
             }
 
-            requestShape.setSignBody(true);
-
-            if(operation.getAuthtype() == null) {
-                requestShape.setSignerName("Aws::Auth::SIGV4_SIGNER");
-            } else if (operation.getAuthtype().equals("v4-unsigned-body")) {
-                requestShape.setSignBody(false);
-                requestShape.setSignerName("Aws::Auth::SIGV4_SIGNER");
-            } else if (operation.getAuthtype().equals("custom")) {
-               requestShape.setSignerName("\"" + operation.getAuthorizer() + "\"");
-            } else {
-                requestShape.setSignerName("Aws::Auth::NULL_SIGNER");
-            }
+            requestShape.setSignBody(operation.getAuthtype() == null || !operation.getAuthtype().equals("v4-unsigned-body"));
+            requestShape.setSignerName(operation.getSignerName());
 
             ShapeMember requestMember = new ShapeMember();
             requestMember.setShape(requestShape);
@@ -38,6 +38,7 @@ def ParseArguments():
     parser.add_argument("--licenseText", action="store")
     parser.add_argument("--pathToApiDefinitions", action="store")
     parser.add_argument("--pathToGenerator", action="store")
+    parser.add_argument("--generatorOptions", help="Comma separated list of optional code generation features, e.g. streaming-xml.", action="store")
     parser.add_argument("--prepareTools", help="Makes sure generation environment is setup.", action="store_true")
     parser.add_argument("--listAll", help="Lists all available SDKs for generation.", action="store_true")
 
@@ -49,6 +50,7 @@ def ParseArguments():
     argMap[ "licenseText" ] = args[ "licenseText" ] or ""
     argMap[ "pathToApiDefinitions" ] = args["pathToApiDefinitions"] or "./code-generation/api-descriptions"
     argMap[ "pathToGenerator" ] = args["pathToGenerator"] or "./code-generation/generator"
+    argMap[ "generatorOptions" ] = args["generatorOptions"] or ""
     argMap[ "prepareTools" ] = args["prepareTools"]
     argMap[ "listAll" ] = args["listAll"]
 
@@ -86,12 +88,15 @@ def PrepareGenerator(generatorPath):
     process = subprocess.call('mvn package', shell=True)
     os.chdir(currentDir)
 
-def GenerateSdk(generatorPath, sdk, outputDir, namespace, licenseText):
+def GenerateSdk(generatorPath, sdk, outputDir, namespace, licenseText, generatorOptions):
     try:
        with codecs.open(sdk['filePath'], 'rb', 'utf-8') as api_definition:
             api_content = api_definition.read()
             jar_path = join(generatorPath, 'target/aws-client-generator-1.0-SNAPSHOT-jar-with-dependencies.jar')
-            process = Popen(['java', '-jar', jar_path, '--service', sdk['serviceName'], '--version', sdk['apiVersion'], '--namespace', namespace, '--license-text', licenseText, '--language-binding', 'cpp', '--arbitrary'],stdout=PIPE,  stdin=PIPE)
+            generatorArgs = ['java', '-jar', jar_path, '--service', sdk['serviceName'], '--version', sdk['apiVersion'], '--namespace', namespace, '--license-text', licenseText, '--language-binding', 'cpp', '--arbitrary']
+            if generatorOptions:
+                generatorArgs += ['--generator-options', generatorOptions]
+            process = Popen(generatorArgs, stdout=PIPE, stdin=PIPE)
             writer = codecs.getwriter('utf-8')
             stdInWriter = writer(process.stdin)
             stdInWriter.write(api_content)
@@ -118,6 +123,6 @@ def Main():
     if arguments['serviceName']:
         print('Generating {} api version {}.'.format(arguments['serviceName'], arguments['apiVersion']))
         key = '{}-{}'.format(arguments['serviceName'], arguments['apiVersion'])
-        GenerateSdk(arguments['pathToGenerator'], sdks[key], arguments['outputLocation'], arguments['namespace'], arguments['licenseText'])
+        GenerateSdk(arguments['pathToGenerator'], sdks[key], arguments['outputLocation'], arguments['namespace'], arguments['licenseText'], arguments['generatorOptions'])
 
 Main()
@@ -0,0 +1,72 @@
+/*
+ * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ * 
+ *  http://aws.amazon.com/apache2.0
+ * 
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+
+#pragma once
+
+#include <aws/testing/Testing_EXPORTS.h>
+
+#include <chrono>
+
+namespace Aws
+{
+namespace Testing
+{
+
+    /**
+     * Times the DISABLED_Benchmark tests. Results are recorded as properties of the running test, which gtest writes
+     * to its xml report (--gtest_also_run_disabled_tests --gtest_output=xml:<file>). They are reported rather than
+     * asserted on, timings vary too much between machines.
+     */
+    class AWS_TESTING_API BenchmarkTimer
+    {
+    public:
+        BenchmarkTimer();
+
+        /**
+         * Starts timing again from now.
+         */
+        void Restart();
+
+        /**
+         * Records the nanoseconds since the timer was started, divided by operationCount, under name.
+         */
+        void RecordNanosPerOperation(const char* name, long long operationCount) const;
+
+        /**
+         * Records the microseconds since the timer was started under name.
+         */
+        void RecordMicros(const char* name) const;
+
+    private:
+        std::chrono::steady_clock::time_point m_start;
+    };
+
+    /**
+     * Runs operation iterations times and records the nanoseconds each run took on average under name.
+     */
+    template<typename Operation>
+    void RecordNanosPerOperation(const char* name, int iterations, Operation operation)
+    {
+        BenchmarkTimer timer;
+        for (int i = 0; i < iterations; ++i)
+        {
+            operation();
+        }
+        timer.RecordNanosPerOperation(name, iterations);
+    }
+
+} // namespace Testing
+} // namespace Aws
@@ -14,6 +14,7 @@
   */
 
 #include <aws/core/internal/AWSHttpResourceClient.h>
+#include <mutex>
 
 class MockEC2MetadataClient : public Aws::Internal::EC2MetadataClient
 {
@@ -24,11 +25,13 @@ public:
 
     inline Aws::String GetDefaultCredentials() const override
     {
+        std::lock_guard<std::mutex> locker(m_mockedValueMutex);
         return m_mockedValue;
     }
 
     inline void SetMockedCredentialsValue(const Aws::String& mockValue)
     {
+        std::lock_guard<std::mutex> locker(m_mockedValueMutex);
         m_mockedValue = mockValue;
     }
 
@@ -43,6 +46,8 @@ public:
     }
 
 private:
+    //read by background refresh threads.
+    mutable std::mutex m_mockedValueMutex;
     Aws::String m_mockedValue;
     Aws::String m_region;
 };
@@ -57,14 +62,18 @@ public:
 
     inline Aws::String GetECSCredentials() const override
     {
+        std::lock_guard<std::mutex> locker(m_mockedValueMutex);
         return m_mockedValue;
     }
 
     inline void SetMockedCredentialsValue(const Aws::String& mockValue)
     {
+        std::lock_guard<std::mutex> locker(m_mockedValueMutex);
         m_mockedValue = mockValue;
     }
 
 private:
+    //read by background refresh threads.
+    mutable std::mutex m_mockedValueMutex;
     Aws::String m_mockedValue;
 };
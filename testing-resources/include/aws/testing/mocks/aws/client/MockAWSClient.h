@@ -95,6 +95,9 @@ public:
         return httpOutcome;
     }
 
+    using AWSClient::DisableRequestProcessing;
+    using AWSClient::EnableRequestProcessing;
+
     inline static const char* GetMockAccessKey() { return "AKIDEXAMPLE"; }
     inline static const char* GetMockSecretAccessKey() { return "wJalrXUtnFEMI/K7MDENG+bPxRfiCYEXAMPLEKEY"; }
 
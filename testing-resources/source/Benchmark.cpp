@@ -0,0 +1,49 @@
+/*
+ * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ * 
+ *  http://aws.amazon.com/apache2.0
+ * 
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+
+#include <aws/testing/Benchmark.h>
+
+#include <aws/external/gtest.h>
+
+namespace Aws
+{
+namespace Testing
+{
+
+BenchmarkTimer::BenchmarkTimer() :
+    m_start(std::chrono::steady_clock::now())
+{
+}
+
+void BenchmarkTimer::Restart()
+{
+    m_start = std::chrono::steady_clock::now();
+}
+
+void BenchmarkTimer::RecordNanosPerOperation(const char* name, long long operationCount) const
+{
+    auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - m_start).count();
+    ::testing::Test::RecordProperty(name, static_cast<int>(elapsed / (operationCount > 0 ? operationCount : 1)));
+}
+
+void BenchmarkTimer::RecordMicros(const char* name) const
+{
+    auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - m_start).count();
+    ::testing::Test::RecordProperty(name, static_cast<int>(elapsed));
+}
+
+} // namespace Testing
+} // namespace Aws